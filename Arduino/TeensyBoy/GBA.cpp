@@ -23,6 +23,11 @@
 */
 
 #include "GBA.h"
+#include "GBA_SRAMCache.h"
+#include "GBA_ROMCache.h"
+#include "GBA_Placement.h"
+#include "GBA_BlockCache.h"
+#include "GBA_IdleLoop.h"
 
 #define SCREEN_WIDTH  ILI9341_TFTWIDTH
 #define SCREEN_HEIGHT ILI9341_TFTHEIGHT
@@ -33,13 +38,6 @@
 #define TFT_SCLK    13
 #define TFT_MISO    12
 
-#define WIN0H 0x40
-#define WIN1H 0x42
-#define WIN0V 0x44
-#define WIN1V 0x46
-#define WININ 0x48
-#define WINOUT 0x4A
-
 #define BG0CNT 0x8
 #define BG1CNT 0xA
 #define BG2CNT 0xC
@@ -55,12 +53,8 @@
 #define BG3Y_L 0x3C
 #define BG3Y_H 0x3E
 
-#define DISPCNT 0x0
 #define DISPSTAT 0x4
 
-#define ioRegStart  0x00048000 //0x48000 - 0x484FF = 0x4FF
-#define vRamStart   0x00048500 //0x48500 - 0x684FF = 0x1FFFF
-#define palRamStart 0x00068500 //0x68500 - 0x688FF = 0x3FF
 #define OAM_BASE 0x7000000
 
 #define ButtonA 18
@@ -91,14 +85,19 @@ uint16_t dispCnt;
 
 uint8_t windowCover[240];
 uint8_t Blend[240];
+uint8_t lineFetch[240 * 2]; //One bitmap row fetched from VRAM in a single burst
 
 unsigned long FrameTime = 0;
+uint8_t FrameCount = 0;
+#ifdef MEMORY_STATS
+uint16_t MemoryStatsFrames = 0;
+#endif
 
 Processor *processor;
 
 void GBA::Initilise(class File *rom)
 {  
-  ILI9341_t3DMA screen = ILI9341_t3DMA(TFT_CS, TFT_DC, TFT_RST, TFT_MOSI, TFT_SCLK, TFT_MISO);
+  static ILI9341_t3DMA screen = ILI9341_t3DMA(TFT_CS, TFT_DC, TFT_RST, TFT_MOSI, TFT_SCLK, TFT_MISO); //tft outlives Initilise
   tft = &screen;
   tft->begin();
   tft->dfillScreen(ILI9341_BLACK);
@@ -115,9 +114,10 @@ void GBA::Initilise(class File *rom)
   pinMode(ButtonRSholder, INPUT_PULLUP);
   pinMode(ButtonLSholder, INPUT_PULLUP);
 
-  Processor GBAProcessor;
+  static Processor GBAProcessor; //Holds IWRAM and palette RAM, too large for the stack
   processor = &GBAProcessor;
   processor->CreateCores(processor, rom, false);
+  placement.ReportLayout();
 }
 
 void GBA::Update()
@@ -131,6 +131,9 @@ void GBA::Update()
     
     if (vramCycles <= 0)
     {
+      //DISPSTAT and VCOUNT are about to change
+      idleLoop.Wake();
+
       if (inHblank)
       {
         vramCycles += 960;
@@ -156,7 +159,7 @@ void GBA::Update()
 
 void GBA::EnterVBlank()
 {
-  uint16_t dispstat = processor->ReadU16(DISPSTAT, ioRegStart); //Read DISPSTAT 0x4 from IOReg
+  uint16_t dispstat = processor->Read<Region::IO, uint16_t>(DISPSTAT); //Read DISPSTAT 0x4 from IOReg
   dispstat |= 1;
   processor->WriteU16(DISPSTAT, ioRegStart, dispstat);//Write new DISPSTAT 0x4 to IOReg
 
@@ -168,6 +171,45 @@ void GBA::EnterVBlank()
   }
 
   Serial.println("FPS: " + String(FPS));
+
+#if defined(SRAM_CACHE_STATS) || defined(ROM_CACHE_STATS) || defined(BLOCK_CACHE_STATS) || defined(IDLE_LOOP_STATS)
+  if(++FrameCount == 60)
+  {
+#ifdef SRAM_CACHE_STATS
+    sramCache.PrintStats();
+    sramCache.ResetCounters();
+#endif
+#ifdef ROM_CACHE_STATS
+    romCache.PrintStats();
+    romCache.ResetCounters();
+#endif
+#ifdef BLOCK_CACHE_STATS
+    blockCache.PrintStats(FrameCount);
+    blockCache.ResetCounters();
+#endif
+#ifdef IDLE_LOOP_STATS
+    idleLoop.PrintStats(FrameCount);
+    idleLoop.ResetCounters();
+#endif
+    FrameCount = 0;
+  }
+#endif
+
+#ifdef MEMORY_STATS
+  if(++MemoryStatsFrames == MEMORY_STATS_FRAMES)
+  {
+    processor->PrintMemoryStats();
+    processor->ResetMemoryStats();
+    MemoryStatsFrames = 0;
+  }
+#endif
+
+  placement.EndFrame();
+
+#ifdef SRAM_HOST_MODEL
+  sramModel.Report();
+#endif
+
   tft->refreshOnce();
   FrameTime = micros();
   
@@ -183,32 +225,30 @@ void GBA::EnterVBlank()
 
 void GBA::LeaveVBlank()
 {
-  uint16_t dispstat = processor->ReadU16(DISPSTAT, ioRegStart); //Read DISPSTAT 0x4 from IOReg
+  uint16_t dispstat = processor->Read<Region::IO, uint16_t>(DISPSTAT); //Read DISPSTAT 0x4 from IOReg
   dispstat &= 0xFFFE;
   processor->WriteU16(DISPSTAT, ioRegStart, dispstat);//Write new DISPSTAT 0x4 to IOReg
 
   processor->UpdateKeyState();
 
   // Update the rot/scale values
-  processor->bgx[0] = (int32_t)processor->ReadU32(BG2X_L, ioRegStart); //Read BG2X_L from IOReg
-  processor->bgx[1] = (int32_t)processor->ReadU32(BG3X_L, ioRegStart); //Read BG3X_L from IOReg
-  processor->bgy[0] = (int32_t)processor->ReadU32(BG2Y_L, ioRegStart); //Read BG2Y_L from IOReg
-  processor->bgy[1] = (int32_t)processor->ReadU32(BG3Y_L, ioRegStart); //Read BG3Y_L from IOReg
+  processor->bgx[0] = (int32_t)processor->Read<Region::IO, uint32_t>(BG2X_L); //Read BG2X_L from IOReg
+  processor->bgx[1] = (int32_t)processor->Read<Region::IO, uint32_t>(BG3X_L); //Read BG3X_L from IOReg
+  processor->bgy[0] = (int32_t)processor->Read<Region::IO, uint32_t>(BG2Y_L); //Read BG2Y_L from IOReg
+  processor->bgy[1] = (int32_t)processor->Read<Region::IO, uint32_t>(BG3Y_L); //Read BG3Y_L from IOReg
 }
 
 void GBA::EnterHBlank()
 {
-  uint16_t dispstat = processor->ReadU16(DISPSTAT, ioRegStart); //Read DISPSTAT 0x4 from IOReg
+  uint16_t dispstat = processor->Read<Region::IO, uint16_t>(DISPSTAT); //Read DISPSTAT 0x4 from IOReg
   dispstat |= 1 << 1;
   processor->WriteU16(DISPSTAT, ioRegStart, dispstat);//Write new DISPSTAT 0x4 to IOReg
 
   // Advance the bgx registers
   for (int32_t bg = 0; bg <= 1; bg++)
   {
-    int16_t dmx = (int16_t)processor->ReadU16(BG2PB + (uint32_t)bg * 0x10, ioRegStart); //Read BG2PB from IOReg
-    int16_t dmy = (int16_t)processor->ReadU16(BG2PD+ (uint32_t)bg * 0x10, ioRegStart); //Read BG2PD from IOReg
-    processor->bgx[bg] += dmx;
-    processor->bgy[bg] += dmy;
+    processor->bgx[bg] += processor->ppu.bg[2 + bg].dmx;
+    processor->bgy[bg] += processor->ppu.bg[2 + bg].dmy;
   }
 
   if (curLine < 160)
@@ -225,7 +265,7 @@ void GBA::EnterHBlank()
 
 void GBA::LeaveHBlank()
 {
-  uint16_t dispstat = processor->ReadU16(DISPSTAT, ioRegStart); //Read DISPSTAT 0x4 from IOReg
+  uint16_t dispstat = processor->Read<Region::IO, uint16_t>(DISPSTAT); //Read DISPSTAT 0x4 from IOReg
   dispstat &= 0xFFF9;
   processor->WriteU16(DISPSTAT, ioRegStart, dispstat);//Write new DISPSTAT 0x4 to IOReg
 
@@ -254,7 +294,7 @@ void GBA::LeaveHBlank()
   // Check y-line trigger
   if (((dispstat >> 8) & 0xff) == curLine)
   {
-    dispstat = (uint16_t)(processor->ReadU16(DISPSTAT, ioRegStart) | (1 << 2)); //Read DISPSTAT 0x4 from IOReg
+    dispstat = (uint16_t)(processor->Read<Region::IO, uint16_t>(DISPSTAT) | (1 << 2)); //Read DISPSTAT 0x4 from IOReg
     processor->WriteU16(DISPSTAT, ioRegStart, dispstat);//Write new DISPSTAT 0x4 to IOReg
 
     if ((dispstat & (1 << 5)) != 0)
@@ -370,6 +410,11 @@ void GBA::GetButtons()
     keyreg |= (uint16_t)(1U << 9); //Unpressed
   }
 
+  if (keyreg != processor->keyState)
+  {
+    idleLoop.Wake();
+  }
+
   processor->keyState = keyreg;
 }
 
@@ -380,7 +425,9 @@ void GBA::RenderLine()
     return;
   }
 
-  dispCnt = processor->ReadU16(DISPCNT, ioRegStart); //Read DISPCNT 0x0 from IOReg
+  //Registers are decoded as they are written, the line only latches them
+  const PPUState &ppu = processor->ppu;
+  dispCnt = ppu.dispCnt;
 
   if ((dispCnt & (1 << 7)) != 0)
   {
@@ -392,82 +439,29 @@ void GBA::RenderLine()
   }
   else
   {
-    winEnabled = false;
-
-    if ((dispCnt & (1 << 13)) != 0)
-    {
-      // Calculate window 0 information
-      uint16_t winy = processor->ReadU16(WIN0V, ioRegStart); //Read WIN0V 0x0 from IOReg
-      win0y1 = (uint8_t)(winy >> 8);
-      win0y2 = (uint8_t)(winy & 0xff);
-      uint16_t winx = processor->ReadU16(WIN0H, ioRegStart); //Read WIN0H 0x0 from IOReg
-      win0x1 = (uint8_t)(winx >> 8);
-      win0x2 = (uint8_t)(winx & 0xff);
-
-      if (win0x2 > 240 || win0x1 > win0x2)
-      {
-        win0x2 = 240;
-      }
-
-      if (win0y2 > 160 || win0y1 > win0y2)
-      {
-        win0y2 = 160;
-      }
-
-      win0Enabled = processor->ReadU8(WININ, ioRegStart);
-      winEnabled = true;
-    }
-
-    if ((dispCnt & (1 << 14)) != 0)
-    {
-      // Calculate window 1 information
-      uint16_t winy = processor->ReadU16(WIN1V, ioRegStart); //Read WIN1V 0x0 from IOReg
-      win1y1 = (uint8_t)(winy >> 8);
-      win1y2 = (uint8_t)(winy & 0xff);
-      uint16_t winx = processor->ReadU16(WIN1H, ioRegStart); //Read WIN1H 0x0 from IOReg
-      win1x1 = (uint8_t)(winx >> 8);
-      win1x2 = (uint8_t)(winx & 0xff);
-
-      if (win1x2 > 240 || win1x1 > win1x2)
-      {
-        win1x2 = 240;
-      }
-
-      if (win1y2 > 160 || win1y1 > win1y2)
-      {
-        win1y2 = 160;
-      }
-
-      win1Enabled = processor->ReadU8(WININ + 1, ioRegStart);
-      winEnabled = true;
-    }
-
-    if ((dispCnt & (1 << 15)) != 0 && (dispCnt & (1 << 12)) != 0)
-    {
-      // Object windows are enabled
-      winObjEnabled = processor->ReadU8(WINOUT + 1, ioRegStart);
-      winEnabled = true;
-    }
-
-    if (winEnabled)
-    {
-      winOutEnabled = processor->ReadU8(WINOUT, ioRegStart);
-    }
-
-    // Calculate blending information
-    uint16_t bldcnt = processor->ReadU16(BLDCNT, ioRegStart); //Read BLD 0x0 from IOReg
-    blendType = (bldcnt >> 6) & 0x3;
-    blendSource = (uint8_t)(bldcnt & 0x3F);
-    blendTarget = (uint8_t)((bldcnt >> 8) & 0x3F);
-
-    uint16_t bldalpha = processor->ReadU16(BLDALPHA, ioRegStart); //Read BLDALPHA 0x0 from IOReg
-    blendA = (uint8_t)(bldalpha & 0x1F);
-    if (blendA > 0x10) blendA = 0x10;
-    blendB = (uint8_t)((bldalpha >> 8) & 0x1F);
-    if (blendB > 0x10) blendB = 0x10;
-
-    blendY = (uint8_t)(processor->ReadU8(BLDY, ioRegStart) & 0x1F);
-    if (blendY > 0x10) blendY = 0x10;
+    winEnabled = ppu.winEnabled;
+
+    win0x1 = ppu.win0x1;
+    win0x2 = ppu.win0x2;
+    win0y1 = ppu.win0y1;
+    win0y2 = ppu.win0y2;
+    win0Enabled = ppu.win0Enabled;
+
+    win1x1 = ppu.win1x1;
+    win1x2 = ppu.win1x2;
+    win1y1 = ppu.win1y1;
+    win1y2 = ppu.win1y2;
+    win1Enabled = ppu.win1Enabled;
+
+    winObjEnabled = ppu.winObjEnabled;
+    winOutEnabled = ppu.winOutEnabled;
+
+    blendType = ppu.blendType;
+    blendSource = ppu.blendSource;
+    blendTarget = ppu.blendTarget;
+    blendA = ppu.blendA;
+    blendB = ppu.blendB;
+    blendY = ppu.blendY;
 
     switch (dispCnt & 0x7)
     {
@@ -523,7 +517,7 @@ void GBA::DrawBackdrop()
   }
 
   // Draw backdrop first
-  uint16_t bgColor = processor->ReadU16(0, palRamStart);
+  uint16_t bgColor = processor->Read<Region::PAL, uint16_t>(0);
   uint16_t modColor = bgColor;
 
   if (blendType == 2 && (blendSource & (1 << 5)) != 0)
@@ -761,8 +755,7 @@ void GBA::RenderMode0Line()
     {
       if ((dispCnt & (1 << (8 + i))) != 0)
       {
-        uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)i, ioRegStart); //Read BG0CNT 0x0 from IOReg
-        if ((bgcnt & 0x3) == pri)
+        if (processor->ppu.bg[i].priority == pri)
         {
           RenderTextBg(i);
         }
@@ -780,9 +773,7 @@ void GBA::RenderMode1Line()
   {
     if ((dispCnt & (1 << (8 + 2))) != 0)
     {
-      uint16_t bgcnt = processor->ReadU16(BG2CNT, ioRegStart); //Read BG0CNT 0x0 from IOReg
-
-      if ((bgcnt & 0x3) == pri)
+      if (processor->ppu.bg[2].priority == pri)
       {
         RenderRotScaleBg(2);
       }
@@ -792,9 +783,7 @@ void GBA::RenderMode1Line()
     {
       if ((dispCnt & (1 << (8 + i))) != 0)
       {
-        uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)i, ioRegStart); //Read BG0CNT 0x0 from IOReg
-
-        if ((bgcnt & 0x3) == pri)
+        if (processor->ppu.bg[i].priority == pri)
         {
           RenderTextBg(i);
         }
@@ -815,9 +804,7 @@ void GBA::RenderMode2Line()
     {
       if ((dispCnt & (1 << (8 + i))) != 0)
       {
-        uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)i, ioRegStart); //Read BG0CNT 0x0 from IOReg
-
-        if ((bgcnt & 0x3) == pri)
+        if (processor->ppu.bg[i].priority == pri)
         {
           RenderRotScaleBg(i);
         }
@@ -830,13 +817,11 @@ void GBA::RenderMode2Line()
 
 void GBA::RenderMode3Line()
 {
-  uint16_t bg2Cnt = processor->ReadU16(BG2CNT, ioRegStart); //Read BG0CNT 0x0 from IOReg
-
   DrawBackdrop();
 
   uint8_t blendMaskType = (uint8_t)(1 << 2);
 
-  int32_t bgPri = bg2Cnt & 0x3;
+  int32_t bgPri = processor->ppu.bg[2].priority;
   for (int32_t pri = 3; pri > bgPri; pri--)
   {
     DrawSprites(pri);
@@ -848,23 +833,48 @@ void GBA::RenderMode3Line()
     uint32_t x = processor->bgx[0];
     uint32_t y = processor->bgy[0];
 
-    int16_t dx = (int16_t)processor->ReadU16(BG2PA, ioRegStart);
-    int16_t dy = (int16_t)processor->ReadU16(BG2PC, ioRegStart);
+    int16_t dx = processor->ppu.bg[2].dx;
+    int16_t dy = processor->ppu.bg[2].dy;
 
-    for (int32_t i = 0; i < 240; i++)
+    if (dy == 0)
     {
-      int32_t ax = ((int32_t)x) >> 8;
+      // Every pixel comes from the same bitmap row, fetch it in one go
       int32_t ay = ((int32_t)y) >> 8;
 
-      if (ax >= 0 && ax < 240 && ay >= 0 && ay < 160)
+      if (ay >= 0 && ay < 160)
       {
-        int32_t curIdx = ((ay * 240) + ax) * 2;
-        
-        DrawPixel(curLine, i, GBAToColor(processor->ReadU16(curIdx, vRamStart))); //Read From VRAM
-        Blend[i] = blendMaskType;
+        processor->ReadSpan<Region::VRAM>(ay * 240 * 2, lineFetch, 240 * 2);
+
+        for (int32_t i = 0; i < 240; i++)
+        {
+          int32_t ax = ((int32_t)x) >> 8;
+
+          if (ax >= 0 && ax < 240)
+          {
+            DrawPixel(curLine, i, GBAToColor((uint16_t)(lineFetch[ax * 2] | (lineFetch[ax * 2 + 1] << 8))));
+            Blend[i] = blendMaskType;
+          }
+          x += dx;
+        }
+      }
+    }
+    else
+    {
+      for (int32_t i = 0; i < 240; i++)
+      {
+        int32_t ax = ((int32_t)x) >> 8;
+        int32_t ay = ((int32_t)y) >> 8;
+
+        if (ax >= 0 && ax < 240 && ay >= 0 && ay < 160)
+        {
+          int32_t curIdx = ((ay * 240) + ax) * 2;
+          
+          DrawPixel(curLine, i, GBAToColor(processor->Read<Region::VRAM, uint16_t>(curIdx))); //Read From VRAM
+          Blend[i] = blendMaskType;
+        }
+        x += dx;
+        y += dy;
       }
-      x += dx;
-      y += dy;
     }
   }
 
@@ -876,13 +886,11 @@ void GBA::RenderMode3Line()
 
 void GBA::RenderMode4Line()
 {
-  uint16_t bg2Cnt = processor->ReadU16(BG2CNT, ioRegStart); //Read BG0CNT 0x0 from IOReg
-  
   DrawBackdrop();
 
   uint8_t blendMaskType = (uint8_t)(1 << 2);
 
-  int32_t bgPri = bg2Cnt & 0x3;
+  int32_t bgPri = processor->ppu.bg[2].priority;
   
   for (int32_t pri = 3; pri > bgPri; pri--)
   {
@@ -898,26 +906,56 @@ void GBA::RenderMode4Line()
     int32_t x = processor->bgx[0];
     int32_t y = processor->bgy[0];
 
-    int16_t dx = (int16_t)processor->ReadU16(BG2PA, ioRegStart);
-    int16_t dy = (int16_t)processor->ReadU16(BG2PC, ioRegStart);
+    int16_t dx = processor->ppu.bg[2].dx;
+    int16_t dy = processor->ppu.bg[2].dy;
 
-    for (int32_t i = 0; i < 240; i++)
+    if (dy == 0)
     {
-      int32_t ax = ((int32_t)x) >> 8;
+      // Every pixel comes from the same bitmap row, fetch it in one go
       int32_t ay = ((int32_t)y) >> 8;
 
-      if (ax >= 0 && ax < 240 && ay >= 0 && ay < 160)
+      if (ay >= 0 && ay < 160)
       {
-        int32_t lookup = processor->ReadU8(baseIdx + (ay * 240) + ax, vRamStart); //VRAM Lookup
-        
-        if (lookup != 0)
-        {                       
-          DrawPixel(curLine, i, GBAToColor(processor->ReadU16(lookup * 2, palRamStart))); //Palette Lookup
-          Blend[i] = blendMaskType;
+        processor->ReadSpan<Region::VRAM>(baseIdx + (ay * 240), lineFetch, 240);
+
+        for (int32_t i = 0; i < 240; i++)
+        {
+          int32_t ax = ((int32_t)x) >> 8;
+
+          if (ax >= 0 && ax < 240)
+          {
+            int32_t lookup = lineFetch[ax];
+
+            if (lookup != 0)
+            {
+              DrawPixel(curLine, i, GBAToColor(processor->Read<Region::PAL, uint16_t>(lookup * 2))); //Palette Lookup
+              Blend[i] = blendMaskType;
+            }
+          }
+          x += dx;
+        }
+      }
+    }
+    else
+    {
+      for (int32_t i = 0; i < 240; i++)
+      {
+        int32_t ax = ((int32_t)x) >> 8;
+        int32_t ay = ((int32_t)y) >> 8;
+
+        if (ax >= 0 && ax < 240 && ay >= 0 && ay < 160)
+        {
+          int32_t lookup = processor->Read<Region::VRAM, uint8_t>(baseIdx + (ay * 240) + ax); //VRAM Lookup
+          
+          if (lookup != 0)
+          {                       
+            DrawPixel(curLine, i, GBAToColor(processor->Read<Region::PAL, uint16_t>(lookup * 2))); //Palette Lookup
+            Blend[i] = blendMaskType;
+          }
         }
+        x += dx;
+        y += dy;
       }
-      x += dx;
-      y += dy;
     }
   }
 
@@ -929,13 +967,11 @@ void GBA::RenderMode4Line()
 
 void GBA::RenderMode5Line()
 {
-  uint16_t bg2Cnt = processor->ReadU16(BG2CNT, ioRegStart); //Read BG0CNT 0x0 from IOReg
-
   DrawBackdrop();
 
   uint8_t blendMaskType = (uint8_t)(1 << 2);
 
-  int32_t bgPri = bg2Cnt & 0x3;
+  int32_t bgPri = processor->ppu.bg[2].priority;
   for (int32_t pri = 3; pri > bgPri; pri--)
   {
     DrawSprites(pri);
@@ -950,23 +986,48 @@ void GBA::RenderMode5Line()
     int32_t x = processor->bgx[0];
     int32_t y = processor->bgy[0];
 
-    int16_t dx = (int16_t)processor->ReadU16(BG2PA, ioRegStart);
-    int16_t dy = (int16_t)processor->ReadU16(BG2PC, ioRegStart);
+    int16_t dx = processor->ppu.bg[2].dx;
+    int16_t dy = processor->ppu.bg[2].dy;
 
-    for (int32_t i = 0; i < 240; i++)
+    if (dy == 0)
     {
-      int32_t ax = ((int32_t)x) >> 8;
+      // Every pixel comes from the same bitmap row, fetch it in one go
       int32_t ay = ((int32_t)y) >> 8;
 
-      if (ax >= 0 && ax < 160 && ay >= 0 && ay < 128)
+      if (ay >= 0 && ay < 128)
       {
-        int32_t curIdx = (int32_t)(ay * 160 + ax) * 2;
+        processor->ReadSpan<Region::VRAM>(baseIdx + (ay * 160 * 2), lineFetch, 160 * 2);
 
-        DrawPixel(curLine, i, GBAToColor(processor->ReadU16(baseIdx + curIdx, vRamStart)));
-        Blend[i] = blendMaskType;
+        for (int32_t i = 0; i < 240; i++)
+        {
+          int32_t ax = ((int32_t)x) >> 8;
+
+          if (ax >= 0 && ax < 160)
+          {
+            DrawPixel(curLine, i, GBAToColor((uint16_t)(lineFetch[ax * 2] | (lineFetch[ax * 2 + 1] << 8))));
+            Blend[i] = blendMaskType;
+          }
+          x += dx;
+        }
+      }
+    }
+    else
+    {
+      for (int32_t i = 0; i < 240; i++)
+      {
+        int32_t ax = ((int32_t)x) >> 8;
+        int32_t ay = ((int32_t)y) >> 8;
+
+        if (ax >= 0 && ax < 160 && ay >= 0 && ay < 128)
+        {
+          int32_t curIdx = (int32_t)(ay * 160 + ax) * 2;
+
+          DrawPixel(curLine, i, GBAToColor(processor->Read<Region::VRAM, uint16_t>(baseIdx + curIdx)));
+          Blend[i] = blendMaskType;
+        }
+        x += dx;
+        y += dy;
       }
-      x += dx;
-      y += dy;
     }
   }
 
@@ -983,13 +1044,13 @@ void GBA::DrawSpriteWindows()
 
   for (int32_t oamNum = 127; oamNum >= 0; oamNum--)
   {
-    uint16_t attr0 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 0);
+    uint16_t attr0 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 0);
 
     // Not an object window, so continue
     if (((attr0 >> 10) & 3) != 2) continue;
 
-    uint16_t attr1 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 2);
-    uint16_t attr2 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 4);
+    uint16_t attr1 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 2);
+    uint16_t attr2 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 4);
 
     int32_t x = attr1 & 0x1FF;
     int32_t y = attr0 & 0xFF;
@@ -1103,7 +1164,7 @@ void GBA::DrawSpriteWindows()
             int32_t tx = (i - x) & 7;
             if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
             int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-            int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+            int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
             if (lookup != 0)
             {
               windowCover[i & 0x1ff] = winObjEnabled;
@@ -1122,7 +1183,7 @@ void GBA::DrawSpriteWindows()
             int32_t tx = (i - x) & 7;
             if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
             int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-            int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+            int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
             if ((tx & 1) == 0)
             {
               lookup &= 0xf;
@@ -1144,10 +1205,10 @@ void GBA::DrawSpriteWindows()
     {
       int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-      int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-      int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-      int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-      int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+      int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+      int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+      int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+      int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
       int32_t cx = rWidth / 2;
       int32_t cy = rHeight / 2;
@@ -1181,7 +1242,7 @@ void GBA::DrawSpriteWindows()
           if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height)
           {
             int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-            int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+            int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
             if (lookup != 0)
             {
               windowCover[i & 0x1ff] = winObjEnabled;
@@ -1203,7 +1264,7 @@ void GBA::DrawSpriteWindows()
           if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height)
           {
             int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-            int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+            int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
             if ((tx & 1) == 0)
             {
               lookup &= 0xf;
@@ -1234,12 +1295,12 @@ void GBA::DrawSpritesNormal(int8_t priority)
 
   for (int32_t oamNum = 127; oamNum >= 0; oamNum--)
   {
-    uint16_t attr2 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 4);
+    uint16_t attr2 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 4);
 
     if (((attr2 >> 10) & 3) != priority) continue;
 
-    uint16_t attr0 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 0);
-    uint16_t attr1 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 2);
+    uint16_t attr0 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 0);
+    uint16_t attr1 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 2);
 
     int32_t x = attr1 & 0x1FF;
     int32_t y = attr0 & 0xFF;
@@ -1372,10 +1433,10 @@ void GBA::DrawSpritesNormal(int8_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -1414,7 +1475,7 @@ void GBA::DrawSpritesNormal(int8_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -1425,7 +1486,7 @@ void GBA::DrawSpritesNormal(int8_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -1458,10 +1519,10 @@ void GBA::DrawSpritesNormal(int8_t priority)
       {
         int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-        int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-        int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-        int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-        int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+        int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+        int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+        int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+        int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
         int32_t cx = rWidth / 2;
         int32_t cy = rHeight / 2;
@@ -1495,10 +1556,10 @@ void GBA::DrawSpritesNormal(int8_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && true)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -1539,7 +1600,7 @@ void GBA::DrawSpritesNormal(int8_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && true)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -1550,7 +1611,7 @@ void GBA::DrawSpritesNormal(int8_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -1616,10 +1677,10 @@ void GBA::DrawSpritesNormal(int8_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = GBAToColor(processor->ReadU16(0x200 + lookup * 2, palRamStart));
+                uint16_t pixelColor = GBAToColor(processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2));
                 DrawPixel(curLine, (i & 0x1ff), pixelColor); 
                 Blend[(i & 0x1ff)] = blendMaskType;
               }
@@ -1638,7 +1699,7 @@ void GBA::DrawSpritesNormal(int8_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -1649,7 +1710,7 @@ void GBA::DrawSpritesNormal(int8_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = GBAToColor(processor->ReadU16(palIdx + lookup * 2, palRamStart));
+                uint16_t pixelColor = GBAToColor(processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2));
                 DrawPixel(curLine, (i & 0x1ff), pixelColor); 
                 Blend[(i & 0x1ff)] = blendMaskType;
               }
@@ -1662,10 +1723,10 @@ void GBA::DrawSpritesNormal(int8_t priority)
       {
         int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-        int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-        int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-        int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-        int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+        int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+        int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+        int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+        int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
         int32_t cx = rWidth / 2;
         int32_t cy = rHeight / 2;
@@ -1699,10 +1760,10 @@ void GBA::DrawSpritesNormal(int8_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && true)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = GBAToColor(processor->ReadU16(0x200 + lookup * 2, palRamStart));
+                uint16_t pixelColor = GBAToColor(processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2));
                 DrawPixel(curLine, (i & 0x1ff), pixelColor); 
                 Blend[(i & 0x1ff)] = blendMaskType;
               }
@@ -1723,7 +1784,7 @@ void GBA::DrawSpritesNormal(int8_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && true)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
 
               if ((tx & 1) == 0)
               {
@@ -1735,7 +1796,7 @@ void GBA::DrawSpritesNormal(int8_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = GBAToColor(processor->ReadU16(palIdx + lookup * 2, palRamStart));
+                uint16_t pixelColor = GBAToColor(processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2));
                 DrawPixel(curLine, (i & 0x1ff), pixelColor); 
                 Blend[(i & 0x1ff)] = blendMaskType;
               }
@@ -1758,12 +1819,12 @@ void GBA::DrawSpritesBlend(int8_t priority)
 
   for (int32_t oamNum = 127; oamNum >= 0; oamNum--)
   {
-    uint16_t attr2 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 4);
+    uint16_t attr2 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 4);
 
     if (((attr2 >> 10) & 3) != priority) continue;
 
-    uint16_t attr0 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 0);
-    uint16_t attr1 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 2);
+    uint16_t attr0 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 0);
+    uint16_t attr1 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 2);
 
     int32_t x = attr1 & 0x1FF;
     int32_t y = attr0 & 0xFF;
@@ -1896,10 +1957,10 @@ void GBA::DrawSpritesBlend(int8_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -1938,7 +1999,7 @@ void GBA::DrawSpritesBlend(int8_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -1949,7 +2010,7 @@ void GBA::DrawSpritesBlend(int8_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -1982,10 +2043,10 @@ void GBA::DrawSpritesBlend(int8_t priority)
       {
         int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-        int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-        int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-        int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-        int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+        int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+        int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+        int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+        int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
         int32_t cx = rWidth / 2;
         int32_t cy = rHeight / 2;
@@ -2019,10 +2080,10 @@ void GBA::DrawSpritesBlend(int8_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && true)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -2063,7 +2124,7 @@ void GBA::DrawSpritesBlend(int8_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && true)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -2074,7 +2135,7 @@ void GBA::DrawSpritesBlend(int8_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -2140,10 +2201,10 @@ void GBA::DrawSpritesBlend(int8_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -2182,7 +2243,7 @@ void GBA::DrawSpritesBlend(int8_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -2193,7 +2254,7 @@ void GBA::DrawSpritesBlend(int8_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -2226,10 +2287,10 @@ void GBA::DrawSpritesBlend(int8_t priority)
       {
         int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-        int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-        int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-        int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-        int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+        int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+        int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+        int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+        int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
         int32_t cx = rWidth / 2;
         int32_t cy = rHeight / 2;
@@ -2263,10 +2324,10 @@ void GBA::DrawSpritesBlend(int8_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && true)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -2307,7 +2368,7 @@ void GBA::DrawSpritesBlend(int8_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && true)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -2318,7 +2379,7 @@ void GBA::DrawSpritesBlend(int8_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -2361,12 +2422,12 @@ void GBA::DrawSpritesBrightInc(int32_t priority)
 
   for (int32_t oamNum = 127; oamNum >= 0; oamNum--)
   {
-    uint16_t attr2 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 4);
+    uint16_t attr2 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 4);
 
     if (((attr2 >> 10) & 3) != priority) continue;
 
-    uint16_t attr0 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 0);
-    uint16_t attr1 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 2);
+    uint16_t attr0 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 0);
+    uint16_t attr1 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 2);
 
     int32_t x = attr1 & 0x1FF;
     int32_t y = attr0 & 0xFF;
@@ -2499,10 +2560,10 @@ void GBA::DrawSpritesBrightInc(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -2541,7 +2602,7 @@ void GBA::DrawSpritesBrightInc(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -2552,7 +2613,7 @@ void GBA::DrawSpritesBrightInc(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -2585,10 +2646,10 @@ void GBA::DrawSpritesBrightInc(int32_t priority)
       {
         int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-        int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-        int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-        int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-        int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+        int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+        int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+        int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+        int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
         int32_t cx = rWidth / 2;
         int32_t cy = rHeight / 2;
@@ -2622,10 +2683,10 @@ void GBA::DrawSpritesBrightInc(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && true)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -2666,7 +2727,7 @@ void GBA::DrawSpritesBrightInc(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && true)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -2677,7 +2738,7 @@ void GBA::DrawSpritesBrightInc(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -2743,10 +2804,10 @@ void GBA::DrawSpritesBrightInc(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-          uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 uint16_t r = (uint8_t)((pixelColor) & 0x1F);       //First 5 Bits
                 uint16_t g = (uint8_t)((pixelColor >> 5) & 0x1F);  //Middle 5 Bits
                 uint16_t b = (uint8_t)((pixelColor >> 10) & 0x1F);   //Last 5 Bits
@@ -2772,7 +2833,7 @@ void GBA::DrawSpritesBrightInc(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -2783,7 +2844,7 @@ void GBA::DrawSpritesBrightInc(int32_t priority)
               }
               if (lookup != 0)
               {
-          uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 uint16_t r = (uint8_t)((pixelColor) & 0x1F);       //First 5 Bits
                 uint16_t g = (uint8_t)((pixelColor >> 5) & 0x1F);  //Middle 5 Bits
                 uint16_t b = (uint8_t)((pixelColor >> 10) & 0x1F);   //Last 5 Bits
@@ -2803,10 +2864,10 @@ void GBA::DrawSpritesBrightInc(int32_t priority)
       {
         int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-        int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-        int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-        int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-        int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+        int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+        int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+        int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+        int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
         int32_t cx = rWidth / 2;
         int32_t cy = rHeight / 2;
@@ -2840,10 +2901,10 @@ void GBA::DrawSpritesBrightInc(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && true)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-          uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 uint16_t r = (uint8_t)((pixelColor) & 0x1F);       //First 5 Bits
                 uint16_t g = (uint8_t)((pixelColor >> 5) & 0x1F);  //Middle 5 Bits
                 uint16_t b = (uint8_t)((pixelColor >> 10) & 0x1F);   //Last 5 Bits
@@ -2871,7 +2932,7 @@ void GBA::DrawSpritesBrightInc(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && true)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -2882,7 +2943,7 @@ void GBA::DrawSpritesBrightInc(int32_t priority)
               }
               if (lookup != 0)
               {
-          uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 uint16_t r = (uint8_t)((pixelColor) & 0x1F);       //First 5 Bits
                 uint16_t g = (uint8_t)((pixelColor >> 5) & 0x1F);  //Middle 5 Bits
                 uint16_t b = (uint8_t)((pixelColor >> 10) & 0x1F);   //Last 5 Bits
@@ -2912,12 +2973,12 @@ void GBA::DrawSpritesBrightDec(int32_t priority)
 
   for (int32_t oamNum = 127; oamNum >= 0; oamNum--)
   {
-    uint16_t attr2 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 4);
+    uint16_t attr2 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 4);
 
     if (((attr2 >> 10) & 3) != priority) continue;
 
-    uint16_t attr0 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 0);
-    uint16_t attr1 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 2);
+    uint16_t attr0 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 0);
+    uint16_t attr1 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 2);
 
     int32_t x = attr1 & 0x1FF;
     int32_t y = attr0 & 0xFF;
@@ -3050,10 +3111,10 @@ void GBA::DrawSpritesBrightDec(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -3092,7 +3153,7 @@ void GBA::DrawSpritesBrightDec(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -3103,7 +3164,7 @@ void GBA::DrawSpritesBrightDec(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -3136,10 +3197,10 @@ void GBA::DrawSpritesBrightDec(int32_t priority)
       {
         int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-        int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-        int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-        int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-        int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+        int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+        int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+        int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+        int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
         int32_t cx = rWidth / 2;
         int32_t cy = rHeight / 2;
@@ -3173,10 +3234,10 @@ void GBA::DrawSpritesBrightDec(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && true)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -3217,7 +3278,7 @@ void GBA::DrawSpritesBrightDec(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && true)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -3228,7 +3289,7 @@ void GBA::DrawSpritesBrightDec(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((Blend[i & 0x1ff] & blendTarget) != 0 && Blend[i & 0x1ff] != blendMaskType)
                 {
@@ -3294,10 +3355,10 @@ void GBA::DrawSpritesBrightDec(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 uint16_t r = (uint8_t)((pixelColor) & 0x1F);      //First 5 Bits
                 uint16_t g = (uint8_t)((pixelColor >> 5) & 0x1F);  //Middle 5 Bits
                 uint16_t b = (uint8_t)((pixelColor >> 10) & 0x1F);   //Last 5 Bits 
@@ -3323,7 +3384,7 @@ void GBA::DrawSpritesBrightDec(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -3334,7 +3395,7 @@ void GBA::DrawSpritesBrightDec(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 uint16_t r = (uint8_t)((pixelColor) & 0x1F);      //First 5 Bits
                 uint16_t g = (uint8_t)((pixelColor >> 5) & 0x1F);  //Middle 5 Bits
                 uint16_t b = (uint8_t)((pixelColor >> 10) & 0x1F);   //Last 5 Bits 
@@ -3354,10 +3415,10 @@ void GBA::DrawSpritesBrightDec(int32_t priority)
       {
         int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-        int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-        int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-        int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-        int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+        int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+        int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+        int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+        int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
         int32_t cx = rWidth / 2;
         int32_t cy = rHeight / 2;
@@ -3391,10 +3452,10 @@ void GBA::DrawSpritesBrightDec(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && true)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 uint16_t r = (uint8_t)((pixelColor) & 0x1F);      //First 5 Bits
                 uint16_t g = (uint8_t)((pixelColor >> 5) & 0x1F);  //Middle 5 Bits
                 uint16_t b = (uint8_t)((pixelColor >> 10) & 0x1F);   //Last 5 Bits 
@@ -3422,7 +3483,7 @@ void GBA::DrawSpritesBrightDec(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && true)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -3433,7 +3494,7 @@ void GBA::DrawSpritesBrightDec(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 uint16_t r = (uint8_t)((pixelColor) & 0x1F);      //First 5 Bits
                 uint16_t g = (uint8_t)((pixelColor >> 5) & 0x1F);  //Middle 5 Bits
                 uint16_t b = (uint8_t)((pixelColor >> 10) & 0x1F);   //Last 5 Bits 
@@ -3463,12 +3524,12 @@ void GBA::DrawSpritesWindow(int32_t priority)
 
   for (int32_t oamNum = 127; oamNum >= 0; oamNum--)
   {
-    uint16_t attr2 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 4);
+    uint16_t attr2 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 4);
 
     if (((attr2 >> 10) & 3) != priority) continue;
 
-    uint16_t attr0 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 0);
-    uint16_t attr1 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 2);
+    uint16_t attr0 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 0);
+    uint16_t attr1 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 2);
 
     int32_t x = attr1 & 0x1FF;
     int32_t y = attr0 & 0xFF;
@@ -3601,10 +3662,10 @@ void GBA::DrawSpritesWindow(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -3650,7 +3711,7 @@ void GBA::DrawSpritesWindow(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -3661,7 +3722,7 @@ void GBA::DrawSpritesWindow(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -3701,10 +3762,10 @@ void GBA::DrawSpritesWindow(int32_t priority)
       {
         int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-        int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-        int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-        int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-        int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+        int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+        int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+        int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+        int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
         int32_t cx = rWidth / 2;
         int32_t cy = rHeight / 2;
@@ -3738,10 +3799,10 @@ void GBA::DrawSpritesWindow(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && (windowCover[i & 0x1ff] & (1 << 4)) != 0)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -3789,7 +3850,7 @@ void GBA::DrawSpritesWindow(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && (windowCover[i & 0x1ff] & (1 << 4)) != 0)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -3800,7 +3861,7 @@ void GBA::DrawSpritesWindow(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -3873,10 +3934,10 @@ void GBA::DrawSpritesWindow(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = GBAToColor(processor->ReadU16(0x200 + lookup * 2, palRamStart));
+                uint16_t pixelColor = GBAToColor(processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2));
                 DrawPixel(curLine, (i & 0x1ff), pixelColor); 
                 Blend[(i & 0x1ff)] = blendMaskType;
               }
@@ -3895,7 +3956,7 @@ void GBA::DrawSpritesWindow(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -3906,7 +3967,7 @@ void GBA::DrawSpritesWindow(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = GBAToColor(processor->ReadU16(palIdx + lookup * 2, palRamStart));
+                uint16_t pixelColor = GBAToColor(processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2));
                 DrawPixel(curLine, (i & 0x1ff), pixelColor); 
                 Blend[(i & 0x1ff)] = blendMaskType;
               }
@@ -3919,10 +3980,10 @@ void GBA::DrawSpritesWindow(int32_t priority)
       {
         int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-        int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-        int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-        int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-        int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+        int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+        int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+        int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+        int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
         int32_t cx = rWidth / 2;
         int32_t cy = rHeight / 2;
@@ -3956,10 +4017,10 @@ void GBA::DrawSpritesWindow(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && (windowCover[i & 0x1ff] & (1 << 4)) != 0)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = GBAToColor(processor->ReadU16(0x200 + lookup * 2, palRamStart));
+                uint16_t pixelColor = GBAToColor(processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2));
                 DrawPixel(curLine, (i & 0x1ff), pixelColor); 
                 Blend[(i & 0x1ff)] = blendMaskType;
               }
@@ -3980,7 +4041,7 @@ void GBA::DrawSpritesWindow(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && (windowCover[i & 0x1ff] & (1 << 4)) != 0)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -3991,7 +4052,7 @@ void GBA::DrawSpritesWindow(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = GBAToColor(processor->ReadU16(palIdx + lookup * 2, palRamStart));
+                uint16_t pixelColor = GBAToColor(processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2));
                 DrawPixel(curLine, (i & 0x1ff), pixelColor); 
                 Blend[(i & 0x1ff)] = blendMaskType;
               }
@@ -4014,12 +4075,12 @@ void GBA::DrawSpritesWindowBlend(int32_t priority)
 
   for (int32_t oamNum = 127; oamNum >= 0; oamNum--)
   {
-    uint16_t attr2 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 4);
+    uint16_t attr2 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 4);
 
     if (((attr2 >> 10) & 3) != priority) continue;
 
-    uint16_t attr0 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 0);
-    uint16_t attr1 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 2);
+    uint16_t attr0 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 0);
+    uint16_t attr1 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 2);
 
     int32_t x = attr1 & 0x1FF;
     int32_t y = attr0 & 0xFF;
@@ -4152,10 +4213,10 @@ void GBA::DrawSpritesWindowBlend(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -4201,7 +4262,7 @@ void GBA::DrawSpritesWindowBlend(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -4212,7 +4273,7 @@ void GBA::DrawSpritesWindowBlend(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -4252,10 +4313,10 @@ void GBA::DrawSpritesWindowBlend(int32_t priority)
       {
         int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-        int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-        int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-        int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-        int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+        int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+        int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+        int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+        int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
         int32_t cx = rWidth / 2;
         int32_t cy = rHeight / 2;
@@ -4289,10 +4350,10 @@ void GBA::DrawSpritesWindowBlend(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && (windowCover[i & 0x1ff] & (1 << 4)) != 0)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -4340,7 +4401,7 @@ void GBA::DrawSpritesWindowBlend(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && (windowCover[i & 0x1ff] & (1 << 4)) != 0)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -4351,7 +4412,7 @@ void GBA::DrawSpritesWindowBlend(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -4424,10 +4485,10 @@ void GBA::DrawSpritesWindowBlend(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -4473,7 +4534,7 @@ void GBA::DrawSpritesWindowBlend(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -4484,7 +4545,7 @@ void GBA::DrawSpritesWindowBlend(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -4524,10 +4585,10 @@ void GBA::DrawSpritesWindowBlend(int32_t priority)
       {
         int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-        int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-        int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-        int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-        int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+        int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+        int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+        int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+        int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
         int32_t cx = rWidth / 2;
         int32_t cy = rHeight / 2;
@@ -4561,10 +4622,10 @@ void GBA::DrawSpritesWindowBlend(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && (windowCover[i & 0x1ff] & (1 << 4)) != 0)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -4614,7 +4675,7 @@ void GBA::DrawSpritesWindowBlend(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && (windowCover[i & 0x1ff] & (1 << 4)) != 0)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -4625,7 +4686,7 @@ void GBA::DrawSpritesWindowBlend(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -4675,12 +4736,12 @@ void GBA::DrawSpritesWindowBrightInc(int32_t priority)
 
   for (int32_t oamNum = 127; oamNum >= 0; oamNum--)
   {
-    uint16_t attr2 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 4);
+    uint16_t attr2 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 4);
 
     if (((attr2 >> 10) & 3) != priority) continue;
 
-    uint16_t attr0 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 0);
-    uint16_t attr1 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 2);
+    uint16_t attr0 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 0);
+    uint16_t attr1 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 2);
 
     int32_t x = attr1 & 0x1FF;
     int32_t y = attr0 & 0xFF;
@@ -4813,10 +4874,10 @@ void GBA::DrawSpritesWindowBrightInc(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -4862,7 +4923,7 @@ void GBA::DrawSpritesWindowBrightInc(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -4873,7 +4934,7 @@ void GBA::DrawSpritesWindowBrightInc(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -4913,10 +4974,10 @@ void GBA::DrawSpritesWindowBrightInc(int32_t priority)
       {
         int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-        int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-        int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-        int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-        int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+        int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+        int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+        int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+        int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
         int32_t cx = rWidth / 2;
         int32_t cy = rHeight / 2;
@@ -4950,10 +5011,10 @@ void GBA::DrawSpritesWindowBrightInc(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && (windowCover[i & 0x1ff] & (1 << 4)) != 0)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -5001,7 +5062,7 @@ void GBA::DrawSpritesWindowBrightInc(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && (windowCover[i & 0x1ff] & (1 << 4)) != 0)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -5012,7 +5073,7 @@ void GBA::DrawSpritesWindowBrightInc(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -5085,10 +5146,10 @@ void GBA::DrawSpritesWindowBrightInc(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
                   uint8_t r = (uint8_t)((pixelColor) & 0x1F);      //First 5 Bits
@@ -5121,7 +5182,7 @@ void GBA::DrawSpritesWindowBrightInc(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -5132,7 +5193,7 @@ void GBA::DrawSpritesWindowBrightInc(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -5161,10 +5222,10 @@ void GBA::DrawSpritesWindowBrightInc(int32_t priority)
       {
         int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-        int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-        int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-        int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-        int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+        int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+        int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+        int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+        int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
         int32_t cx = rWidth / 2;
         int32_t cy = rHeight / 2;
@@ -5198,10 +5259,10 @@ void GBA::DrawSpritesWindowBrightInc(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && (windowCover[i & 0x1ff] & (1 << 4)) != 0)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -5238,7 +5299,7 @@ void GBA::DrawSpritesWindowBrightInc(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && (windowCover[i & 0x1ff] & (1 << 4)) != 0)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -5249,7 +5310,7 @@ void GBA::DrawSpritesWindowBrightInc(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -5288,12 +5349,12 @@ void GBA::DrawSpritesWindowBrightDec(int32_t priority)
 
   for (int32_t oamNum = 127; oamNum >= 0; oamNum--)
   {
-    uint16_t attr2 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 4);
+    uint16_t attr2 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 4);
 
     if (((attr2 >> 10) & 3) != priority) continue;
 
-    uint16_t attr0 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 0);
-    uint16_t attr1 = processor->ReadU16Debug(OAM_BASE + (uint32_t)(oamNum * 8) + 2);
+    uint16_t attr0 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 0);
+    uint16_t attr1 = processor->Read<Region::OAM, uint16_t>((uint32_t)(oamNum * 8) + 2);
 
     int32_t x = attr1 & 0x1FF;
     int32_t y = attr0 & 0xFF;
@@ -5426,10 +5487,10 @@ void GBA::DrawSpritesWindowBrightDec(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -5475,7 +5536,7 @@ void GBA::DrawSpritesWindowBrightDec(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -5486,7 +5547,7 @@ void GBA::DrawSpritesWindowBrightDec(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -5526,10 +5587,10 @@ void GBA::DrawSpritesWindowBrightDec(int32_t priority)
       {
         int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-        int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-        int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-        int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-        int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+        int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+        int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+        int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+        int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
         int32_t cx = rWidth / 2;
         int32_t cy = rHeight / 2;
@@ -5563,10 +5624,10 @@ void GBA::DrawSpritesWindowBrightDec(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && (windowCover[i & 0x1ff] & (1 << 4)) != 0)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -5614,7 +5675,7 @@ void GBA::DrawSpritesWindowBrightDec(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && (windowCover[i & 0x1ff] & (1 << 4)) != 0)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -5625,7 +5686,7 @@ void GBA::DrawSpritesWindowBrightDec(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -5698,10 +5759,10 @@ void GBA::DrawSpritesWindowBrightDec(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 8) + tx;
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -5736,7 +5797,7 @@ void GBA::DrawSpritesWindowBrightDec(int32_t priority)
               int32_t tx = (i - x) & 7;
               if ((attr1 & (1 << 12)) != 0) tx = 7 - tx;
               int32_t curIdx = baseSprite * 32 + ((spritey & 7) * 4) + (tx / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -5747,7 +5808,7 @@ void GBA::DrawSpritesWindowBrightDec(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -5776,10 +5837,10 @@ void GBA::DrawSpritesWindowBrightDec(int32_t priority)
       {
         int32_t rotScaleParam = (attr1 >> 9) & 0x1F;
 
-        int16_t dx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x6);
-        int16_t dmx = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0xE);
-        int16_t dy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x16);
-        int16_t dmy = (int16_t)processor->ReadU16Debug(OAM_BASE + (uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
+        int16_t dx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x6);
+        int16_t dmx = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0xE);
+        int16_t dy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x16);
+        int16_t dmy = (int16_t)processor->Read<Region::OAM, uint16_t>((uint32_t)(rotScaleParam * 8 * 4) + 0x1E);
 
         int32_t cx = rWidth / 2;
         int32_t cy = rHeight / 2;
@@ -5813,10 +5874,10 @@ void GBA::DrawSpritesWindowBrightDec(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && (windowCover[i & 0x1ff] & (1 << 4)) != 0)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 8) + (tx & 7);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(0x200 + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(0x200 + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -5853,7 +5914,7 @@ void GBA::DrawSpritesWindowBrightDec(int32_t priority)
             if ((i & 0x1ff) < 240 && tx >= 0 && tx < Width && ty >= 0 && ty < Height && (windowCover[i & 0x1ff] & (1 << 4)) != 0)
             {
               int32_t curIdx = (baseSprite + ((ty / 8) * pitch) + ((tx / 8) * scale)) * 32 + ((ty & 7) * 4) + ((tx & 7) / 2);
-              int32_t lookup = processor->ReadU8(0x10000 + curIdx, vRamStart);
+              int32_t lookup = processor->Read<Region::VRAM, uint8_t>(0x10000 + curIdx);
               if ((tx & 1) == 0)
               {
                 lookup &= 0xf;
@@ -5864,7 +5925,7 @@ void GBA::DrawSpritesWindowBrightDec(int32_t priority)
               }
               if (lookup != 0)
               {
-                uint16_t pixelColor = processor->ReadU16(palIdx + lookup * 2, palRamStart);
+                uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palIdx + lookup * 2);
                 
                 if ((windowCover[i & 0x1ff] & (1 << 5)) != 0)
                 {
@@ -5899,27 +5960,20 @@ void GBA::RenderRotScaleBgNormal(int32_t bg)
 {
   uint8_t blendMaskType = (uint8_t)(1 << bg);
 
-  uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)bg, ioRegStart);
+  const PPUBackground &layer = processor->ppu.bg[bg];
 
-  int32_t Width = 0, Height = 0;
-  switch ((bgcnt >> 14) & 0x3)
-  {
-  case 0: Width = 128; Height = 128; break;
-  case 1: Width = 256; Height = 256; break;
-  case 2: Width = 512; Height = 512; break;
-  case 3: Width = 1024; Height = 1024; break;
-  }
+  int32_t Width = layer.affineSize, Height = layer.affineSize;
 
-  int32_t screenBase = ((bgcnt >> 8) & 0x1F) * 0x800;
-  int32_t charBase = ((bgcnt >> 2) & 0x3) * 0x4000;
+  int32_t screenBase = layer.screenBase;
+  int32_t charBase = layer.charBase;
 
   int32_t x = processor->bgx[bg - 2];
   int32_t y = processor->bgy[bg - 2];
 
-  int16_t dx = (int16_t)processor->ReadU16(BG2PA + (uint32_t)(bg - 2) * 0x10, ioRegStart);
-  int16_t dy = (int16_t)processor->ReadU16(BG2PC + (uint32_t)(bg - 2) * 0x10, ioRegStart);
+  int16_t dx = layer.dx;
+  int16_t dy = layer.dy;
 
-  bool transparent = (bgcnt & (1 << 13)) == 0;
+  bool transparent = !layer.wrap;
 
   for (int32_t i = 0; i < 240; i++)
   {
@@ -5931,12 +5985,12 @@ void GBA::RenderRotScaleBgNormal(int32_t bg)
       if ((ax >= 0 && ax < Width && ay >= 0 && ay < Height) || !transparent)
       {
         int32_t tmpTileIdx = (int32_t)(screenBase + ((ay & (Height - 1)) / 8) * (Width / 8) + ((ax & (Width - 1)) / 8));
-        int32_t tileChar = processor->ReadU8(tmpTileIdx, vRamStart);
+        int32_t tileChar = processor->Read<Region::VRAM, uint8_t>(tmpTileIdx);
 
-        int32_t lookup = processor->ReadU8(charBase + (tileChar * 64) + ((ay & 7) * 8) + (ax & 7), vRamStart);
+        int32_t lookup = processor->Read<Region::VRAM, uint8_t>(charBase + (tileChar * 64) + ((ay & 7) * 8) + (ax & 7));
         if (lookup != 0)
         {
-          uint16_t pixelColor = GBAToColor(processor->ReadU16(lookup * 2, palRamStart));
+          uint16_t pixelColor = GBAToColor(processor->Read<Region::PAL, uint16_t>(lookup * 2));
           DrawPixel(curLine, i, pixelColor); 
           Blend[i] = blendMaskType;
         }
@@ -5951,27 +6005,20 @@ void GBA::RenderRotScaleBgBlend(int32_t bg)
 {
   uint8_t blendMaskType = (uint8_t)(1 << bg);
 
-  uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)bg, ioRegStart);
+  const PPUBackground &layer = processor->ppu.bg[bg];
 
-  int32_t Width = 0, Height = 0;
-  switch ((bgcnt >> 14) & 0x3)
-  {
-  case 0: Width = 128; Height = 128; break;
-  case 1: Width = 256; Height = 256; break;
-  case 2: Width = 512; Height = 512; break;
-  case 3: Width = 1024; Height = 1024; break;
-  }
+  int32_t Width = layer.affineSize, Height = layer.affineSize;
 
-  int32_t screenBase = ((bgcnt >> 8) & 0x1F) * 0x800;
-  int32_t charBase = ((bgcnt >> 2) & 0x3) * 0x4000;
+  int32_t screenBase = layer.screenBase;
+  int32_t charBase = layer.charBase;
 
   int32_t x = processor->bgx[bg - 2];
   int32_t y = processor->bgy[bg - 2];
 
-  int16_t dx = (int16_t)processor->ReadU16(BG2PA + (uint32_t)(bg - 2) * 0x10, ioRegStart);
-  int16_t dy = (int16_t)processor->ReadU16(BG2PC + (uint32_t)(bg - 2) * 0x10, ioRegStart);
+  int16_t dx = layer.dx;
+  int16_t dy = layer.dy;
 
-  bool transparent = (bgcnt & (1 << 13)) == 0;
+  bool transparent = !layer.wrap;
 
   for (int32_t i = 0; i < 240; i++)
   {
@@ -5983,12 +6030,12 @@ void GBA::RenderRotScaleBgBlend(int32_t bg)
       if ((ax >= 0 && ax < Width && ay >= 0 && ay < Height) || !transparent)
       {
         int32_t tmpTileIdx = (int32_t)(screenBase + ((ay & (Height - 1)) / 8) * (Width / 8) + ((ax & (Width - 1)) / 8));
-        int32_t tileChar = processor->ReadU8(tmpTileIdx, vRamStart);
+        int32_t tileChar = processor->Read<Region::VRAM, uint8_t>(tmpTileIdx);
 
-        int32_t lookup = processor->ReadU8(charBase + (tileChar * 64) + ((ay & 7) * 8) + (ax & 7), vRamStart);
+        int32_t lookup = processor->Read<Region::VRAM, uint8_t>(charBase + (tileChar * 64) + ((ay & 7) * 8) + (ax & 7));
         if (lookup != 0)
         {
-          uint16_t pixelColor = processor->ReadU16(lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(lookup * 2);
           
           if ((Blend[i] & blendTarget) != 0)
           {
@@ -6025,27 +6072,20 @@ void GBA::RenderRotScaleBgBrightInc(int32_t bg)
 {
   uint8_t blendMaskType = (uint8_t)(1 << bg);
 
-  uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)bg, ioRegStart);
+  const PPUBackground &layer = processor->ppu.bg[bg];
 
-  int32_t Width = 0, Height = 0;
-  switch ((bgcnt >> 14) & 0x3)
-  {
-  case 0: Width = 128; Height = 128; break;
-  case 1: Width = 256; Height = 256; break;
-  case 2: Width = 512; Height = 512; break;
-  case 3: Width = 1024; Height = 1024; break;
-  }
+  int32_t Width = layer.affineSize, Height = layer.affineSize;
 
-  int32_t screenBase = ((bgcnt >> 8) & 0x1F) * 0x800;
-  int32_t charBase = ((bgcnt >> 2) & 0x3) * 0x4000;
+  int32_t screenBase = layer.screenBase;
+  int32_t charBase = layer.charBase;
 
   int32_t x = processor->bgx[bg - 2];
   int32_t y = processor->bgy[bg - 2];
 
-  int16_t dx = (int16_t)processor->ReadU16(BG2PA + (uint32_t)(bg - 2) * 0x10, ioRegStart);
-  int16_t dy = (int16_t)processor->ReadU16(BG2PC + (uint32_t)(bg - 2) * 0x10, ioRegStart);
+  int16_t dx = layer.dx;
+  int16_t dy = layer.dy;
 
-  bool transparent = (bgcnt & (1 << 13)) == 0;
+  bool transparent = !layer.wrap;
 
   for (int32_t i = 0; i < 240; i++)
   {
@@ -6057,12 +6097,12 @@ void GBA::RenderRotScaleBgBrightInc(int32_t bg)
       if ((ax >= 0 && ax < Width && ay >= 0 && ay < Height) || !transparent)
       {
         int32_t tmpTileIdx = (int32_t)(screenBase + ((ay & (Height - 1)) / 8) * (Width / 8) + ((ax & (Width - 1)) / 8));
-        int32_t tileChar = processor->ReadU8(tmpTileIdx, vRamStart);
+        int32_t tileChar = processor->Read<Region::VRAM, uint8_t>(tmpTileIdx);
 
-        int32_t lookup = processor->ReadU8(charBase + (tileChar * 64) + ((ay & 7) * 8) + (ax & 7), vRamStart);
+        int32_t lookup = processor->Read<Region::VRAM, uint8_t>(charBase + (tileChar * 64) + ((ay & 7) * 8) + (ax & 7));
         if (lookup != 0)
         {
-          uint16_t pixelColor = processor->ReadU16(lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(lookup * 2);
           uint16_t r = (uint8_t)((pixelColor) & 0x1F);      //First 5 Bits
           uint16_t g = (uint8_t)((pixelColor >> 5) & 0x1F);  //Middle 5 Bits
           uint16_t b = (uint8_t)((pixelColor >> 10) & 0x1F);   //Last 5 Bits 
@@ -6084,27 +6124,20 @@ void GBA::RenderRotScaleBgBrightDec(int32_t bg)
 {
   uint8_t blendMaskType = (uint8_t)(1 << bg);
 
-  uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)bg, ioRegStart);
+  const PPUBackground &layer = processor->ppu.bg[bg];
 
-  int32_t Width = 0, Height = 0;
-  switch ((bgcnt >> 14) & 0x3)
-  {
-  case 0: Width = 128; Height = 128; break;
-  case 1: Width = 256; Height = 256; break;
-  case 2: Width = 512; Height = 512; break;
-  case 3: Width = 1024; Height = 1024; break;
-  }
+  int32_t Width = layer.affineSize, Height = layer.affineSize;
 
-  int32_t screenBase = ((bgcnt >> 8) & 0x1F) * 0x800;
-  int32_t charBase = ((bgcnt >> 2) & 0x3) * 0x4000;
+  int32_t screenBase = layer.screenBase;
+  int32_t charBase = layer.charBase;
 
   int32_t x = processor->bgx[bg - 2];
   int32_t y = processor->bgy[bg - 2];
 
-  int16_t dx = (int16_t)processor->ReadU16(BG2PA + (uint32_t)(bg - 2) * 0x10, ioRegStart);
-  int16_t dy = (int16_t)processor->ReadU16(BG2PC + (uint32_t)(bg - 2) * 0x10, ioRegStart);
+  int16_t dx = layer.dx;
+  int16_t dy = layer.dy;
 
-  bool transparent = (bgcnt & (1 << 13)) == 0;
+  bool transparent = !layer.wrap;
 
   for (int32_t i = 0; i < 240; i++)
   {
@@ -6116,12 +6149,12 @@ void GBA::RenderRotScaleBgBrightDec(int32_t bg)
       if ((ax >= 0 && ax < Width && ay >= 0 && ay < Height) || !transparent)
       {
         int32_t tmpTileIdx = (int32_t)(screenBase + ((ay & (Height - 1)) / 8) * (Width / 8) + ((ax & (Width - 1)) / 8));
-        int32_t tileChar = processor->ReadU8(tmpTileIdx, vRamStart);
+        int32_t tileChar = processor->Read<Region::VRAM, uint8_t>(tmpTileIdx);
 
-        int32_t lookup = processor->ReadU8(charBase + (tileChar * 64) + ((ay & 7) * 8) + (ax & 7), vRamStart);
+        int32_t lookup = processor->Read<Region::VRAM, uint8_t>(charBase + (tileChar * 64) + ((ay & 7) * 8) + (ax & 7));
         if (lookup != 0)
         {
-          uint16_t pixelColor = processor->ReadU16(lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(lookup * 2);
           uint8_t r = (uint8_t)((pixelColor) & 0x1F);      //First 5 Bits
           uint8_t g = (uint8_t)((pixelColor >> 5) & 0x1F);  //Middle 5 Bits
           uint8_t b = (uint8_t)((pixelColor >> 10) & 0x1F);   //Last 5 Bits 
@@ -6143,27 +6176,20 @@ void GBA::RenderRotScaleBgWindow(int32_t bg)
 {
   uint8_t blendMaskType = (uint8_t)(1 << bg);
 
-  uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)bg, ioRegStart);
+  const PPUBackground &layer = processor->ppu.bg[bg];
 
-  int32_t Width = 0, Height = 0;
-  switch ((bgcnt >> 14) & 0x3)
-  {
-  case 0: Width = 128; Height = 128; break;
-  case 1: Width = 256; Height = 256; break;
-  case 2: Width = 512; Height = 512; break;
-  case 3: Width = 1024; Height = 1024; break;
-  }
+  int32_t Width = layer.affineSize, Height = layer.affineSize;
 
-  int32_t screenBase = ((bgcnt >> 8) & 0x1F) * 0x800;
-  int32_t charBase = ((bgcnt >> 2) & 0x3) * 0x4000;
+  int32_t screenBase = layer.screenBase;
+  int32_t charBase = layer.charBase;
 
   int32_t x = processor->bgx[bg - 2];
   int32_t y = processor->bgy[bg - 2];
 
-  int16_t dx = (int16_t)processor->ReadU16(BG2PA + (uint32_t)(bg - 2) * 0x10, ioRegStart);
-  int16_t dy = (int16_t)processor->ReadU16(BG2PC + (uint32_t)(bg - 2) * 0x10, ioRegStart);
+  int16_t dx = layer.dx;
+  int16_t dy = layer.dy;
 
-  bool transparent = (bgcnt & (1 << 13)) == 0;
+  bool transparent = !layer.wrap;
 
   for (int32_t i = 0; i < 240; i++)
   {
@@ -6175,12 +6201,12 @@ void GBA::RenderRotScaleBgWindow(int32_t bg)
       if ((ax >= 0 && ax < Width && ay >= 0 && ay < Height) || !transparent)
       {
         int32_t tmpTileIdx = (int32_t)(screenBase + ((ay & (Height - 1)) / 8) * (Width / 8) + ((ax & (Width - 1)) / 8));
-        int32_t tileChar = processor->ReadU8(tmpTileIdx, vRamStart);
+        int32_t tileChar = processor->Read<Region::VRAM, uint8_t>(tmpTileIdx);
 
-        int32_t lookup = processor->ReadU8(charBase + (tileChar * 64) + ((ay & 7) * 8) + (ax & 7), vRamStart);
+        int32_t lookup = processor->Read<Region::VRAM, uint8_t>(charBase + (tileChar * 64) + ((ay & 7) * 8) + (ax & 7));
         if (lookup != 0)
         {
-          uint16_t pixelColor = GBAToColor(processor->ReadU16(lookup * 2, palRamStart));
+          uint16_t pixelColor = GBAToColor(processor->Read<Region::PAL, uint16_t>(lookup * 2));
           DrawPixel(curLine, i, pixelColor); 
           Blend[i] = blendMaskType;
         }
@@ -6195,27 +6221,20 @@ void GBA::RenderRotScaleBgWindowBlend(int32_t bg)
 {
   uint8_t blendMaskType = (uint8_t)(1 << bg);
 
-  uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)bg, ioRegStart);
+  const PPUBackground &layer = processor->ppu.bg[bg];
 
-  int32_t Width = 0, Height = 0;
-  switch ((bgcnt >> 14) & 0x3)
-  {
-  case 0: Width = 128; Height = 128; break;
-  case 1: Width = 256; Height = 256; break;
-  case 2: Width = 512; Height = 512; break;
-  case 3: Width = 1024; Height = 1024; break;
-  }
+  int32_t Width = layer.affineSize, Height = layer.affineSize;
 
-  int32_t screenBase = ((bgcnt >> 8) & 0x1F) * 0x800;
-  int32_t charBase = ((bgcnt >> 2) & 0x3) * 0x4000;
+  int32_t screenBase = layer.screenBase;
+  int32_t charBase = layer.charBase;
 
   int32_t x = processor->bgx[bg - 2];
   int32_t y = processor->bgy[bg - 2];
 
-  int16_t dx = (int16_t)processor->ReadU16(BG2PA + (uint32_t)(bg - 2) * 0x10, ioRegStart);
-  int16_t dy = (int16_t)processor->ReadU16(BG2PC + (uint32_t)(bg - 2) * 0x10, ioRegStart);
+  int16_t dx = layer.dx;
+  int16_t dy = layer.dy;
 
-  bool transparent = (bgcnt & (1 << 13)) == 0;
+  bool transparent = !layer.wrap;
 
   for (int32_t i = 0; i < 240; i++)
   {
@@ -6227,12 +6246,12 @@ void GBA::RenderRotScaleBgWindowBlend(int32_t bg)
       if ((ax >= 0 && ax < Width && ay >= 0 && ay < Height) || !transparent)
       {
         int32_t tmpTileIdx = (int32_t)(screenBase + ((ay & (Height - 1)) / 8) * (Width / 8) + ((ax & (Width - 1)) / 8));
-        int32_t tileChar = processor->ReadU8(tmpTileIdx, vRamStart);
+        int32_t tileChar = processor->Read<Region::VRAM, uint8_t>(tmpTileIdx);
 
-        int32_t lookup = processor->ReadU8(charBase + (tileChar * 64) + ((ay & 7) * 8) + (ax & 7), vRamStart);
+        int32_t lookup = processor->Read<Region::VRAM, uint8_t>(charBase + (tileChar * 64) + ((ay & 7) * 8) + (ax & 7));
         if (lookup != 0)
         {
-          uint16_t pixelColor = processor->ReadU16(lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(lookup * 2);
           if ((windowCover[i] & (1 << 5)) != 0)
           {
             if ((Blend[i] & blendTarget) != 0)
@@ -6273,27 +6292,20 @@ void GBA::RenderRotScaleBgWindowBrightInc(int32_t bg)
 {
   uint8_t blendMaskType = (uint8_t)(1 << bg);
 
-  uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)bg, ioRegStart);
+  const PPUBackground &layer = processor->ppu.bg[bg];
 
-  int32_t Width = 0, Height = 0;
-  switch ((bgcnt >> 14) & 0x3)
-  {
-  case 0: Width = 128; Height = 128; break;
-  case 1: Width = 256; Height = 256; break;
-  case 2: Width = 512; Height = 512; break;
-  case 3: Width = 1024; Height = 1024; break;
-  }
+  int32_t Width = layer.affineSize, Height = layer.affineSize;
 
-  int32_t screenBase = ((bgcnt >> 8) & 0x1F) * 0x800;
-  int32_t charBase = ((bgcnt >> 2) & 0x3) * 0x4000;
+  int32_t screenBase = layer.screenBase;
+  int32_t charBase = layer.charBase;
 
   int32_t x = processor->bgx[bg - 2];
   int32_t y = processor->bgy[bg - 2];
 
-  int16_t dx = (int16_t)processor->ReadU16(BG2PA + (uint32_t)(bg - 2) * 0x10, ioRegStart);
-  int16_t dy = (int16_t)processor->ReadU16(BG2PC + (uint32_t)(bg - 2) * 0x10, ioRegStart);
+  int16_t dx = layer.dx;
+  int16_t dy = layer.dy;
 
-  bool transparent = (bgcnt & (1 << 13)) == 0;
+  bool transparent = !layer.wrap;
 
   for (int32_t i = 0; i < 240; i++)
   {
@@ -6305,12 +6317,12 @@ void GBA::RenderRotScaleBgWindowBrightInc(int32_t bg)
       if ((ax >= 0 && ax < Width && ay >= 0 && ay < Height) || !transparent)
       {
         uint32_t tmpTileIdx = (int32_t)(screenBase + ((ay & (Height - 1)) / 8) * (Width / 8) + ((ax & (Width - 1)) / 8));
-        uint32_t tileChar = processor->ReadU8(tmpTileIdx, vRamStart);
+        uint32_t tileChar = processor->Read<Region::VRAM, uint8_t>(tmpTileIdx);
 
-        int32_t lookup = processor->ReadU8(charBase + (tileChar * 64) + ((ay & 7) * 8) + (ax & 7), vRamStart);
+        int32_t lookup = processor->Read<Region::VRAM, uint8_t>(charBase + (tileChar * 64) + ((ay & 7) * 8) + (ax & 7));
         if (lookup != 0)
         {
-          uint16_t pixelColor = processor->ReadU16(lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(lookup * 2);
           
           if ((windowCover[i] & (1 << 5)) != 0)
           {
@@ -6341,27 +6353,20 @@ void GBA::RenderRotScaleBgWindowBrightDec(int32_t bg)
 {
   uint8_t blendMaskType = (uint8_t)(1 << bg);
 
-  uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)bg, ioRegStart);
+  const PPUBackground &layer = processor->ppu.bg[bg];
 
-  int32_t Width = 0, Height = 0;
-  switch ((bgcnt >> 14) & 0x3)
-  {
-  case 0: Width = 128; Height = 128; break;
-  case 1: Width = 256; Height = 256; break;
-  case 2: Width = 512; Height = 512; break;
-  case 3: Width = 1024; Height = 1024; break;
-  }
+  int32_t Width = layer.affineSize, Height = layer.affineSize;
 
-  int32_t screenBase = ((bgcnt >> 8) & 0x1F) * 0x800;
-  int32_t charBase = ((bgcnt >> 2) & 0x3) * 0x4000;
+  int32_t screenBase = layer.screenBase;
+  int32_t charBase = layer.charBase;
 
   int32_t x = processor->bgx[bg - 2];
   int32_t y = processor->bgy[bg - 2];
 
-  int16_t dx = (int16_t)processor->ReadU16(BG2PA + (uint32_t)(bg - 2) * 0x10, ioRegStart);
-  int16_t dy = (int16_t)processor->ReadU16(BG2PC + (uint32_t)(bg - 2) * 0x10, ioRegStart);
+  int16_t dx = layer.dx;
+  int16_t dy = layer.dy;
 
-  bool transparent = (bgcnt & (1 << 13)) == 0;
+  bool transparent = !layer.wrap;
 
   for (int32_t i = 0; i < 240; i++)
   {
@@ -6373,12 +6378,12 @@ void GBA::RenderRotScaleBgWindowBrightDec(int32_t bg)
       if ((ax >= 0 && ax < Width && ay >= 0 && ay < Height) || !transparent)
       {
         int32_t tmpTileIdx = (int32_t)(screenBase + ((ay & (Height - 1)) / 8) * (Width / 8) + ((ax & (Width - 1)) / 8));
-        int32_t tileChar = processor->ReadU8(tmpTileIdx, vRamStart);
+        int32_t tileChar = processor->Read<Region::VRAM, uint8_t>(tmpTileIdx);
 
-        int32_t lookup = processor->ReadU8(charBase + (tileChar * 64) + ((ay & 7) * 8) + (ax & 7), vRamStart);
+        int32_t lookup = processor->Read<Region::VRAM, uint8_t>(charBase + (tileChar * 64) + ((ay & 7) * 8) + (ax & 7));
         if (lookup != 0)
         {
-          uint16_t pixelColor = processor->ReadU16(lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(lookup * 2);
           
           if ((windowCover[i] & (1 << 5)) != 0)
           {
@@ -6410,30 +6415,23 @@ void GBA::RenderTextBgNormal(int32_t bg)
 {
   uint8_t blendMaskType = (uint8_t)(1 << bg);
 
-  uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)bg, ioRegStart);
+  const PPUBackground &layer = processor->ppu.bg[bg];
 
-  int32_t Width = 0, Height = 0;
-  switch ((bgcnt >> 14) & 0x3)
-  {
-  case 0: Width = 256; Height = 256; break;
-  case 1: Width = 512; Height = 256; break;
-  case 2: Width = 256; Height = 512; break;
-  case 3: Width = 512; Height = 512; break;
-  }
+  int32_t Width = layer.width, Height = layer.height;
 
-  int32_t screenBase = ((bgcnt >> 8) & 0x1F) * 0x800;
-  int32_t charBase = ((bgcnt >> 2) & 0x3) * 0x4000;
+  int32_t screenBase = layer.screenBase;
+  int32_t charBase = layer.charBase;
 
-  int32_t hofs = processor->ReadU16(BG0HOFS + (uint32_t)bg * 4, ioRegStart) & 0x1FF;
-  int32_t vofs = processor->ReadU16(BG0VOFS + (uint32_t)bg * 4, ioRegStart) & 0x1FF;
+  int32_t hofs = layer.hofs;
+  int32_t vofs = layer.vofs;
 
-  if ((bgcnt & (1 << 7)) != 0)
+  if (layer.colors256)
   {
     // 256 color tiles
     int32_t bgy = ((curLine + vofs) & (Height - 1)) / 8;
 
     int32_t tileIdx = screenBase + (((bgy & 31) * 32) * 2);
-    switch ((bgcnt >> 14) & 0x3)
+    switch (layer.size)
     {
       case 2: if (bgy >= 32) tileIdx += 32 * 32 * 2; break;
       case 3: if (bgy >= 32) tileIdx += 32 * 32 * 4; break;
@@ -6441,22 +6439,34 @@ void GBA::RenderTextBgNormal(int32_t bg)
 
     int32_t tileY = ((curLine + vofs) & 0x7) * 8;
 
+    //Whole map row for this line, the second screen block follows when the background is 512 wide
+    uint16_t mapRow[64];
+    processor->ReadSpan<Region::VRAM>(tileIdx, (uint8_t *)mapRow, 32 * 2);
+    if (Width == 512) processor->ReadSpan<Region::VRAM>(tileIdx + 32 * 32 * 2, (uint8_t *)&mapRow[32], 32 * 2);
+
+    //Tile row is fetched once per tile rather than once per pixel
+    int32_t lastTileChar = -1;
+    uint8_t tileRow[8];
+
     for (int32_t i = 0; i < 240; i++)
     {
       if (true)
       {
         int32_t bgx = ((i + hofs) & (Width - 1)) / 8;
-        int32_t tmpTileIdx = tileIdx + ((bgx & 31) * 2);
-        if (bgx >= 32) tmpTileIdx += 32 * 32 * 2;
-        int32_t tileChar = processor->ReadU16(tmpTileIdx, vRamStart);
+        int32_t tileChar = mapRow[bgx];
         int32_t x = (i + hofs) & 7;
         int32_t y = tileY;
         if ((tileChar & (1 << 10)) != 0) x = 7 - x;
         if ((tileChar & (1 << 11)) != 0) y = 56 - y;
-        int32_t lookup = processor->ReadU8(charBase + ((tileChar & 0x3FF) * 64) + y + x, vRamStart);
+        if (tileChar != lastTileChar)
+        {
+          processor->ReadSpan<Region::VRAM>(charBase + ((tileChar & 0x3FF) * 64) + y, tileRow, 8);
+          lastTileChar = tileChar;
+        }
+        int32_t lookup = tileRow[x];
         if (lookup != 0)
         {
-          uint16_t pixelColor = GBAToColor(processor->ReadU16(lookup * 2, palRamStart));
+          uint16_t pixelColor = GBAToColor(processor->Read<Region::PAL, uint16_t>(lookup * 2));
           DrawPixel(curLine, i, pixelColor);
           Blend[i] = blendMaskType;
         }
@@ -6469,7 +6479,7 @@ void GBA::RenderTextBgNormal(int32_t bg)
     int32_t bgy = ((curLine + vofs) & (Height - 1)) / 8;
 
     int32_t tileIdx = screenBase + (((bgy & 31) * 32) * 2);
-    switch ((bgcnt >> 14) & 0x3)
+    switch (layer.size)
     {
       case 2: if (bgy >= 32) tileIdx += 32 * 32 * 2; break;
       case 3: if (bgy >= 32) tileIdx += 32 * 32 * 4; break;
@@ -6477,19 +6487,31 @@ void GBA::RenderTextBgNormal(int32_t bg)
 
     int32_t tileY = ((curLine + vofs) & 0x7) * 4;
 
+    //Whole map row for this line, the second screen block follows when the background is 512 wide
+    uint16_t mapRow[64];
+    processor->ReadSpan<Region::VRAM>(tileIdx, (uint8_t *)mapRow, 32 * 2);
+    if (Width == 512) processor->ReadSpan<Region::VRAM>(tileIdx + 32 * 32 * 2, (uint8_t *)&mapRow[32], 32 * 2);
+
+    //Tile row is fetched once per tile rather than once per pixel
+    int32_t lastTileChar = -1;
+    uint8_t tileRow[4];
+
     for (int32_t i = 0; i < 240; i++)
     {
       if (true)
       {
         int32_t bgx = ((i + hofs) & (Width - 1)) / 8;
-        int32_t tmpTileIdx = tileIdx + ((bgx & 31) * 2);
-        if (bgx >= 32) tmpTileIdx += 32 * 32 * 2;
-        int32_t tileChar = processor->ReadU16(tmpTileIdx, vRamStart);
+        int32_t tileChar = mapRow[bgx];
         int32_t x = (i + hofs) & 7;
         int32_t y = tileY;
         if ((tileChar & (1 << 10)) != 0) x = 7 - x;
         if ((tileChar & (1 << 11)) != 0) y = 28 - y;
-        int32_t lookup = processor->ReadU8(charBase + ((tileChar & 0x3FF) * 32) + y + (x / 2), vRamStart);
+        if (tileChar != lastTileChar)
+        {
+          processor->ReadSpan<Region::VRAM>(charBase + ((tileChar & 0x3FF) * 32) + y, tileRow, 4);
+          lastTileChar = tileChar;
+        }
+        int32_t lookup = tileRow[x / 2];
         if ((x & 1) == 0)
         {
           lookup &= 0xf;
@@ -6501,7 +6523,7 @@ void GBA::RenderTextBgNormal(int32_t bg)
         if (lookup != 0)
         {
           int32_t palNum = ((tileChar >> 12) & 0xf) * 16 * 2;
-          uint16_t pixelColor = GBAToColor(processor->ReadU16(palNum + lookup * 2, palRamStart));
+          uint16_t pixelColor = GBAToColor(processor->Read<Region::PAL, uint16_t>(palNum + lookup * 2));
           DrawPixel(curLine, i, pixelColor);
           Blend[i] = blendMaskType;
         }
@@ -6514,30 +6536,23 @@ void GBA::RenderTextBgBlend(int32_t bg)
 {
   uint8_t blendMaskType = (uint8_t)(1 << bg);
 
-  uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)bg, ioRegStart);
+  const PPUBackground &layer = processor->ppu.bg[bg];
 
-  int32_t Width = 0, Height = 0;
-  switch ((bgcnt >> 14) & 0x3)
-  {
-    case 0: Width = 256; Height = 256; break;
-    case 1: Width = 512; Height = 256; break;
-    case 2: Width = 256; Height = 512; break;
-    case 3: Width = 512; Height = 512; break;
-  }
+  int32_t Width = layer.width, Height = layer.height;
 
-  int32_t screenBase = ((bgcnt >> 8) & 0x1F) * 0x800;
-  int32_t charBase = ((bgcnt >> 2) & 0x3) * 0x4000;
+  int32_t screenBase = layer.screenBase;
+  int32_t charBase = layer.charBase;
   
-  int32_t hofs = processor->ReadU16(BG0HOFS + (uint32_t)bg * 4, ioRegStart) & 0x1FF;
-  int32_t vofs = processor->ReadU16(BG0VOFS + (uint32_t)bg * 4, ioRegStart) & 0x1FF;
+  int32_t hofs = layer.hofs;
+  int32_t vofs = layer.vofs;
 
-  if ((bgcnt & (1 << 7)) != 0)
+  if (layer.colors256)
   {
     // 256 color tiles
     int32_t bgy = ((curLine + vofs) & (Height - 1)) / 8;
 
     int32_t tileIdx = screenBase + (((bgy & 31) * 32) * 2);
-    switch ((bgcnt >> 14) & 0x3)
+    switch (layer.size)
     {
       case 2: if (bgy >= 32) tileIdx += 32 * 32 * 2; break;
       case 3: if (bgy >= 32) tileIdx += 32 * 32 * 4; break;
@@ -6545,22 +6560,34 @@ void GBA::RenderTextBgBlend(int32_t bg)
 
     int32_t tileY = ((curLine + vofs) & 0x7) * 8;
 
+    //Whole map row for this line, the second screen block follows when the background is 512 wide
+    uint16_t mapRow[64];
+    processor->ReadSpan<Region::VRAM>(tileIdx, (uint8_t *)mapRow, 32 * 2);
+    if (Width == 512) processor->ReadSpan<Region::VRAM>(tileIdx + 32 * 32 * 2, (uint8_t *)&mapRow[32], 32 * 2);
+
+    //Tile row is fetched once per tile rather than once per pixel
+    int32_t lastTileChar = -1;
+    uint8_t tileRow[8];
+
     for (int32_t i = 0; i < 240; i++)
     {
       if (true)
       {
         int32_t bgx = ((i + hofs) & (Width - 1)) / 8;
-        int32_t tmpTileIdx = tileIdx + ((bgx & 31) * 2);
-        if (bgx >= 32) tmpTileIdx += 32 * 32 * 2;
-        int32_t tileChar = processor->ReadU16(tmpTileIdx, vRamStart);
+        int32_t tileChar = mapRow[bgx];
         int32_t x = (i + hofs) & 7;
         int32_t y = tileY;
         if ((tileChar & (1 << 10)) != 0) x = 7 - x;
         if ((tileChar & (1 << 11)) != 0) y = 56 - y;
-        int32_t lookup = processor->ReadU8(charBase + ((tileChar & 0x3FF) * 64) + y + x, vRamStart);
+        if (tileChar != lastTileChar)
+        {
+          processor->ReadSpan<Region::VRAM>(charBase + ((tileChar & 0x3FF) * 64) + y, tileRow, 8);
+          lastTileChar = tileChar;
+        }
+        int32_t lookup = tileRow[x];
         if (lookup != 0)
         {
-          uint16_t pixelColor = processor->ReadU16(lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(lookup * 2);
           
           if ((Blend[i] & blendTarget) != 0)
           {
@@ -6593,7 +6620,7 @@ void GBA::RenderTextBgBlend(int32_t bg)
     int32_t bgy = ((curLine + vofs) & (Height - 1)) / 8;
 
     int32_t tileIdx = screenBase + (((bgy & 31) * 32) * 2);
-    switch ((bgcnt >> 14) & 0x3)
+    switch (layer.size)
     {
       case 2: if (bgy >= 32) tileIdx += 32 * 32 * 2; break;
       case 3: if (bgy >= 32) tileIdx += 32 * 32 * 4; break;
@@ -6601,19 +6628,31 @@ void GBA::RenderTextBgBlend(int32_t bg)
 
     int32_t tileY = ((curLine + vofs) & 0x7) * 4;
 
+    //Whole map row for this line, the second screen block follows when the background is 512 wide
+    uint16_t mapRow[64];
+    processor->ReadSpan<Region::VRAM>(tileIdx, (uint8_t *)mapRow, 32 * 2);
+    if (Width == 512) processor->ReadSpan<Region::VRAM>(tileIdx + 32 * 32 * 2, (uint8_t *)&mapRow[32], 32 * 2);
+
+    //Tile row is fetched once per tile rather than once per pixel
+    int32_t lastTileChar = -1;
+    uint8_t tileRow[4];
+
     for (int32_t i = 0; i < 240; i++)
     {
       if (true)
       {
         int32_t bgx = ((i + hofs) & (Width - 1)) / 8;
-        int32_t tmpTileIdx = tileIdx + ((bgx & 31) * 2);
-        if (bgx >= 32) tmpTileIdx += 32 * 32 * 2;
-        int32_t tileChar = processor->ReadU16(tmpTileIdx, vRamStart);
+        int32_t tileChar = mapRow[bgx];
         int32_t x = (i + hofs) & 7;
         int32_t y = tileY;
         if ((tileChar & (1 << 10)) != 0) x = 7 - x;
         if ((tileChar & (1 << 11)) != 0) y = 28 - y;
-        int32_t lookup = processor->ReadU8(charBase + ((tileChar & 0x3FF) * 32) + y + (x / 2), vRamStart);
+        if (tileChar != lastTileChar)
+        {
+          processor->ReadSpan<Region::VRAM>(charBase + ((tileChar & 0x3FF) * 32) + y, tileRow, 4);
+          lastTileChar = tileChar;
+        }
+        int32_t lookup = tileRow[x / 2];
         if ((x & 1) == 0)
         {
           lookup &= 0xf;
@@ -6625,7 +6664,7 @@ void GBA::RenderTextBgBlend(int32_t bg)
         if (lookup != 0)
         {
           int32_t palNum = ((tileChar >> 12) & 0xf) * 16 * 2;
-          uint16_t pixelColor = processor->ReadU16(palNum + lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palNum + lookup * 2);
           
           if ((Blend[i] & blendTarget) != 0)
           {
@@ -6658,30 +6697,23 @@ void GBA::RenderTextBgBrightInc(int32_t bg)
 {
   uint8_t blendMaskType = (uint8_t)(1 << bg);
 
-  uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)bg, ioRegStart);
+  const PPUBackground &layer = processor->ppu.bg[bg];
 
-  int32_t Width = 0, Height = 0;
-  switch ((bgcnt >> 14) & 0x3)
-  {
-  case 0: Width = 256; Height = 256; break;
-  case 1: Width = 512; Height = 256; break;
-  case 2: Width = 256; Height = 512; break;
-  case 3: Width = 512; Height = 512; break;
-  }
+  int32_t Width = layer.width, Height = layer.height;
 
-  int32_t screenBase = ((bgcnt >> 8) & 0x1F) * 0x800;
-  int32_t charBase = ((bgcnt >> 2) & 0x3) * 0x4000;
+  int32_t screenBase = layer.screenBase;
+  int32_t charBase = layer.charBase;
 
-  int32_t hofs = processor->ReadU16(BG0HOFS + (uint32_t)bg * 4, ioRegStart) & 0x1FF;
-  int32_t vofs = processor->ReadU16(BG0VOFS + (uint32_t)bg * 4, ioRegStart) & 0x1FF;
+  int32_t hofs = layer.hofs;
+  int32_t vofs = layer.vofs;
 
-  if ((bgcnt & (1 << 7)) != 0)
+  if (layer.colors256)
   {
     // 256 color tiles
     int32_t bgy = ((curLine + vofs) & (Height - 1)) / 8;
 
     int32_t tileIdx = screenBase + (((bgy & 31) * 32) * 2);
-    switch ((bgcnt >> 14) & 0x3)
+    switch (layer.size)
     {
       case 2: if (bgy >= 32) tileIdx += 32 * 32 * 2; break;
       case 3: if (bgy >= 32) tileIdx += 32 * 32 * 4; break;
@@ -6689,22 +6721,34 @@ void GBA::RenderTextBgBrightInc(int32_t bg)
 
     int32_t tileY = ((curLine + vofs) & 0x7) * 8;
 
+    //Whole map row for this line, the second screen block follows when the background is 512 wide
+    uint16_t mapRow[64];
+    processor->ReadSpan<Region::VRAM>(tileIdx, (uint8_t *)mapRow, 32 * 2);
+    if (Width == 512) processor->ReadSpan<Region::VRAM>(tileIdx + 32 * 32 * 2, (uint8_t *)&mapRow[32], 32 * 2);
+
+    //Tile row is fetched once per tile rather than once per pixel
+    int32_t lastTileChar = -1;
+    uint8_t tileRow[8];
+
     for (int32_t i = 0; i < 240; i++)
     {
       if (true)
       {
         int32_t bgx = ((i + hofs) & (Width - 1)) / 8;
-        int32_t tmpTileIdx = tileIdx + ((bgx & 31) * 2);
-        if (bgx >= 32) tmpTileIdx += 32 * 32 * 2;
-        int32_t tileChar = processor->ReadU16(tmpTileIdx, vRamStart);
+        int32_t tileChar = mapRow[bgx];
         int32_t x = (i + hofs) & 7;
         int32_t y = tileY;
         if ((tileChar & (1 << 10)) != 0) x = 7 - x;
         if ((tileChar & (1 << 11)) != 0) y = 56 - y;
-        int32_t lookup = processor->ReadU8(charBase + ((tileChar & 0x3FF) * 64) + y + x, vRamStart);
+        if (tileChar != lastTileChar)
+        {
+          processor->ReadSpan<Region::VRAM>(charBase + ((tileChar & 0x3FF) * 64) + y, tileRow, 8);
+          lastTileChar = tileChar;
+        }
+        int32_t lookup = tileRow[x];
         if (lookup != 0)
         {
-          uint16_t pixelColor = processor->ReadU16(lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(lookup * 2);
           uint16_t r = (uint8_t)((pixelColor) & 0x1F);       //First 5 Bits
           uint16_t g = (uint8_t)((pixelColor >> 5) & 0x1F);  //Middle 5 Bits
           uint16_t b = (uint8_t)((pixelColor >> 10) & 0x1F);   //Last 5 Bits
@@ -6724,7 +6768,7 @@ void GBA::RenderTextBgBrightInc(int32_t bg)
     int32_t bgy = ((curLine + vofs) & (Height - 1)) / 8;
 
     int32_t tileIdx = screenBase + (((bgy & 31) * 32) * 2);
-    switch ((bgcnt >> 14) & 0x3)
+    switch (layer.size)
     {
     case 2: if (bgy >= 32) tileIdx += 32 * 32 * 2; break;
     case 3: if (bgy >= 32) tileIdx += 32 * 32 * 4; break;
@@ -6732,19 +6776,31 @@ void GBA::RenderTextBgBrightInc(int32_t bg)
 
     int32_t tileY = ((curLine + vofs) & 0x7) * 4;
 
+    //Whole map row for this line, the second screen block follows when the background is 512 wide
+    uint16_t mapRow[64];
+    processor->ReadSpan<Region::VRAM>(tileIdx, (uint8_t *)mapRow, 32 * 2);
+    if (Width == 512) processor->ReadSpan<Region::VRAM>(tileIdx + 32 * 32 * 2, (uint8_t *)&mapRow[32], 32 * 2);
+
+    //Tile row is fetched once per tile rather than once per pixel
+    int32_t lastTileChar = -1;
+    uint8_t tileRow[4];
+
     for (int32_t i = 0; i < 240; i++)
     {
       if (true)
       {
         int32_t bgx = ((i + hofs) & (Width - 1)) / 8;
-        int32_t tmpTileIdx = tileIdx + ((bgx & 31) * 2);
-        if (bgx >= 32) tmpTileIdx += 32 * 32 * 2;
-        int32_t tileChar = processor->ReadU16(tmpTileIdx, vRamStart);
+        int32_t tileChar = mapRow[bgx];
         int32_t x = (i + hofs) & 7;
         int32_t y = tileY;
         if ((tileChar & (1 << 10)) != 0) x = 7 - x;
         if ((tileChar & (1 << 11)) != 0) y = 28 - y;
-        int32_t lookup = processor->ReadU8(charBase + ((tileChar & 0x3FF) * 32) + y + (x / 2), vRamStart);
+        if (tileChar != lastTileChar)
+        {
+          processor->ReadSpan<Region::VRAM>(charBase + ((tileChar & 0x3FF) * 32) + y, tileRow, 4);
+          lastTileChar = tileChar;
+        }
+        int32_t lookup = tileRow[x / 2];
         if ((x & 1) == 0)
         {
           lookup &= 0xf;
@@ -6756,7 +6812,7 @@ void GBA::RenderTextBgBrightInc(int32_t bg)
         if (lookup != 0)
         {
           int32_t palNum = ((tileChar >> 12) & 0xf) * 16 * 2;
-          uint16_t pixelColor = processor->ReadU16(palNum + lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palNum + lookup * 2);
           uint16_t r = (uint8_t)((pixelColor) & 0x1F);       //First 5 Bits
           uint16_t g = (uint8_t)((pixelColor >> 5) & 0x1F);  //Middle 5 Bits
           uint16_t b = (uint8_t)((pixelColor >> 10) & 0x1F);   //Last 5 Bits
@@ -6776,30 +6832,23 @@ void GBA::RenderTextBgBrightDec(int32_t bg)
 {
   uint8_t blendMaskType = (uint8_t)(1 << bg);
 
-  uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)bg, ioRegStart);
+  const PPUBackground &layer = processor->ppu.bg[bg];
 
-  int32_t Width = 0, Height = 0;
-  switch ((bgcnt >> 14) & 0x3)
-  {
-    case 0: Width = 256; Height = 256; break;
-    case 1: Width = 512; Height = 256; break;
-    case 2: Width = 256; Height = 512; break;
-    case 3: Width = 512; Height = 512; break;
-  }
+  int32_t Width = layer.width, Height = layer.height;
 
-  int32_t screenBase = ((bgcnt >> 8) & 0x1F) * 0x800;
-  int32_t charBase = ((bgcnt >> 2) & 0x3) * 0x4000;
+  int32_t screenBase = layer.screenBase;
+  int32_t charBase = layer.charBase;
 
-  int32_t hofs = processor->ReadU16(BG0HOFS + (uint32_t)bg * 4, ioRegStart) & 0x1FF;
-  int32_t vofs = processor->ReadU16(BG0VOFS + (uint32_t)bg * 4, ioRegStart) & 0x1FF;
+  int32_t hofs = layer.hofs;
+  int32_t vofs = layer.vofs;
 
-  if ((bgcnt & (1 << 7)) != 0)
+  if (layer.colors256)
   {
     // 256 color tiles
     int32_t bgy = ((curLine + vofs) & (Height - 1)) / 8;
 
     int32_t tileIdx = screenBase + (((bgy & 31) * 32) * 2);
-    switch ((bgcnt >> 14) & 0x3)
+    switch (layer.size)
     {
       case 2: if (bgy >= 32) tileIdx += 32 * 32 * 2; break;
       case 3: if (bgy >= 32) tileIdx += 32 * 32 * 4; break;
@@ -6807,22 +6856,34 @@ void GBA::RenderTextBgBrightDec(int32_t bg)
 
     int32_t tileY = ((curLine + vofs) & 0x7) * 8;
 
+    //Whole map row for this line, the second screen block follows when the background is 512 wide
+    uint16_t mapRow[64];
+    processor->ReadSpan<Region::VRAM>(tileIdx, (uint8_t *)mapRow, 32 * 2);
+    if (Width == 512) processor->ReadSpan<Region::VRAM>(tileIdx + 32 * 32 * 2, (uint8_t *)&mapRow[32], 32 * 2);
+
+    //Tile row is fetched once per tile rather than once per pixel
+    int32_t lastTileChar = -1;
+    uint8_t tileRow[8];
+
     for (int32_t i = 0; i < 240; i++)
     {
       if (true)
       {
         int32_t bgx = ((i + hofs) & (Width - 1)) / 8;
-        int32_t tmpTileIdx = tileIdx + ((bgx & 31) * 2);
-        if (bgx >= 32) tmpTileIdx += 32 * 32 * 2;
-        int32_t tileChar = processor->ReadU16(tmpTileIdx, vRamStart);
+        int32_t tileChar = mapRow[bgx];
         int32_t x = (i + hofs) & 7;
         int32_t y = tileY;
         if ((tileChar & (1 << 10)) != 0) x = 7 - x;
         if ((tileChar & (1 << 11)) != 0) y = 56 - y;
-        int32_t lookup = processor->ReadU8(charBase + ((tileChar & 0x3FF) * 64) + y + x, vRamStart);
+        if (tileChar != lastTileChar)
+        {
+          processor->ReadSpan<Region::VRAM>(charBase + ((tileChar & 0x3FF) * 64) + y, tileRow, 8);
+          lastTileChar = tileChar;
+        }
+        int32_t lookup = tileRow[x];
         if (lookup != 0)
         {
-          uint16_t pixelColor = processor->ReadU16(lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(lookup * 2);
           uint16_t r = (uint8_t)((pixelColor) & 0x1F);       //First 5 Bits
           uint16_t g = (uint8_t)((pixelColor >> 5) & 0x1F);  //Middle 5 Bits
           uint16_t b = (uint8_t)((pixelColor >> 10) & 0x1F);   //Last 5 Bits
@@ -6842,7 +6903,7 @@ void GBA::RenderTextBgBrightDec(int32_t bg)
     int32_t bgy = ((curLine + vofs) & (Height - 1)) / 8;
 
     int32_t tileIdx = screenBase + (((bgy & 31) * 32) * 2);
-    switch ((bgcnt >> 14) & 0x3)
+    switch (layer.size)
     {
       case 2: if (bgy >= 32) tileIdx += 32 * 32 * 2; break;
       case 3: if (bgy >= 32) tileIdx += 32 * 32 * 4; break;
@@ -6850,19 +6911,31 @@ void GBA::RenderTextBgBrightDec(int32_t bg)
 
     int32_t tileY = ((curLine + vofs) & 0x7) * 4;
 
+    //Whole map row for this line, the second screen block follows when the background is 512 wide
+    uint16_t mapRow[64];
+    processor->ReadSpan<Region::VRAM>(tileIdx, (uint8_t *)mapRow, 32 * 2);
+    if (Width == 512) processor->ReadSpan<Region::VRAM>(tileIdx + 32 * 32 * 2, (uint8_t *)&mapRow[32], 32 * 2);
+
+    //Tile row is fetched once per tile rather than once per pixel
+    int32_t lastTileChar = -1;
+    uint8_t tileRow[4];
+
     for (int32_t i = 0; i < 240; i++)
     {
       if (true)
       {
         int32_t bgx = ((i + hofs) & (Width - 1)) / 8;
-        int32_t tmpTileIdx = tileIdx + ((bgx & 31) * 2);
-        if (bgx >= 32) tmpTileIdx += 32 * 32 * 2;
-        int32_t tileChar = processor->ReadU16(tmpTileIdx, vRamStart);
+        int32_t tileChar = mapRow[bgx];
         int32_t x = (i + hofs) & 7;
         int32_t y = tileY;
         if ((tileChar & (1 << 10)) != 0) x = 7 - x;
         if ((tileChar & (1 << 11)) != 0) y = 28 - y;
-        int32_t lookup = processor->ReadU8(charBase + ((tileChar & 0x3FF) * 32) + y + (x / 2), vRamStart);
+        if (tileChar != lastTileChar)
+        {
+          processor->ReadSpan<Region::VRAM>(charBase + ((tileChar & 0x3FF) * 32) + y, tileRow, 4);
+          lastTileChar = tileChar;
+        }
+        int32_t lookup = tileRow[x / 2];
         if ((x & 1) == 0)
         {
           lookup &= 0xf;
@@ -6874,7 +6947,7 @@ void GBA::RenderTextBgBrightDec(int32_t bg)
         if (lookup != 0)
         {
           int32_t palNum = ((tileChar >> 12) & 0xf) * 16 * 2;
-          uint16_t pixelColor = processor->ReadU16(palNum + lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palNum + lookup * 2);
           uint16_t r = (uint8_t)((pixelColor) & 0x1F);       //First 5 Bits
           uint16_t g = (uint8_t)((pixelColor >> 5) & 0x1F);  //Middle 5 Bits
           uint16_t b = (uint8_t)((pixelColor >> 10) & 0x1F);   //Last 5 Bits
@@ -6894,30 +6967,23 @@ void GBA::RenderTextBgWindow(int32_t bg)
 {
   uint8_t blendMaskType = (uint8_t)(1 << bg);
 
-  uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)bg, ioRegStart); //Read BG0CNT 0x0 from IOReg
+  const PPUBackground &layer = processor->ppu.bg[bg];
 
-  int32_t Width = 0, Height = 0;
-  switch ((bgcnt >> 14) & 0x3)
-  {
-  case 0: Width = 256; Height = 256; break;
-  case 1: Width = 512; Height = 256; break;
-  case 2: Width = 256; Height = 512; break;
-  case 3: Width = 512; Height = 512; break;
-  }
+  int32_t Width = layer.width, Height = layer.height;
 
-  int32_t screenBase = ((bgcnt >> 8) & 0x1F) * 0x800;
-  int32_t charBase = ((bgcnt >> 2) & 0x3) * 0x4000;
+  int32_t screenBase = layer.screenBase;
+  int32_t charBase = layer.charBase;
 
-  int32_t hofs = processor->ReadU16(BG0HOFS + (uint32_t)bg * 4, ioRegStart) & 0x1FF;
-  int32_t vofs = processor->ReadU16(BG0VOFS + (uint32_t)bg * 4, ioRegStart) & 0x1FF;
+  int32_t hofs = layer.hofs;
+  int32_t vofs = layer.vofs;
 
-  if ((bgcnt & (1 << 7)) != 0)
+  if (layer.colors256)
   {
     // 256 color tiles
     int32_t bgy = ((curLine + vofs) & (Height - 1)) / 8;
 
     int32_t tileIdx = screenBase + (((bgy & 31) * 32) * 2);
-    switch ((bgcnt >> 14) & 0x3)
+    switch (layer.size)
     {
     case 2: if (bgy >= 32) tileIdx += 32 * 32 * 2; break;
     case 3: if (bgy >= 32) tileIdx += 32 * 32 * 4; break;
@@ -6925,22 +6991,34 @@ void GBA::RenderTextBgWindow(int32_t bg)
 
     int32_t tileY = ((curLine + vofs) & 0x7) * 8;
 
+    //Whole map row for this line, the second screen block follows when the background is 512 wide
+    uint16_t mapRow[64];
+    processor->ReadSpan<Region::VRAM>(tileIdx, (uint8_t *)mapRow, 32 * 2);
+    if (Width == 512) processor->ReadSpan<Region::VRAM>(tileIdx + 32 * 32 * 2, (uint8_t *)&mapRow[32], 32 * 2);
+
+    //Tile row is fetched once per tile rather than once per pixel
+    int32_t lastTileChar = -1;
+    uint8_t tileRow[8];
+
     for (int32_t i = 0; i < 240; i++)
     {
       if ((windowCover[i] & (1 << bg)) != 0)
       {
         int32_t bgx = ((i + hofs) & (Width - 1)) / 8;
-        int32_t tmpTileIdx = tileIdx + ((bgx & 31) * 2);
-        if (bgx >= 32) tmpTileIdx += 32 * 32 * 2;
-        int32_t tileChar = processor->ReadU16(tmpTileIdx, vRamStart);
+        int32_t tileChar = mapRow[bgx];
         int32_t x = (i + hofs) & 7;
         int32_t y = tileY;
         if ((tileChar & (1 << 10)) != 0) x = 7 - x;
         if ((tileChar & (1 << 11)) != 0) y = 56 - y;
-        int32_t lookup = processor->ReadU8(charBase + ((tileChar & 0x3FF) * 64) + y + x, vRamStart);
+        if (tileChar != lastTileChar)
+        {
+          processor->ReadSpan<Region::VRAM>(charBase + ((tileChar & 0x3FF) * 64) + y, tileRow, 8);
+          lastTileChar = tileChar;
+        }
+        int32_t lookup = tileRow[x];
         if (lookup != 0)
         {
-          uint16_t pixelColor = GBAToColor(processor->ReadU16(lookup * 2, palRamStart));
+          uint16_t pixelColor = GBAToColor(processor->Read<Region::PAL, uint16_t>(lookup * 2));
           DrawPixel(curLine, i, pixelColor);
           Blend[i] = blendMaskType;
         }
@@ -6953,7 +7031,7 @@ void GBA::RenderTextBgWindow(int32_t bg)
     int32_t bgy = ((curLine + vofs) & (Height - 1)) / 8;
 
     int32_t tileIdx = screenBase + (((bgy & 31) * 32) * 2);
-    switch ((bgcnt >> 14) & 0x3)
+    switch (layer.size)
     {
       case 2: if (bgy >= 32) tileIdx += 32 * 32 * 2; break;
       case 3: if (bgy >= 32) tileIdx += 32 * 32 * 4; break;
@@ -6961,19 +7039,31 @@ void GBA::RenderTextBgWindow(int32_t bg)
 
     int32_t tileY = ((curLine + vofs) & 0x7) * 4;
 
+    //Whole map row for this line, the second screen block follows when the background is 512 wide
+    uint16_t mapRow[64];
+    processor->ReadSpan<Region::VRAM>(tileIdx, (uint8_t *)mapRow, 32 * 2);
+    if (Width == 512) processor->ReadSpan<Region::VRAM>(tileIdx + 32 * 32 * 2, (uint8_t *)&mapRow[32], 32 * 2);
+
+    //Tile row is fetched once per tile rather than once per pixel
+    int32_t lastTileChar = -1;
+    uint8_t tileRow[4];
+
     for (int32_t i = 0; i < 240; i++)
     {
       if ((windowCover[i] & (1 << bg)) != 0)
       {
         int32_t bgx = ((i + hofs) & (Width - 1)) / 8;
-        int32_t tmpTileIdx = tileIdx + ((bgx & 31) * 2);
-        if (bgx >= 32) tmpTileIdx += 32 * 32 * 2;
-        int32_t tileChar = processor->ReadU16(tmpTileIdx, vRamStart);
+        int32_t tileChar = mapRow[bgx];
         int32_t x = (i + hofs) & 7;
         int32_t y = tileY;
         if ((tileChar & (1 << 10)) != 0) x = 7 - x;
         if ((tileChar & (1 << 11)) != 0) y = 28 - y;
-        int32_t lookup = processor->ReadU8(charBase + ((tileChar & 0x3FF) * 32) + y + (x / 2), vRamStart);
+        if (tileChar != lastTileChar)
+        {
+          processor->ReadSpan<Region::VRAM>(charBase + ((tileChar & 0x3FF) * 32) + y, tileRow, 4);
+          lastTileChar = tileChar;
+        }
+        int32_t lookup = tileRow[x / 2];
         if ((x & 1) == 0)
         {
           lookup &= 0xf;
@@ -6985,7 +7075,7 @@ void GBA::RenderTextBgWindow(int32_t bg)
         if (lookup != 0)
         {
           int32_t palNum = ((tileChar >> 12) & 0xf) * 16 * 2;
-          uint16_t pixelColor = GBAToColor(processor->ReadU16(palNum + lookup * 2, palRamStart));
+          uint16_t pixelColor = GBAToColor(processor->Read<Region::PAL, uint16_t>(palNum + lookup * 2));
           DrawPixel(curLine, i, pixelColor);
           Blend[i] = blendMaskType;
         }
@@ -6998,30 +7088,23 @@ void GBA::RenderTextBgWindowBlend(int32_t bg)
 {
   uint8_t blendMaskType = (uint8_t)(1 << bg);
 
-  uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)bg, ioRegStart);
+  const PPUBackground &layer = processor->ppu.bg[bg];
 
-  int32_t Width = 0, Height = 0;
-  switch ((bgcnt >> 14) & 0x3)
-  {
-  case 0: Width = 256; Height = 256; break;
-  case 1: Width = 512; Height = 256; break;
-  case 2: Width = 256; Height = 512; break;
-  case 3: Width = 512; Height = 512; break;
-  }
+  int32_t Width = layer.width, Height = layer.height;
 
-  int32_t screenBase = ((bgcnt >> 8) & 0x1F) * 0x800;
-  int32_t charBase = ((bgcnt >> 2) & 0x3) * 0x4000;
+  int32_t screenBase = layer.screenBase;
+  int32_t charBase = layer.charBase;
 
-  int32_t hofs = processor->ReadU16(BG0HOFS + (uint32_t)bg * 4, ioRegStart) & 0x1FF;
-  int32_t vofs = processor->ReadU16(BG0VOFS + (uint32_t)bg * 4, ioRegStart) & 0x1FF;
+  int32_t hofs = layer.hofs;
+  int32_t vofs = layer.vofs;
 
-  if ((bgcnt & (1 << 7)) != 0)
+  if (layer.colors256)
   {
     // 256 color tiles
     int32_t bgy = ((curLine + vofs) & (Height - 1)) / 8;
 
     int32_t tileIdx = screenBase + (((bgy & 31) * 32) * 2);
-    switch ((bgcnt >> 14) & 0x3)
+    switch (layer.size)
     {
     case 2: if (bgy >= 32) tileIdx += 32 * 32 * 2; break;
     case 3: if (bgy >= 32) tileIdx += 32 * 32 * 4; break;
@@ -7029,22 +7112,34 @@ void GBA::RenderTextBgWindowBlend(int32_t bg)
 
     int32_t tileY = ((curLine + vofs) & 0x7) * 8;
 
+    //Whole map row for this line, the second screen block follows when the background is 512 wide
+    uint16_t mapRow[64];
+    processor->ReadSpan<Region::VRAM>(tileIdx, (uint8_t *)mapRow, 32 * 2);
+    if (Width == 512) processor->ReadSpan<Region::VRAM>(tileIdx + 32 * 32 * 2, (uint8_t *)&mapRow[32], 32 * 2);
+
+    //Tile row is fetched once per tile rather than once per pixel
+    int32_t lastTileChar = -1;
+    uint8_t tileRow[8];
+
     for (int32_t i = 0; i < 240; i++)
     {
       if ((windowCover[i] & (1 << bg)) != 0)
       {
         int32_t bgx = ((i + hofs) & (Width - 1)) / 8;
-        int32_t tmpTileIdx = tileIdx + ((bgx & 31) * 2);
-        if (bgx >= 32) tmpTileIdx += 32 * 32 * 2;
-        int32_t tileChar = processor->ReadU16(tmpTileIdx, vRamStart);
+        int32_t tileChar = mapRow[bgx];
         int32_t x = (i + hofs) & 7;
         int32_t y = tileY;
         if ((tileChar & (1 << 10)) != 0) x = 7 - x;
         if ((tileChar & (1 << 11)) != 0) y = 56 - y;
-        int32_t lookup = processor->ReadU8(charBase + ((tileChar & 0x3FF) * 64) + y + x, vRamStart);
+        if (tileChar != lastTileChar)
+        {
+          processor->ReadSpan<Region::VRAM>(charBase + ((tileChar & 0x3FF) * 64) + y, tileRow, 8);
+          lastTileChar = tileChar;
+        }
+        int32_t lookup = tileRow[x];
         if (lookup != 0)
         {
-          uint16_t pixelColor = processor->ReadU16(lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(lookup * 2);
           
           if ((windowCover[i] & (1 << 5)) != 0)
           {
@@ -7084,7 +7179,7 @@ void GBA::RenderTextBgWindowBlend(int32_t bg)
     int32_t bgy = ((curLine + vofs) & (Height - 1)) / 8;
 
     int32_t tileIdx = screenBase + (((bgy & 31) * 32) * 2);
-    switch ((bgcnt >> 14) & 0x3)
+    switch (layer.size)
     {
       case 2: if (bgy >= 32) tileIdx += 32 * 32 * 2; break;
       case 3: if (bgy >= 32) tileIdx += 32 * 32 * 4; break;
@@ -7092,19 +7187,31 @@ void GBA::RenderTextBgWindowBlend(int32_t bg)
 
     int32_t tileY = ((curLine + vofs) & 0x7) * 4;
 
+    //Whole map row for this line, the second screen block follows when the background is 512 wide
+    uint16_t mapRow[64];
+    processor->ReadSpan<Region::VRAM>(tileIdx, (uint8_t *)mapRow, 32 * 2);
+    if (Width == 512) processor->ReadSpan<Region::VRAM>(tileIdx + 32 * 32 * 2, (uint8_t *)&mapRow[32], 32 * 2);
+
+    //Tile row is fetched once per tile rather than once per pixel
+    int32_t lastTileChar = -1;
+    uint8_t tileRow[4];
+
     for (int32_t i = 0; i < 240; i++)
     {
       if ((windowCover[i] & (1 << bg)) != 0)
       {
         int32_t bgx = ((i + hofs) & (Width - 1)) / 8;
-        int32_t tmpTileIdx = tileIdx + ((bgx & 31) * 2);
-        if (bgx >= 32) tmpTileIdx += 32 * 32 * 2;
-        int32_t tileChar = processor->ReadU16(tmpTileIdx, vRamStart);
+        int32_t tileChar = mapRow[bgx];
         int32_t x = (i + hofs) & 7;
         int32_t y = tileY;
         if ((tileChar & (1 << 10)) != 0) x = 7 - x;
         if ((tileChar & (1 << 11)) != 0) y = 28 - y;
-        int32_t lookup = processor->ReadU8(charBase + ((tileChar & 0x3FF) * 32) + y + (x / 2), vRamStart);
+        if (tileChar != lastTileChar)
+        {
+          processor->ReadSpan<Region::VRAM>(charBase + ((tileChar & 0x3FF) * 32) + y, tileRow, 4);
+          lastTileChar = tileChar;
+        }
+        int32_t lookup = tileRow[x / 2];
         if ((x & 1) == 0)
         {
           lookup &= 0xf;
@@ -7116,7 +7223,7 @@ void GBA::RenderTextBgWindowBlend(int32_t bg)
         if (lookup != 0)
         {
           int32_t palNum = ((tileChar >> 12) & 0xf) * 16 * 2;
-          uint16_t pixelColor = processor->ReadU16(palNum + lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palNum + lookup * 2);
           
           if ((windowCover[i] & (1 << 5)) != 0)
           {
@@ -7156,30 +7263,23 @@ void GBA::RenderTextBgWindowBrightInc(int32_t bg)
 {
   uint8_t blendMaskType = (uint8_t)(1 << bg);
 
-  uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)bg, ioRegStart);
+  const PPUBackground &layer = processor->ppu.bg[bg];
 
-  int32_t Width = 0, Height = 0;
-  switch ((bgcnt >> 14) & 0x3)
-  {
-    case 0: Width = 256; Height = 256; break;
-    case 1: Width = 512; Height = 256; break;
-    case 2: Width = 256; Height = 512; break;
-    case 3: Width = 512; Height = 512; break;
-  }
+  int32_t Width = layer.width, Height = layer.height;
 
-  int32_t screenBase = ((bgcnt >> 8) & 0x1F) * 0x800;
-  int32_t charBase = ((bgcnt >> 2) & 0x3) * 0x4000;
+  int32_t screenBase = layer.screenBase;
+  int32_t charBase = layer.charBase;
 
-  int32_t hofs = processor->ReadU16(BG0HOFS + (uint32_t)bg * 4, ioRegStart) & 0x1FF;
-  int32_t vofs = processor->ReadU16(BG0VOFS + (uint32_t)bg * 4, ioRegStart) & 0x1FF;
+  int32_t hofs = layer.hofs;
+  int32_t vofs = layer.vofs;
 
-  if ((bgcnt & (1 << 7)) != 0)
+  if (layer.colors256)
   {
     // 256 color tiles
     uint32_t bgy = ((curLine + vofs) & (Height - 1)) / 8;
 
     uint32_t tileIdx = screenBase + (((bgy & 31) * 32) * 2);
-    switch ((bgcnt >> 14) & 0x3)
+    switch (layer.size)
     {
     case 2: if (bgy >= 32) tileIdx += 32 * 32 * 2; break;
     case 3: if (bgy >= 32) tileIdx += 32 * 32 * 4; break;
@@ -7187,23 +7287,35 @@ void GBA::RenderTextBgWindowBrightInc(int32_t bg)
 
     int32_t tileY = ((curLine + vofs) & 0x7) * 8;
 
+    //Whole map row for this line, the second screen block follows when the background is 512 wide
+    uint16_t mapRow[64];
+    processor->ReadSpan<Region::VRAM>(tileIdx, (uint8_t *)mapRow, 32 * 2);
+    if (Width == 512) processor->ReadSpan<Region::VRAM>(tileIdx + 32 * 32 * 2, (uint8_t *)&mapRow[32], 32 * 2);
+
+    //Tile row is fetched once per tile rather than once per pixel
+    int32_t lastTileChar = -1;
+    uint8_t tileRow[8];
+
     for (int32_t i = 0; i < 240; i++)
     {
       if ((windowCover[i] & (1 << bg)) != 0)
       {
         int32_t bgx = ((i + hofs) & (Width - 1)) / 8;
-        int32_t tmpTileIdx = tileIdx + ((bgx & 31) * 2);
-        if (bgx >= 32) tmpTileIdx += 32 * 32 * 2;
-        int32_t tileChar = processor->ReadU16(tmpTileIdx, vRamStart);
+        int32_t tileChar = mapRow[bgx];
         int32_t x = (i + hofs) & 7;
         int32_t y = tileY;
         if ((tileChar & (1 << 10)) != 0) x = 7 - x;
         if ((tileChar & (1 << 11)) != 0) y = 56 - y;
-        int32_t lookup = processor->ReadU8(charBase + ((tileChar & 0x3FF) * 64) + y + x, vRamStart);
+        if (tileChar != lastTileChar)
+        {
+          processor->ReadSpan<Region::VRAM>(charBase + ((tileChar & 0x3FF) * 64) + y, tileRow, 8);
+          lastTileChar = tileChar;
+        }
+        int32_t lookup = tileRow[x];
         
         if (lookup != 0)
         {
-          uint16_t pixelColor = processor->ReadU16(lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(lookup * 2);
           
           if ((windowCover[i] & (1 << 5)) != 0)
           {
@@ -7232,7 +7344,7 @@ void GBA::RenderTextBgWindowBrightInc(int32_t bg)
     int32_t bgy = ((curLine + vofs) & (Height - 1)) / 8;
 
     int32_t tileIdx = screenBase + (((bgy & 31) * 32) * 2);
-    switch ((bgcnt >> 14) & 0x3)
+    switch (layer.size)
     {
       case 2: if (bgy >= 32) tileIdx += 32 * 32 * 2; break;
       case 3: if (bgy >= 32) tileIdx += 32 * 32 * 4; break;
@@ -7240,19 +7352,31 @@ void GBA::RenderTextBgWindowBrightInc(int32_t bg)
 
     int32_t tileY = ((curLine + vofs) & 0x7) * 4;
 
+    //Whole map row for this line, the second screen block follows when the background is 512 wide
+    uint16_t mapRow[64];
+    processor->ReadSpan<Region::VRAM>(tileIdx, (uint8_t *)mapRow, 32 * 2);
+    if (Width == 512) processor->ReadSpan<Region::VRAM>(tileIdx + 32 * 32 * 2, (uint8_t *)&mapRow[32], 32 * 2);
+
+    //Tile row is fetched once per tile rather than once per pixel
+    int32_t lastTileChar = -1;
+    uint8_t tileRow[4];
+
     for (int32_t i = 0; i < 240; i++)
     {
       if ((windowCover[i] & (1 << bg)) != 0)
       {
         int32_t bgx = ((i + hofs) & (Width - 1)) / 8;
-        int32_t tmpTileIdx = tileIdx + ((bgx & 31) * 2);
-        if (bgx >= 32) tmpTileIdx += 32 * 32 * 2;
-        int32_t tileChar = processor->ReadU16(tmpTileIdx, vRamStart);
+        int32_t tileChar = mapRow[bgx];
         int32_t x = (i + hofs) & 7;
         int32_t y = tileY;
         if ((tileChar & (1 << 10)) != 0) x = 7 - x;
         if ((tileChar & (1 << 11)) != 0) y = 28 - y;
-        int32_t lookup = processor->ReadU8(charBase + ((tileChar & 0x3FF) * 32) + y + (x / 2), vRamStart);
+        if (tileChar != lastTileChar)
+        {
+          processor->ReadSpan<Region::VRAM>(charBase + ((tileChar & 0x3FF) * 32) + y, tileRow, 4);
+          lastTileChar = tileChar;
+        }
+        int32_t lookup = tileRow[x / 2];
         if ((x & 1) == 0)
         {
           lookup &= 0xf;
@@ -7264,7 +7388,7 @@ void GBA::RenderTextBgWindowBrightInc(int32_t bg)
         if (lookup != 0)
         {
           int32_t palNum = ((tileChar >> 12) & 0xf) * 16 * 2;
-          uint16_t pixelColor = processor->ReadU16(palNum + lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palNum + lookup * 2);
           
           if ((windowCover[i] & (1 << 5)) != 0)
           {
@@ -7293,30 +7417,23 @@ void GBA::RenderTextBgWindowBrightDec(int32_t bg)
 {
   uint8_t blendMaskType = (uint8_t)(1 << bg);
 
-  uint16_t bgcnt = processor->ReadU16(BG0CNT + 0x2 * (uint32_t)bg, ioRegStart);
+  const PPUBackground &layer = processor->ppu.bg[bg];
 
-  int32_t Width = 0, Height = 0;
-  switch ((bgcnt >> 14) & 0x3)
-  {
-    case 0: Width = 256; Height = 256; break;
-    case 1: Width = 512; Height = 256; break;
-    case 2: Width = 256; Height = 512; break;
-    case 3: Width = 512; Height = 512; break;
-  }
+  int32_t Width = layer.width, Height = layer.height;
 
-  int32_t screenBase = ((bgcnt >> 8) & 0x1F) * 0x800;
-  int32_t charBase = ((bgcnt >> 2) & 0x3) * 0x4000;
+  int32_t screenBase = layer.screenBase;
+  int32_t charBase = layer.charBase;
 
-  int32_t hofs = processor->ReadU16(BG0HOFS + (uint32_t)bg * 4, ioRegStart) & 0x1FF;
-  int32_t vofs = processor->ReadU16(BG0VOFS + (uint32_t)bg * 4, ioRegStart) & 0x1FF;
+  int32_t hofs = layer.hofs;
+  int32_t vofs = layer.vofs;
 
-  if ((bgcnt & (1 << 7)) != 0)
+  if (layer.colors256)
   {
     // 256 color tiles
     int32_t bgy = ((curLine + vofs) & (Height - 1)) / 8;
 
     int32_t tileIdx = screenBase + (((bgy & 31) * 32) * 2);
-    switch ((bgcnt >> 14) & 0x3)
+    switch (layer.size)
     {
       case 2: if (bgy >= 32) tileIdx += 32 * 32 * 2; break;
       case 3: if (bgy >= 32) tileIdx += 32 * 32 * 4; break;
@@ -7324,22 +7441,34 @@ void GBA::RenderTextBgWindowBrightDec(int32_t bg)
 
     int32_t tileY = ((curLine + vofs) & 0x7) * 8;
 
+    //Whole map row for this line, the second screen block follows when the background is 512 wide
+    uint16_t mapRow[64];
+    processor->ReadSpan<Region::VRAM>(tileIdx, (uint8_t *)mapRow, 32 * 2);
+    if (Width == 512) processor->ReadSpan<Region::VRAM>(tileIdx + 32 * 32 * 2, (uint8_t *)&mapRow[32], 32 * 2);
+
+    //Tile row is fetched once per tile rather than once per pixel
+    int32_t lastTileChar = -1;
+    uint8_t tileRow[8];
+
     for (int32_t i = 0; i < 240; i++)
     {
       if ((windowCover[i] & (1 << bg)) != 0)
       {
         int32_t bgx = ((i + hofs) & (Width - 1)) / 8;
-        int32_t tmpTileIdx = tileIdx + ((bgx & 31) * 2);
-        if (bgx >= 32) tmpTileIdx += 32 * 32 * 2;
-        int32_t tileChar = processor->ReadU16(tmpTileIdx, vRamStart);
+        int32_t tileChar = mapRow[bgx];
         int32_t x = (i + hofs) & 7;
         int32_t y = tileY;
         if ((tileChar & (1 << 10)) != 0) x = 7 - x;
         if ((tileChar & (1 << 11)) != 0) y = 56 - y;
-        int32_t lookup = processor->ReadU8(charBase + ((tileChar & 0x3FF) * 64) + y + x, vRamStart);
+        if (tileChar != lastTileChar)
+        {
+          processor->ReadSpan<Region::VRAM>(charBase + ((tileChar & 0x3FF) * 64) + y, tileRow, 8);
+          lastTileChar = tileChar;
+        }
+        int32_t lookup = tileRow[x];
         if (lookup != 0)
         {
-          uint16_t pixelColor = processor->ReadU16(lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(lookup * 2);
           
           if ((windowCover[i] & (1 << 5)) != 0)
           {
@@ -7368,7 +7497,7 @@ void GBA::RenderTextBgWindowBrightDec(int32_t bg)
     uint32_t bgy = ((curLine + vofs) & (Height - 1)) / 8;
 
     int32_t tileIdx = screenBase + (((bgy & 31) * 32) * 2);
-    switch ((bgcnt >> 14) & 0x3)
+    switch (layer.size)
     {
       case 2: if (bgy >= 32) tileIdx += 32 * 32 * 2; break;
       case 3: if (bgy >= 32) tileIdx += 32 * 32 * 4; break;
@@ -7376,19 +7505,31 @@ void GBA::RenderTextBgWindowBrightDec(int32_t bg)
 
     int32_t tileY = ((curLine + vofs) & 0x7) * 4;
 
+    //Whole map row for this line, the second screen block follows when the background is 512 wide
+    uint16_t mapRow[64];
+    processor->ReadSpan<Region::VRAM>(tileIdx, (uint8_t *)mapRow, 32 * 2);
+    if (Width == 512) processor->ReadSpan<Region::VRAM>(tileIdx + 32 * 32 * 2, (uint8_t *)&mapRow[32], 32 * 2);
+
+    //Tile row is fetched once per tile rather than once per pixel
+    int32_t lastTileChar = -1;
+    uint8_t tileRow[4];
+
     for (int32_t i = 0; i < 240; i++)
     {
       if ((windowCover[i] & (1 << bg)) != 0)
       {
         int32_t bgx = ((i + hofs) & (Width - 1)) / 8;
-        int32_t tmpTileIdx = tileIdx + ((bgx & 31) * 2);
-        if (bgx >= 32) tmpTileIdx += 32 * 32 * 2;
-        int32_t tileChar = processor->ReadU16(tmpTileIdx, vRamStart);
+        int32_t tileChar = mapRow[bgx];
         int32_t x = (i + hofs) & 7;
         int32_t y = tileY;
         if ((tileChar & (1 << 10)) != 0) x = 7 - x;
         if ((tileChar & (1 << 11)) != 0) y = 28 - y;
-        int32_t lookup = processor->ReadU8(charBase + ((tileChar & 0x3FF) * 32) + y + (x / 2), vRamStart);
+        if (tileChar != lastTileChar)
+        {
+          processor->ReadSpan<Region::VRAM>(charBase + ((tileChar & 0x3FF) * 32) + y, tileRow, 4);
+          lastTileChar = tileChar;
+        }
+        int32_t lookup = tileRow[x / 2];
         if ((x & 1) == 0)
         {
           lookup &= 0xf;
@@ -7400,7 +7541,7 @@ void GBA::RenderTextBgWindowBrightDec(int32_t bg)
         if (lookup != 0)
         {
           int32_t palNum = ((tileChar >> 12) & 0xf) * 16 * 2;
-          uint16_t pixelColor = processor->ReadU16(palNum + lookup * 2, palRamStart);
+          uint16_t pixelColor = processor->Read<Region::PAL, uint16_t>(palNum + lookup * 2);
           
           if ((windowCover[i] & (1 << 5)) != 0)
           {
@@ -27,6 +27,10 @@
 #include "GBA_ThumbCore.h"
 #include "Bios.h"
 #include "GBA_SoundManager.h"
+#include "GBA_SRAMCache.h"
+#include "GBA_ROMCache.h"
+#include "GBA_BiosHle.h"
+#include "GBA_Placement.h"
 #include <SD.h>
 #include <SD_t3.h>
 
@@ -37,8 +41,6 @@ uint32_t timerCnt[4];
 
 uint32_t romBank1Mask = 0;
 uint32_t romBank2Mask = 0;
-uint32_t bankSTimes[0x10];
-uint32_t bankNTimes[0x10];
 uint8_t RomBankCount = 0;
 
 //-------------------------VGA--------------------------//
@@ -107,6 +109,175 @@ uint32_t spsrUND = 0;
 ArmCore armCore;
 ThumbCore thumbCore;
 SoundManager sound;
+SRAMCache sramCache;
+ROMCache romCache;
+uint8_t AccessMode = 2;
+uint32_t SRAMTurnarounds = 0;
+
+//GPIO lookup tables for the SRAM bus, generated from the pin map in GBA_Arm7.h
+constexpr SRAMByteTable SRAMAddressTable[3] =
+{
+  MakeSRAMByteTable(SRAMAddressPins, 0, 8),
+  MakeSRAMByteTable(SRAMAddressPins, 8, 8),
+  MakeSRAMByteTable(SRAMAddressPins, 16, 3)
+};
+constexpr SRAMByteTable SRAMDataTable = MakeSRAMByteTable(SRAMDataPins, 0, 8);
+
+//Port bits the hand written SetAddress/SetData used to set for value, kept to check the tables against
+constexpr uint32_t OldSRAMAddressBits(uint32_t value, uint8_t port)
+{
+  return port == SRAM_PORT_B ? ((value & 0x03) << 16) | (((value >> 4) & 0x03) << 10) | (((value >> 10) & 0x03) << 22) | (((value >> 15) & 0x03) << 4) | (((value >> 9) & 0x01) << 20) | (((value >> 12) & 0x01) << 21) :
+         port == SRAM_PORT_A ? (((value >> 6) & 0x03) << 28) | (((value >> 3) & 0x01) << 5) | (((value >> 8) & 0x01) << 26) :
+         port == SRAM_PORT_D ? (((value >> 13) & 0x03) << 8) | (((value >> 17) & 0x01) << 14) | (((value >> 18) & 0x01) << 13) :
+         port == SRAM_PORT_E ? (((value >> 2) & 0x01) << 26) : 0;
+}
+
+constexpr uint32_t OldSRAMDataBits(uint32_t value, uint8_t port)
+{
+  return port == SRAM_PORT_D ? (value & 0x01) | (((value >> 3) & 0x01) << 7) | (((value >> 4) & 0x01) << 4) | (((value >> 5) & 0x03) << 2) :
+         port == SRAM_PORT_A ? (((value >> 1) & 0x03) << 12) :
+         port == SRAM_PORT_C ? (((value >> 7) & 0x01) << 3) : 0;
+}
+
+//Every byte value of every table against the old code. The bus value is the OR of its three
+//byte lookups and the old code set each line on its own, so this covers all 2^19 addresses.
+constexpr bool CheckSRAMTables()
+{
+  for(uint8_t port = 0; port < SRAM_PORT_COUNT; port++)
+  {
+    if(SRAM_ADDRESS_MASK(port) != OldSRAMAddressBits(0x7FFFF, port) || SRAM_DATA_MASK(port) != OldSRAMDataBits(0xFF, port))
+    {
+      return false;
+    }
+
+    for(uint32_t value = 0; value < 256; value++)
+    {
+      for(uint32_t byte = 0; byte < 3; byte++)
+      {
+        if(SRAMAddressTable[byte].set[value][port] != OldSRAMAddressBits((value << (byte * 8)) & 0x7FFFF, port))
+        {
+          return false;
+        }
+      }
+
+      if(SRAMDataTable.set[value][port] != OldSRAMDataBits(value, port))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static_assert(CheckSRAMTables(), "SRAM pin map doesn't match the ADDn/DIOn wiring");
+
+//IO register descriptors, anything not listed is plain read/write storage
+constexpr void SetIORegister(IORegisterTable &table, uint32_t address, uint16_t readMask, uint16_t writeMask, uint8_t read, uint8_t write, uint8_t param, uint8_t width)
+{
+  IORegister &reg = table.regs[address >> 1];
+  reg.readMask = readMask;
+  reg.writeMask = writeMask;
+  reg.read = read;
+  reg.write = write;
+  reg.param = param;
+  reg.width = width;
+}
+
+constexpr IORegisterTable MakeIORegisterTable()
+{
+  IORegisterTable table = {};
+
+  for(uint32_t address = 0; address < (ioRegMask + 1); address += 2)
+  {
+    SetIORegister(table, address, 0xFFFF, 0xFFFF, IO_READ_PLAIN, IO_WRITE_PLAIN, 0, 16);
+  }
+
+  SetIORegister(table, DISPSTAT, 0xFFFF, 0xFF38, IO_READ_PLAIN, IO_WRITE_PLAIN, 0, 16);
+  SetIORegister(table, VCOUNT, 0xFFFF, 0x0000, IO_READ_PLAIN, IO_WRITE_PLAIN, 0, 16);
+
+  //Scroll, rotation/scaling, window, mosaic and BLDY registers are write only
+  for(uint32_t address = BG0HOFS; address <= BG3Y_H; address += 2)
+  {
+    SetIORegister(table, address, 0x0000, 0xFFFF, IO_READ_PLAIN, IO_WRITE_PLAIN, 0, 16);
+  }
+  for(uint32_t address = WIN0H; address <= WIN1V; address += 2)
+  {
+    SetIORegister(table, address, 0x0000, 0xFFFF, IO_READ_PLAIN, IO_WRITE_PLAIN, 0, 16);
+  }
+  SetIORegister(table, MOSAIC, 0x0000, 0xFFFF, IO_READ_PLAIN, IO_WRITE_PLAIN, 0, 16);
+  SetIORegister(table, BLDY, 0x0000, 0xFFFF, IO_READ_PLAIN, IO_WRITE_PLAIN, 0, 16);
+
+  const uint32_t refPoints[4] = { BG2X_L, BG2Y_L, BG3X_L, BG3Y_L };
+  for(uint8_t i = 0; i < 4; i++)
+  {
+    SetIORegister(table, refPoints[i], 0x0000, 0xFFFF, IO_READ_PLAIN, IO_WRITE_REFPOINT, i, 32);
+    SetIORegister(table, refPoints[i] + 2, 0x0000, 0xFFFF, IO_READ_PLAIN, IO_WRITE_REFPOINT, i, 32);
+  }
+
+  //Renderer state, decoded on write by DecodePPURegister
+  for(uint32_t address = DISPCNT; address <= BLDY; address += 2)
+  {
+    if(address == DISPSTAT || address == VCOUNT || (address >= BG2X_L && address <= BG2Y_H) || (address >= BG3X_L && address <= BG3Y_H))
+    {
+      continue;
+    }
+    table.regs[address >> 1].write = IO_WRITE_PPU;
+  }
+
+  SetIORegister(table, SOUNDCNT_H, 0xFFFF, 0xFFFF, IO_READ_PLAIN, IO_WRITE_SOUNDCNT, 0, 16);
+  SetIORegister(table, FIFO_A_L, 0x0000, 0xFFFF, IO_READ_PLAIN, IO_WRITE_FIFO_A, 0, 32);
+  SetIORegister(table, FIFO_A_H, 0x0000, 0xFFFF, IO_READ_PLAIN, IO_WRITE_FIFO_A, 0, 32);
+  SetIORegister(table, FIFO_B_L, 0x0000, 0xFFFF, IO_READ_PLAIN, IO_WRITE_FIFO_B, 0, 32);
+  SetIORegister(table, FIFO_B_H, 0x0000, 0xFFFF, IO_READ_PLAIN, IO_WRITE_FIFO_B, 0, 32);
+
+  for(uint8_t channel = 0; channel < 4; channel++)
+  {
+    uint32_t base = DMA0SAD + (channel * 12);
+    for(uint32_t address = base; address < base + 10; address += 2)
+    {
+      SetIORegister(table, address, 0x0000, 0xFFFF, IO_READ_PLAIN, IO_WRITE_PLAIN, 0, 16);
+    }
+    SetIORegister(table, base + 10, 0xFFFF, 0xFFFF, IO_READ_DMA, IO_WRITE_DMA, channel, 16);
+  }
+
+  for(uint8_t timer = 0; timer < 4; timer++)
+  {
+    SetIORegister(table, TM0D + (timer * 4), 0xFFFF, 0xFFFF, IO_READ_TIMER, IO_WRITE_PLAIN, timer, 16);
+    SetIORegister(table, TM0CNT + (timer * 4), 0xFFFF, 0xFFFF, IO_READ_PLAIN, IO_WRITE_TIMER, timer, 16);
+  }
+
+  SetIORegister(table, KEYINPUT, 0xFFFF, 0x0000, IO_READ_KEYS, IO_WRITE_PLAIN, 0, 16);
+  SetIORegister(table, IF, 0xFFFF, 0x0000, IO_READ_PLAIN, IO_WRITE_IF, 0, 16);
+  SetIORegister(table, WAITCNT, 0xFFFF, 0xFFFF, IO_READ_PLAIN, IO_WRITE_WAITCNT, 0, 16);
+  SetIORegister(table, HALTCNT, 0xFFFF, 0xFFFF, IO_READ_PLAIN, IO_WRITE_HALT, 0, 16);
+
+  return table;
+}
+
+constexpr IORegisterTable IORegisters = MakeIORegisterTable();
+
+const IOReadHandler IOReadHandlers[IO_READ_EFFECTS] =
+{
+  NULL,
+  &Processor::ReadIOKeys,
+  &Processor::ReadIODma,
+  &Processor::ReadIOTimer
+};
+
+const IOWriteHandler IOWriteHandlers[IO_WRITE_EFFECTS] =
+{
+  NULL,
+  &Processor::WriteIORefPoint,
+  &Processor::WriteIODma,
+  &Processor::WriteIOTimer,
+  &Processor::WriteIOFifoA,
+  &Processor::WriteIOFifoB,
+  &Processor::WriteIOSoundCnt,
+  &Processor::WriteIOIf,
+  &Processor::WriteIOWaitCnt,
+  &Processor::WriteIOHalt,
+  &Processor::WriteIOPpu
+};
 Processor *SelfReference;
 File *ROM;
 
@@ -170,6 +341,14 @@ Processor::Processor()
   digitalWrite(ADD16, LOW);
   digitalWrite(ADD17, LOW);
   digitalWrite(ADD18, LOW);
+
+  BuildPageTable();
+
+  //Nothing has been drawn yet, so everything starts dirty
+  memset(vRamDirty, 0xFF, sizeof(vRamDirty));
+  memset(palRamDirty, 0xFF, sizeof(palRamDirty));
+  memset(oamRamDirty, 0xFF, sizeof(oamRamDirty));
+  dirtyRegions = DIRTY_VRAM | DIRTY_PAL | DIRTY_OAM;
 }
 
 void Processor::CreateCores(class Processor *par, class File *rom, bool SkipBios)
@@ -180,6 +359,8 @@ void Processor::CreateCores(class Processor *par, class File *rom, bool SkipBios
   armCore = ArmCore(SelfReference);
   thumbCore = ThumbCore(SelfReference);
   sound.StartSM(44100, SelfReference);
+  biosHle.Begin(SelfReference);
+  sramCache.Invalidate();
   LoadCartridge();
   Reset(SkipBios);
 }
@@ -266,10 +447,9 @@ void Processor::SetSPSR(uint32_t value)
   }
 }
 
-void Processor::SwapRegsHelper(uint32_t swapRegs[])
+//Swaps the banked copies of r(15 - swapRegsLength) to r14, the last entry of the bank is r14
+void Processor::SwapRegsHelper(uint32_t swapRegs[], uint8_t swapRegsLength)
 {
-  uint8_t swapRegsLength = (sizeof(swapRegs)/sizeof(uint32_t));
-  
   for(int32_t i = 14; i > (14 - swapRegsLength); i--)
   {
     uint32_t temp = registers[i];
@@ -278,24 +458,26 @@ void Processor::SwapRegsHelper(uint32_t swapRegs[])
   }
 }
 
+#define SWAP_BANK(bank) SwapRegsHelper(bank, sizeof(bank) / sizeof(bank[0]))
+
 void Processor::SwapRegisters(uint32_t bank)
 {
   switch (bank & 0x1F)
   {
     case FIQ:
-      SwapRegsHelper(bankedFIQ);
+      SWAP_BANK(bankedFIQ);
       break;
     case SVC:
-      SwapRegsHelper(bankedSVC);
+      SWAP_BANK(bankedSVC);
       break;
     case ABT:
-      SwapRegsHelper(bankedABT);
+      SWAP_BANK(bankedABT);
       break;
     case IRQ:
-      SwapRegsHelper(bankedIRQ);
+      SWAP_BANK(bankedIRQ);
       break;
     case UND:
-      SwapRegsHelper(bankedUND);
+      SWAP_BANK(bankedUND);
       break;
   }
 }
@@ -340,6 +522,8 @@ void Processor::RequestIrq(uint16_t irq)
   uint16_t iflag = ReadU16(IF, ioRegStart);
   iflag |= (uint16_t)(1 << irq);
   WriteU16(IF, ioRegStart, iflag);
+
+  idleLoop.Wake();
 }
 
 void Processor::FireIrq()
@@ -350,19 +534,90 @@ void Processor::FireIrq()
 
     if ((ie & (iflag)) != 0 && (ime & 1) != 0 && (cpsr & (1 << 7)) == 0)
     {
+#ifdef NATIVE_IRQ
+        EnterIrq();
+#else
         // Off to the irq exception vector
         EnterException(IRQ, 0x18, true, false);
+#endif
     }
 }
 
+//Does what the BIOS IRQ vector does: save r0-r3, r12 and lr on the IRQ stack, then call the
+//handler at 3007FFCh in ARM state with r0 = 4000000h and lr pointing back into the BIOS
+void Processor::EnterIrq()
+{
+  uint32_t oldCpsr = cpsr;
+
+  if((oldCpsr & T_MASK) != 0)
+  {
+    registers[15] += 2U;
+  }
+
+  WriteCpsr((oldCpsr & ~0x3FU) | IRQ | (1 << 7));
+  SetSPSR(oldCpsr);
+  registers[14] = registers[15];
+
+  uint32_t sp = registers[13] - 24;
+  WriteU32(sp, registers[0]);
+  WriteU32(sp + 4, registers[1]);
+  WriteU32(sp + 8, registers[2]);
+  WriteU32(sp + 12, registers[3]);
+  WriteU32(sp + 16, registers[12]);
+  WriteU32(sp + 20, registers[14]);
+  registers[13] = sp;
+
+  registers[0] = REG_BASE;
+  registers[14] = IRQ_RETURN;
+  registers[15] = ReadU32(IRQ_HANDLER) & ~3U;
+  Cycles -= IRQ_ENTRY_CYCLES;
+
+  ReloadQueue();
+}
+
+//The handler returned to IRQ_RETURN, restore what EnterIrq saved and return with SUBS PC, LR, #4
+void Processor::LeaveIrq()
+{
+  uint32_t sp = registers[13];
+  registers[0] = ReadU32(sp);
+  registers[1] = ReadU32(sp + 4);
+  registers[2] = ReadU32(sp + 8);
+  registers[3] = ReadU32(sp + 12);
+  registers[12] = ReadU32(sp + 16);
+  registers[14] = ReadU32(sp + 20);
+  registers[13] = sp + 24;
+
+  registers[15] = registers[14] - 4;
+  Cycles -= IRQ_RETURN_CYCLES;
+
+  if(SPSRExists())
+  {
+    WriteCpsr(GetSPSR());
+  }
+
+  ReloadQueue();
+}
+
 void Processor::Reset(bool skipBios)
 {
   //Default to ARM state
   cpuHalted = false;
+  idleLoop.Wake();
   Cycles = 0;
   timerCycles = 0;
   soundCycles = 0;
 
+  //Nothing banked survives a reset, apart from the stacks the BIOS sets up
+  memset(bankedFIQ, 0, sizeof(bankedFIQ));
+  memset(bankedIRQ, 0, sizeof(bankedIRQ));
+  memset(bankedSVC, 0, sizeof(bankedSVC));
+  memset(bankedABT, 0, sizeof(bankedABT));
+  memset(bankedUND, 0, sizeof(bankedUND));
+  spsrFIQ = 0;
+  spsrIRQ = 0;
+  spsrABT = 0;
+  spsrUND = 0;
+
   bankedSVC[0] = 0x03007FE0;
   bankedIRQ[0] = 0x03007FA0;
 
@@ -374,8 +629,15 @@ void Processor::Reset(bool skipBios)
     registers[i] = 0;
   }
 
+  //Without a BIOS image start the cartridge directly, with the stack the BIOS would have left
+  if(sizeof(BIOS) < biosRamMask + 1)
+  {
+    skipBios = true;
+  }
+
   if(skipBios)
   {
+    registers[13] = 0x03007F00;
     registers[15] = 0x8000000;
   }
   else
@@ -383,6 +645,10 @@ void Processor::Reset(bool skipBios)
     registers[15] = 0;
   }
 
+  DecodePPU();
+  ResetMemoryStats();
+  blockCache.Invalidate();
+  TrackCodeWrites();
   armCore.BeginExecution();
 }
 
@@ -541,6 +807,16 @@ void Processor::Execute(int cycles)
       return;
     }
   }
+
+  //Spinning in an idle loop, nothing it reads changes until it's woken
+  if(idleLoop.idle)
+  {
+    idleLoop.cyclesSkipped += cycles;
+    Cycles = 0;
+    UpdateTimers();
+    UpdateSound();
+    return;
+  }
   
   while (Cycles > 0)
   {
@@ -568,6 +844,7 @@ void Processor::Reset()
   WriteU16(BG2PD, ioRegStart, 0x0100);
   WriteU16(BG3PA, ioRegStart, 0x0100);
   WriteU16(BG3PD, ioRegStart, 0x0100);
+  DecodePPU();
 }
 
 void Processor::HBlankDma()
@@ -641,6 +918,10 @@ void Processor::DmaTransfer(uint8_t channel)
       reload = false;
     }
 
+#ifdef MEMORY_STATS
+    accessSource = ACCESS_DMA;
+#endif
+
     if(wideTransfer)
     {
       srcDirection *= 4;
@@ -664,6 +945,10 @@ void Processor::DmaTransfer(uint8_t channel)
       }
     }
 
+#ifdef MEMORY_STATS
+    accessSource = ACCESS_CPU;
+#endif
+
     //If not a repeating DMA, them disable the DMA
     if((dmaRegs[channel][3] & (1 << 9)) == 0)
     {
@@ -796,9 +1081,17 @@ uint8_t Processor::ReadU8(uint32_t address, uint32_t RAMRange)
   {
     tmp = IOREG[address];
   }
+  else if(RAMRange == iwRamStart)
+  {
+    tmp = IWRAM[address];
+  }
+  else if(RAMRange == palRamStart)
+  {
+    tmp = PALRAM[address];
+  }
   else
   {
-    tmp = SPIRAMRead(RAMRange + address);
+    tmp = sramCache.Read8(RAMRange + address);
   }
 
   return tmp;
@@ -816,9 +1109,17 @@ uint16_t Processor::ReadU16(uint32_t address, uint32_t RAMRange)
   {
     tmp = (uint16_t)(IOREG[address] | (IOREG[address + 1] << 8));
   }
+  else if(RAMRange == iwRamStart)
+  {
+    tmp = (uint16_t)(IWRAM[address] | (IWRAM[address + 1] << 8));
+  }
+  else if(RAMRange == palRamStart)
+  {
+    tmp = (uint16_t)(PALRAM[address] | (PALRAM[address + 1] << 8));
+  }
   else
   {
-    tmp = (uint16_t)(SPIRAMRead(RAMRange + address) | (SPIRAMRead(RAMRange + address + 1) << 8));
+    tmp = sramCache.Read16(RAMRange + address);
   }
   
   return tmp;
@@ -836,9 +1137,17 @@ uint32_t Processor::ReadU32(uint32_t address, uint32_t RAMRange)
   {
     tmp = (uint32_t)(IOREG[address] | (IOREG[address + 1] << 8) | (IOREG[address + 2] << 16) | (IOREG[address + 3] << 24));
   }
+  else if(RAMRange == iwRamStart)
+  {
+    tmp = (uint32_t)(IWRAM[address] | (IWRAM[address + 1] << 8) | (IWRAM[address + 2] << 16) | (IWRAM[address + 3] << 24));
+  }
+  else if(RAMRange == palRamStart)
+  {
+    tmp = (uint32_t)(PALRAM[address] | (PALRAM[address + 1] << 8) | (PALRAM[address + 2] << 16) | (PALRAM[address + 3] << 24));
+  }
   else
   {
-    tmp =  (uint32_t)(SPIRAMRead(RAMRange + address) | (SPIRAMRead(RAMRange + address + 1) << 8) | (SPIRAMRead(RAMRange + address + 2) << 16) | (SPIRAMRead(RAMRange + address + 3) << 24));
+    tmp = sramCache.Read32(RAMRange + address);
   }
    
   return tmp;
@@ -854,9 +1163,17 @@ void Processor::WriteU8(uint32_t address, uint32_t RAMRange, uint8_t value)
   {
     IOREG[address] = value;
   }
+  else if(RAMRange == iwRamStart)
+  {
+    IWRAM[address] = value;
+  }
+  else if(RAMRange == palRamStart)
+  {
+    PALRAM[address] = value;
+  }
   else
   {
-    SPIRAMWrite((RAMRange + address), value);
+    sramCache.Write8((RAMRange + address), value);
   }
 }
 
@@ -872,10 +1189,19 @@ void Processor::WriteU16(uint32_t address, uint32_t RAMRange, uint16_t value)
     IOREG[address] = (uint8_t)(value & 0xFF);
     IOREG[address + 1] = (uint8_t)((value >> 8) & 0xFF);
   }
+  else if(RAMRange == iwRamStart)
+  {
+    IWRAM[address] = (uint8_t)(value & 0xFF);
+    IWRAM[address + 1] = (uint8_t)(value >> 8);
+  }
+  else if(RAMRange == palRamStart)
+  {
+    PALRAM[address] = (uint8_t)(value & 0xFF);
+    PALRAM[address + 1] = (uint8_t)(value >> 8);
+  }
   else
   {
-    SPIRAMWrite((RAMRange + address), (uint8_t)(value & 0xFF));
-    SPIRAMWrite((RAMRange + address) + 1, (uint8_t)(value >> 8));
+    sramCache.Write16((RAMRange + address), value);
   }
 }
 
@@ -895,12 +1221,23 @@ void Processor::WriteU32(uint32_t address, uint32_t RAMRange, uint32_t value)
     IOREG[address + 2] = (uint8_t)((value >> 16) & 0xFF);
     IOREG[address + 3] = (uint8_t)(value >> 24);
   }
+  else if(RAMRange == iwRamStart)
+  {
+    IWRAM[address] = (uint8_t)(value & 0xFF);
+    IWRAM[address + 1] = (uint8_t)((value >> 8) & 0xFF);
+    IWRAM[address + 2] = (uint8_t)((value >> 16) & 0xFF);
+    IWRAM[address + 3] = (uint8_t)(value >> 24);
+  }
+  else if(RAMRange == palRamStart)
+  {
+    PALRAM[address] = (uint8_t)(value & 0xFF);
+    PALRAM[address + 1] = (uint8_t)((value >> 8) & 0xFF);
+    PALRAM[address + 2] = (uint8_t)((value >> 16) & 0xFF);
+    PALRAM[address + 3] = (uint8_t)(value >> 24);
+  }
   else
   {
-    SPIRAMWrite((RAMRange + address), (uint8_t)(value & 0xFF));
-    SPIRAMWrite((RAMRange + address) + 1, (uint8_t)((value >> 8) & 0xFF));
-    SPIRAMWrite((RAMRange + address) + 2, (uint8_t)((value >> 16) & 0xFF));
-    SPIRAMWrite((RAMRange + address) + 3, (uint8_t)((value >> 24) & 0xFF));
+    sramCache.Write32((RAMRange + address), value);
   }
 }
 
@@ -947,9 +1284,7 @@ uint32_t Processor::ReadNop32(uint32_t address)
 
 uint8_t Processor::ReadBIOS8(uint32_t address)
 {
-  waitCycles++;
-  
-  if(registers[15] < 0x01000000)
+  if(registers[15] < 0x01000000 && sizeof(BIOS) > biosRamMask)
   {
     return BIOS[address & biosRamMask];
   }
@@ -959,8 +1294,7 @@ uint8_t Processor::ReadBIOS8(uint32_t address)
 
 uint16_t Processor::ReadBIOS16(uint32_t address)
 {
-  waitCycles++;
-  if(registers[15] < 0x01000000)
+  if(registers[15] < 0x01000000 && sizeof(BIOS) > biosRamMask)
   {
     return (uint16_t)(BIOS[address & biosRamMask] | (BIOS[(address & biosRamMask) + 1] << 8));
   }
@@ -970,8 +1304,7 @@ uint16_t Processor::ReadBIOS16(uint32_t address)
 
 uint32_t Processor::ReadBIOS32(uint32_t address)
 {
-  waitCycles++;
-  if(registers[15] < 0x01000000)
+  if(registers[15] < 0x01000000 && sizeof(BIOS) > biosRamMask)
   {
     return (uint32_t)(BIOS[address & biosRamMask] | (BIOS[(address & biosRamMask) + 1] << 8) | (BIOS[(address & biosRamMask) + 2] << 16) | (BIOS[(address & biosRamMask) + 3] << 24));
   }
@@ -981,316 +1314,198 @@ uint32_t Processor::ReadBIOS32(uint32_t address)
 
 uint8_t Processor::ReadEwRam8(uint32_t address)
 {
-  waitCycles += 3;
   address = (address & ewRamMask);
-  return SPIRAMRead(ewRamStart + address);
+  return sramCache.Read8(ewRamStart + address);
 }
 
 uint16_t Processor::ReadEwRam16(uint32_t address)
 {
-  waitCycles += 3;
   address = (address & ewRamMask);
-  return ReadU16(address, ewRamStart);
+  return sramCache.Read16(ewRamStart + address);
 }
 
 uint32_t Processor::ReadEwRam32(uint32_t address)
 {
-  waitCycles += 6;
   address = (address & ewRamMask);
-  return ReadU32(address, ewRamStart);
+  return sramCache.Read32(ewRamStart + address);
 }
 
 uint8_t Processor::ReadIwRam8(uint32_t address)
 {
-  waitCycles++;
   address = (address & iwRamMask);
-  return SPIRAMRead(iwRamStart + address);
+  return IWRAM[address];
 }
 
 uint16_t Processor::ReadIwRam16(uint32_t address)
 {
-  waitCycles++;
   address = (address & iwRamMask);
   return ReadU16(address, iwRamStart);
 }
 
 uint32_t Processor::ReadIwRam32(uint32_t address)
 {
-  waitCycles++;
   address = (address & iwRamMask);
   return ReadU32(address, iwRamStart);
 }
 
 uint8_t Processor::ReadIO8(uint32_t address)
 {
-  waitCycles++;
-  address &= 0xFFFFFF;
-
-  if(address >= ioRegMask) return 0;
-
-  switch (address)
-  {
-    case KEYINPUT:
-      return (uint8_t)(keyState & 0xFF);
-    case KEYINPUT + 1:
-      return (uint8_t)(keyState >> 8);
-
-    case DMA0CNT_H:
-      return (uint8_t)(dmaRegs[0][3] & 0xFF);
-    case DMA0CNT_H + 1:
-      return (uint8_t)(dmaRegs[0][3] >> 8);
-    case DMA1CNT_H:
-      return (uint8_t)(dmaRegs[1][3] & 0xFF);
-    case DMA1CNT_H + 1:
-      return (uint8_t)(dmaRegs[1][3] >> 8);
-    case DMA2CNT_H:
-      return (uint8_t)(dmaRegs[2][3] & 0xFF);
-    case DMA2CNT_H + 1:
-      return (uint8_t)(dmaRegs[2][3] >> 8);
-    case DMA3CNT_H:
-      return (uint8_t)(dmaRegs[3][3] & 0xFF);
-    case DMA3CNT_H + 1:
-      return (uint8_t)(dmaRegs[3][3] >> 8);
-
-    case TM0D:
-      UpdateTimers();
-      return (uint8_t)((timerCnt[0] >> 10) & 0xFF);
-    case TM0D + 1:
-      UpdateTimers();
-      return (uint8_t)((timerCnt[0] >> 10) >> 8);
-    case TM1D:
-      UpdateTimers();
-      return (uint8_t)((timerCnt[1] >> 10) & 0xFF);
-    case TM1D + 1:
-      UpdateTimers();
-      return (uint8_t)((timerCnt[1] >> 10) >> 8);
-    case TM2D:
-      UpdateTimers();
-      return (uint8_t)((timerCnt[2] >> 10) & 0xFF);
-    case TM2D + 1:
-      UpdateTimers();
-      return (uint8_t)((timerCnt[2] >> 10) >> 8);
-    case TM3D:
-      UpdateTimers();
-      return (uint8_t)((timerCnt[3] >> 10) & 0xFF);
-    case TM3D + 1:
-      UpdateTimers();
-      return (uint8_t)((timerCnt[3] >> 10) >> 8);
-
-    default:
-      return IOREG[address];
-  }
+  return (uint8_t)(ReadIO16(address) >> ((address & 1) << 3));
 }
 
 uint16_t Processor::ReadIO16(uint32_t address)
 {
-  waitCycles++;
   address &= 0xFFFFFF;
 
   if(address >= ioRegMask) return 0;
 
-  switch (address)
-  {
-    case KEYINPUT:
-      return keyState;
-    case DMA0CNT_H:
-      return (uint16_t)dmaRegs[0][3];
-    case DMA1CNT_H:
-      return (uint16_t)dmaRegs[1][3];
-    case DMA2CNT_H:
-      return (uint16_t)dmaRegs[2][3];
-    case DMA3CNT_H:
-      return (uint16_t)dmaRegs[3][3];
-
-    case TM0D:
-      UpdateTimers();
-      return (uint16_t)((timerCnt[0] >> 10) & 0xFFFF);
-    case TM1D:
-      UpdateTimers();
-      return (uint16_t)((timerCnt[1] >> 10) & 0xFFFF);
-    case TM2D:
-      UpdateTimers();
-      return (uint16_t)((timerCnt[2] >> 10) & 0xFFFF);
-    case TM3D:
-      UpdateTimers();
-      return (uint16_t)((timerCnt[3] >> 10) & 0xFFFF);
+  address &= ~1U;
+  const IORegister &reg = IORegisters.regs[address >> 1];
 
-    default:
-      return ReadU16(address, ioRegStart);
+  if(reg.read != IO_READ_PLAIN)
+  {
+    return (this->*IOReadHandlers[reg.read])(address, reg.param) & reg.readMask;
   }
+
+  return (uint16_t)(IOREG[address] | (IOREG[address + 1] << 8)) & reg.readMask;
 }
 
 uint32_t Processor::ReadIO32(uint32_t address)
 {
-  waitCycles++;
-  address &= 0xFFFFFF;
-  
-  if(address >= ioRegMask) return 0;
+  return (uint32_t)ReadIO16(address) | ((uint32_t)ReadIO16(address + 2) << 16);
+}
 
-  switch (address)
-  {
-    case KEYINPUT:
-      return keyState | ((uint32_t)ReadU16(address + 0x2, ioRegStart) << 16);
-    case DMA0CNT_L:
-      return (uint32_t)ReadU16(address, ioRegStart) | (dmaRegs[0][3] << 16);
-    case DMA1CNT_L:
-      return (uint32_t)ReadU16(address, ioRegStart) | (dmaRegs[1][3] << 16);
-    case DMA2CNT_L:
-      return (uint32_t)ReadU16(address, ioRegStart) | (dmaRegs[2][3] << 16);
-    case DMA3CNT_L:
-      return (uint32_t)ReadU16(address, ioRegStart) | (dmaRegs[3][3] << 16);
-
-    case TM0D:
-      UpdateTimers();
-      return (uint32_t)(((timerCnt[0] >> 10) & 0xFFFF) | (uint32_t)(ReadU16(address + 2, ioRegStart) << 16));
-    case TM1D:
-      UpdateTimers();
-      return (uint32_t)(((timerCnt[1] >> 10) & 0xFFFF) | (uint32_t)(ReadU16(address + 2, ioRegStart) << 16));
-    case TM2D:
-      UpdateTimers();
-      return (uint32_t)(((timerCnt[2] >> 10) & 0xFFFF) | (uint32_t)(ReadU16(address + 2, ioRegStart) << 16));
-    case TM3D:
-      UpdateTimers();
-      return (uint32_t)(((timerCnt[3] >> 10) & 0xFFFF) | (uint32_t)(ReadU16(address + 2, ioRegStart) << 16));
+uint16_t Processor::ReadIOKeys(uint32_t address, uint8_t param)
+{
+  return keyState;
+}
 
-    default:
-      return ReadU32(address, ioRegStart);
-  }
+uint16_t Processor::ReadIODma(uint32_t address, uint8_t param)
+{
+  return (uint16_t)dmaRegs[param][3];
+}
+
+uint16_t Processor::ReadIOTimer(uint32_t address, uint8_t param)
+{
+  UpdateTimers();
+  return (uint16_t)((timerCnt[param] >> 10) & 0xFFFF);
 }
 
 uint8_t Processor::ReadPalRam8(uint32_t address)
 {
-  waitCycles++;
   address = (address & palRamMask);
-  return SPIRAMRead(palRamStart + address);
+  return PALRAM[address];
 }
 
 uint16_t Processor::ReadPalRam16(uint32_t address)
 {
-  waitCycles++;
   address = (address & palRamMask);
   return ReadU16(address, palRamStart);
 }
 
 uint32_t Processor::ReadPalRam32(uint32_t address)
 {
-  waitCycles += 2;
   address = (address & palRamMask);
   return ReadU32(address, palRamStart);
 }
 
 uint8_t Processor::ReadVRam8(uint32_t address)
 {
-  waitCycles++;
   address &= vRamMask;
   if (address > 0x17FFF) address = 0x10000 + ((address - 0x17FFF) & 0x7FFF);
-  return SPIRAMRead(vRamStart + address);
+  return sramCache.Read8(vRamStart + address);
 }
 
 uint16_t Processor::ReadVRam16(uint32_t address)
 {
-  waitCycles++;
   address &= vRamMask;
   if (address > 0x17FFF) address = 0x10000 + ((address - 0x17FFF) & 0x7FFF);
-  return ReadU16(address, vRamStart);
+  return sramCache.Read16(vRamStart + address);
 }
 
 uint32_t Processor::ReadVRam32(uint32_t address)
 {
-  waitCycles += 2;
   address = (address & vRamMask);
   if (address > 0x17FFF) address = 0x10000 + ((address - 0x17FFF) & 0x7FFF);
-  return ReadU32(address, vRamStart);
+  return sramCache.Read32(vRamStart + address);
 }
 
 uint8_t Processor::ReadOamRam8(uint32_t address)
 {
-  waitCycles++;
   address = (address & oamRamMask);
   return OAMRAM[address];
 }
 
 uint16_t Processor::ReadOamRam16(uint32_t address)
 {
-  waitCycles++;
   address = (address & oamRamMask);
   return ReadU16(address, oamRamStart);
 }
 
 uint32_t Processor::ReadOamRam32(uint32_t address)
 {
-  waitCycles += 2;
   address = (address & oamRamMask);
   return ReadU32(address, oamRamStart);
 }
 
-uint8_t Processor::ReadROM8(uint32_t address, uint8_t bank)
+uint8_t Processor::ReadROM8(uint32_t address)
 {
-  waitCycles += bankSTimes[(address >> 24) & 0xF];
-  
-  if(bank == 1)
+  if(((address >> 24) & 0x01) == 0) //0x8, 0xA, 0xC
   {
     address = (address & romBank1Mask);
   }
-  else if(bank == 2)
+  else //0x9, 0xB, 0xD
   {
-    address = (address & romBank2Mask) + romBank1Mask;
+    address = (address & romBank2Mask) + romBank1Mask + 1;
   }
   
-  ROM->seek(address);
-  return ROM->read();
+  return romCache.Read8(address);
 }
 
-uint16_t Processor::ReadROM16(uint32_t address, uint8_t bank)
+uint16_t Processor::ReadROM16(uint32_t address)
 {
-  waitCycles += bankSTimes[(address >> 24) & 0xF];
-
-  if(bank == 1)
+  if(((address >> 24) & 0x01) == 0) //0x8, 0xA, 0xC
   {
     address = (address & romBank1Mask);
   }
-  else if(bank == 2)
+  else //0x9, 0xB, 0xD
   {
-    address = (address & romBank2Mask) + romBank1Mask;
+    address = (address & romBank2Mask) + romBank1Mask + 1;
   }
   
-  ROM->seek(address);
-  return (uint16_t)(ROM->read() | (ROM->read() << 8));
+  return romCache.Read16(address);
 }
 
-uint32_t Processor::ReadROM32(uint32_t address, uint8_t bank)
+uint32_t Processor::ReadROM32(uint32_t address)
 {
-  waitCycles += (bankSTimes[(address >> 24) & 0xF] * 2) + 1;
-
-  if(bank == 1)
+  if(((address >> 24) & 0x01) == 0) //0x8, 0xA, 0xC
   {
     address = (address & romBank1Mask);
   }
-  else if(bank == 2)
+  else //0x9, 0xB, 0xD
   {
-    address = (address & romBank2Mask) + romBank1Mask;
+    address = (address & romBank2Mask) + romBank1Mask + 1;
   }
   
-  ROM->seek(address);
-  return (uint32_t)(ROM->read() | (ROM->read() << 8) | (ROM->read() << 16) | (ROM->read() << 24));
+  return romCache.Read32(address);
 }
 
 uint8_t Processor::ReadSRam8(uint32_t address)
 {
   address = (address & sRamMask);
-  return SPIRAMRead(sRamStart + address);
+  return sramCache.Read8(sRamStart + address);
 }
 
 uint16_t Processor::ReadSRam16(uint32_t address)
 {
   address = (address & sRamMask);
-  return ReadU16(address, sRamStart);
+  return sramCache.Read16(sRamStart + address);
 }
 
 uint32_t Processor::ReadSRam32(uint32_t address)
 {
   address = (address & sRamMask);
-  return ReadU32(address, sRamStart);
+  return sramCache.Read32(sRamStart + address);
 }
 
 void Processor::WriteNop8(uint32_t address, uint8_t value)
@@ -1310,598 +1525,370 @@ void Processor::WriteNop32(uint32_t address, uint32_t value)
 
 void Processor::WriteEwRam8(uint32_t address, uint8_t value)
 {
-  waitCycles += 3;
+  blockCache.Write(address);
   address = (address & ewRamMask);
-  SPIRAMWrite((ewRamStart + address), value);
+  sramCache.Write8((ewRamStart + address), value);
 }
 
 void Processor::WriteEwRam16(uint32_t address, uint16_t value)
 {
-  waitCycles += 3;
+  blockCache.Write(address);
   address = (address & ewRamMask);
-  WriteU16(address, ewRamStart, value);
+  sramCache.Write16((ewRamStart + address), value);
 }
 
 void Processor::WriteEwRam32(uint32_t address, uint32_t value)
 {
-  waitCycles += 6;
+  blockCache.Write(address);
   address = (address & ewRamMask);
-  WriteU32(address, ewRamStart, value);
+  sramCache.Write32((ewRamStart + address), value);
 }
 
 void Processor::WriteIwRam8(uint32_t address, uint8_t value)
 {
-  waitCycles++;
+  blockCache.Write(address);
   address = (address & iwRamMask);
-  SPIRAMWrite((iwRamStart + address), value);
+  IWRAM[address] = value;
 }
 
 void Processor::WriteIwRam16(uint32_t address, uint16_t value)
 {
-  waitCycles++;
+  blockCache.Write(address);
   address = (address & iwRamMask);
   WriteU16(address, iwRamStart, value);
 }
 
 void Processor::WriteIwRam32(uint32_t address, uint32_t value)
 {
-  waitCycles++;
+  blockCache.Write(address);
   address = (address & iwRamMask);
   WriteU32(address, iwRamStart, value);
 }
 
 void Processor::WriteIO8(uint32_t address, uint8_t value)
 {
-  waitCycles++;
   address &= 0xFFFFFF;
-  
+
   if(address >= ioRegMask) return;
 
-  switch (address)
-  {
-    case BG2X_L:
-    case BG2X_L + 1:
-    case BG2X_L + 2:
-    case BG2X_L + 3:
-      {
-        IOREG[address] = value;
-        uint32_t tmp = ReadU32(BG2X_L, ioRegStart);
-        if ((tmp & (1 << 27)) != 0) tmp |= 0xF0000000;
-        WriteU32(BG2X_L, ioRegStart, tmp);
+  uint32_t shift = (address & 1) << 3;
+  WriteIOHalf(address & ~1U, (uint16_t)(value << shift), (uint16_t)(0xFF << shift));
+}
 
-        bgx[0] = (int32_t)tmp;
-      }
-      break;
+void Processor::WriteIO16(uint32_t address, uint16_t value)
+{
+  address &= 0xFFFFFF;
 
-    case BG3X_L:
-    case BG3X_L + 1:
-    case BG3X_L + 2:
-    case BG3X_L + 3:
-      {
-        IOREG[address] = value;
-        uint32_t tmp = ReadU32(BG3X_L, ioRegStart);
-        if ((tmp & (1 << 27)) != 0) tmp |= 0xF0000000;
-        WriteU32(BG3X_L, ioRegStart, tmp);
+  if(address >= ioRegMask) return;
 
-        bgx[1] = (int32_t)tmp;
-      }
-      break;
+  WriteIOHalf(address & ~1U, value, 0xFFFF);
+}
 
-    case BG2Y_L:
-    case BG2Y_L + 1:
-    case BG2Y_L + 2:
-    case BG2Y_L + 3:
-      {
-        IOREG[address] = value;
-        uint32_t tmp = ReadU32(BG2Y_L, ioRegStart);
-        if ((tmp & (1 << 27)) != 0) tmp |= 0xF0000000;
-        WriteU32(BG2Y_L, ioRegStart, tmp);
+void Processor::WriteIO32(uint32_t address, uint32_t value)
+{
+  address &= 0xFFFFFF & ~3U;
 
-        bgy[0] = (int32_t)tmp;
-      }
-      break;
+  if(address >= ioRegMask) return;
 
-    case BG3Y_L:
-    case BG3Y_L + 1:
-    case BG3Y_L + 2:
-    case BG3Y_L + 3:
-      {
-        IOREG[address] = value;
-        uint32_t tmp = ReadU32(BG3Y_L, ioRegStart);
-        if ((tmp & (1 << 27)) != 0) tmp |= 0xF0000000;
-        WriteU32(BG3Y_L, ioRegStart, tmp);
-        
-        bgy[1] = (int32_t)tmp;
-      }
-      break;
+  const IORegister &reg = IORegisters.regs[address >> 1];
 
-    case DMA0CNT_H:
-    case DMA0CNT_H + 1:
-        IOREG[address] = value;
-        WriteDmaControl(0);
-        break;
+  if(reg.width == 32 && reg.write != IO_WRITE_PLAIN)
+  {
+    //Both halves land before the effect runs, once
+    uint16_t oldValue = (uint16_t)(IOREG[address] | (IOREG[address + 1] << 8));
+    WriteU32(address, ioRegStart, value);
+    (this->*IOWriteHandlers[reg.write])(address, reg.param, oldValue, (uint16_t)value, 0xFFFF);
+    return;
+  }
 
-    case DMA1CNT_H:
-    case DMA1CNT_H + 1:
-        IOREG[address] = value;
-        WriteDmaControl(1);
-        break;
+  WriteIOHalf(address, (uint16_t)value, 0xFFFF);
+  WriteIOHalf(address + 2, (uint16_t)(value >> 16), 0xFFFF);
+}
 
-    case DMA2CNT_H:
-    case DMA2CNT_H + 1:
-        IOREG[address] = value;
-        WriteDmaControl(2);
-        break;
+//lanes selects the bytes written, 0x00FF or 0xFF00 for byte writes, value is zero outside them
+void Processor::WriteIOHalf(uint32_t address, uint16_t value, uint16_t lanes)
+{
+  const IORegister &reg = IORegisters.regs[address >> 1];
+  uint16_t mask = reg.writeMask & lanes;
+  uint16_t oldValue = (uint16_t)(IOREG[address] | (IOREG[address + 1] << 8));
+  uint16_t newValue = (uint16_t)((oldValue & ~mask) | (value & mask));
 
-    case DMA3CNT_H:
-    case DMA3CNT_H + 1:
-        IOREG[address] = value;
-        WriteDmaControl(3);
-        break;
+  IOREG[address] = (uint8_t)(newValue & 0xFF);
+  IOREG[address + 1] = (uint8_t)(newValue >> 8);
 
-    case TM0CNT:
-    case TM0CNT + 1:
-      {
-        uint16_t oldCnt = ReadU16(TM0CNT, ioRegStart);
-        IOREG[address] = value;
-        WriteTimerControl(0, oldCnt);
-      }
-      break;
+  if(reg.write != IO_WRITE_PLAIN)
+  {
+    (this->*IOWriteHandlers[reg.write])(address, reg.param, oldValue, value, lanes);
+  }
+}
 
-    case TM1CNT:
-    case TM1CNT + 1:
-      {
-        uint16_t oldCnt = ReadU16(TM1CNT, ioRegStart);
-        IOREG[address] = value;
-        WriteTimerControl(1, oldCnt);
-      }
-      break;
+void Processor::WriteIORefPoint(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes)
+{
+  //28 bit signed, extend into the top nibble
+  address &= ~3U;
+  uint32_t tmp = ReadU32(address, ioRegStart);
+  if ((tmp & (1 << 27)) != 0) tmp |= 0xF0000000;
+  WriteU32(address, ioRegStart, tmp);
 
-    case TM2CNT:
-    case TM2CNT + 1:
-      {
-        uint16_t oldCnt = ReadU16(TM2CNT, ioRegStart);
-        IOREG[address] = value;
-        WriteTimerControl(2, oldCnt);
-      }
-      break;
+  if((param & 1) == 0)
+  {
+    bgx[param >> 1] = (int32_t)tmp;
+  }
+  else
+  {
+    bgy[param >> 1] = (int32_t)tmp;
+  }
+}
 
-    case TM3CNT:
-    case TM3CNT + 1:
-      {
-        uint16_t oldCnt = ReadU16(TM3CNT, ioRegStart);
-        IOREG[address] = value;
-        WriteTimerControl(3, oldCnt);
-      }
-      break;
+void Processor::WriteIODma(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes)
+{
+  WriteDmaControl(param);
+}
 
-    case FIFO_A_L:
-    case FIFO_A_L + 1:
-    case FIFO_A_H:
-    case FIFO_A_H + 1:
-      {
-        IOREG[address] = value;
-        sound.IncrementFifoA();
-      }
-      break;
+void Processor::WriteIOTimer(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes)
+{
+  WriteTimerControl(param, oldValue);
+}
 
-    case FIFO_B_L:
-    case FIFO_B_L + 1:
-    case FIFO_B_H:
-    case FIFO_B_H + 1:
-      {
-        IOREG[address] = value;
-        sound.IncrementFifoB();
-      }
-      break;
+void Processor::WriteIOFifoA(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes)
+{
+  sound.IncrementFifoA();
+}
 
-    case IF:
-    case IF + 1:
-      {
-        IOREG[address] &= (uint8_t)~value;
-      }
-      break;
+void Processor::WriteIOFifoB(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes)
+{
+  sound.IncrementFifoB();
+}
 
-    case HALTCNT + 1:
-      {
-        IOREG[address] = value;
-        Halt();
-      }
-      break;
-
-    default:
-      IOREG[address] = value;
-      break;
+void Processor::WriteIOSoundCnt(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes)
+{
+  if ((value & (1 << 11)) != 0)
+  {
+    sound.ResetFifoA();
+  }
+  if ((value & (1 << 15)) != 0)
+  {
+    sound.ResetFifoB();
   }
 }
 
-void Processor::WriteIO16(uint32_t address, uint16_t value)
+void Processor::WriteIOIf(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes)
 {
-  waitCycles++;
-  address &= 0xFFFFFF;
+  //Writing 1 acknowledges
+  WriteU16(address, ioRegStart, (uint16_t)(oldValue & ~value));
+}
 
-  if(address >= ioRegMask) return;
+void Processor::WriteIOWaitCnt(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes)
+{
+  BuildWaitStates();
+}
 
-  switch (address)
+void Processor::WriteIOHalt(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes)
+{
+  //HALTCNT is the upper byte, POSTFLG below it has no effect
+  if((lanes & 0xFF00) != 0)
   {
-    case BG2X_L:
-    case BG2X_L + 2:
-      {
-        WriteU16(address, ioRegStart, value);
-        uint32_t tmp = ReadU32(BG2X_L, ioRegStart);
-        if ((tmp & (1 << 27)) != 0) tmp |= 0xF0000000;
-        WriteU32(BG2X_L, ioRegStart, tmp);
-
-        bgx[0] = (int32_t)tmp;
-      }
-      break;
-
-    case BG3X_L:
-    case BG3X_L + 2:
-      {
-        WriteU16(address, ioRegStart, value);
-        uint32_t tmp = ReadU32(BG3X_L, ioRegStart);
-        if ((tmp & (1 << 27)) != 0) tmp |= 0xF0000000;
-        WriteU32(BG3X_L, ioRegStart, tmp);
-
-        bgx[1] = (int32_t)tmp;
-      }
-      break;
-
-    case BG2Y_L:
-    case BG2Y_L + 2:
-      {
-        WriteU16(address, ioRegStart, value);
-        uint32_t tmp = ReadU32(BG2Y_L, ioRegStart);
-        if ((tmp & (1 << 27)) != 0) tmp |= 0xF0000000;
-        WriteU32(BG2Y_L, ioRegStart, tmp);
-
-        bgy[0] = (int32_t)tmp;
-      }
-      break;
-
-    case BG3Y_L:
-    case BG3Y_L + 2:
-      {
-        WriteU16(address, ioRegStart, value);
-        uint32_t tmp = ReadU32(BG3Y_L, ioRegStart);
-        if ((tmp & (1 << 27)) != 0) tmp |= 0xF0000000;
-        WriteU32(BG3Y_L, ioRegStart, tmp);
-
-        bgy[1] = (int32_t)tmp;
-      }
-      break;
-
-    case DMA0CNT_H:
-        WriteU16(address, ioRegStart, value);
-        WriteDmaControl(0);
-        break;
-
-    case DMA1CNT_H:
-        WriteU16(address, ioRegStart, value);
-        WriteDmaControl(1);
-        break;
-
-    case DMA2CNT_H:
-        WriteU16(address, ioRegStart, value);
-        WriteDmaControl(2);
-        break;
-
-    case DMA3CNT_H:
-        WriteU16(address, ioRegStart, value);
-        WriteDmaControl(3);
-        break;
-
-    case TM0CNT:
-      {
-        uint16_t oldCnt = ReadU16(TM0CNT, ioRegStart);
-        WriteU16(address, ioRegStart, value);
-        WriteTimerControl(0, oldCnt);
-      }
-      break;
-
-    case TM1CNT:
-      {
-        uint16_t oldCnt = ReadU16(TM1CNT, ioRegStart);
-        WriteU16(address, ioRegStart, value);
-        WriteTimerControl(1, oldCnt);
-      }
-      break;
-
-    case TM2CNT:
-      {
-        uint16_t oldCnt = ReadU16(TM2CNT, ioRegStart);
-        WriteU16(address, ioRegStart, value);
-        WriteTimerControl(2, oldCnt);
-      }
-      break;
-
-    case TM3CNT:
-      {
-        uint16_t oldCnt = ReadU16(TM3CNT, ioRegStart);
-        WriteU16(address, ioRegStart, value);
-        WriteTimerControl(3, oldCnt);
-      }
-      break;
-
-    case FIFO_A_L:
-    case FIFO_A_H:
-      {
-        WriteU16(address, ioRegStart, value);
-        sound.IncrementFifoA();
-      }
-      break;
-
-    case FIFO_B_L:
-    case FIFO_B_H:
-      {
-        WriteU16(address, ioRegStart, value);
-        sound.IncrementFifoB();
-      }
-      break;
-
-    case SOUNDCNT_H:
-      {
-        WriteU16(address, ioRegStart, value);
-
-        if ((value & (1 << 11)) != 0)
-        {
-          sound.ResetFifoA();
-        }
-        if ((value & (1 << 15)) != 0)
-        {
-          sound.ResetFifoB();
-        }
-      }
-
-    case IF:
-      {
-        uint16_t tmp = ReadU16(address, ioRegStart);
-        WriteU16(address, ioRegStart, (uint16_t)(tmp & (~value)));
-      }
-      break;
-
-    case HALTCNT:
-      {
-        WriteU16(address, ioRegStart, value);      
-        Halt();
-      }
-      break;
-
-    default:
-      WriteU16(address, ioRegStart, value); 
-      break;
+    Halt();
   }
 }
 
-void Processor::WriteIO32(uint32_t address, uint32_t value)
+void Processor::WriteIOPpu(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes)
 {
-  waitCycles++;
-  address &= 0xFFFFFF;
+  DecodePPURegister(address);
+}
 
-  if(address >= ioRegMask) return;
-  
-  switch (address)
+void Processor::DecodePPU()
+{
+  for(uint32_t address = DISPCNT; address <= BLDY; address += 2)
   {
-    case BG2X_L:
-      {
-        WriteU32(address, ioRegStart, value);
-        uint32_t tmp = ReadU32(BG2X_L, ioRegStart);
-        if ((tmp & (1 << 27)) != 0) tmp |= 0xF0000000;
-        WriteU32(BG2X_L, ioRegStart, tmp);
-
-        bgx[0] = (int32_t)tmp;
-      }
-      break;
-
-    case BG3X_L:
-      {
-        WriteU32(address, ioRegStart, value);
-        uint32_t tmp = ReadU32(BG3X_L, ioRegStart);
-        if ((tmp & (1 << 27)) != 0) tmp |= 0xF0000000;
-        WriteU32(BG3X_L, ioRegStart, tmp);
-
-        bgx[1] = (int32_t)tmp;
-      }
-      break;
+    DecodePPURegister(address);
+  }
+}
 
-    case BG2Y_L:
-      {
-        WriteU32(address, ioRegStart, value);
-        uint32_t tmp = ReadU32(BG2Y_L, ioRegStart);
-        if ((tmp & (1 << 27)) != 0) tmp |= 0xF0000000;
-        WriteU32(BG2Y_L, ioRegStart, tmp);
+void Processor::DecodePPURegister(uint32_t address)
+{
+  address &= ~1U;
+  uint16_t value = (uint16_t)(IOREG[address] | (IOREG[address + 1] << 8));
 
-        bgy[0] = (int32_t)tmp;
-      }
-      break;
+  if (address >= BG0HOFS && address <= BG3VOFS)
+  {
+    PPUBackground &layer = ppu.bg[(address - BG0HOFS) >> 2];
+    if ((address & 2) == 0)
+    {
+      layer.hofs = value & 0x1FF;
+    }
+    else
+    {
+      layer.vofs = value & 0x1FF;
+    }
+    return;
+  }
 
-    case BG3Y_L:
-      {
-        WriteU32(address, ioRegStart, value);
-        uint32_t tmp = ReadU32(BG3Y_L, ioRegStart);
-        if ((tmp & (1 << 27)) != 0) tmp |= 0xF0000000;
-        WriteU32(BG3Y_L, ioRegStart, tmp);
+  if ((address >= BG2PA && address <= BG2PD) || (address >= BG3PA && address <= BG3PD))
+  {
+    PPUBackground &layer = ppu.bg[2 + ((address - BG2PA) >> 4)];
+    switch ((address >> 1) & 0x3)
+    {
+      case 0: layer.dx = (int16_t)value; break;
+      case 1: layer.dmx = (int16_t)value; break;
+      case 2: layer.dy = (int16_t)value; break;
+      case 3: layer.dmy = (int16_t)value; break;
+    }
+    return;
+  }
 
-        bgy[1] = (int32_t)tmp;
-      }
+  switch (address)
+  {
+    case DISPCNT:
+      ppu.dispCnt = value;
+      ppu.winEnabled = (value & (1 << 13)) != 0 || (value & (1 << 14)) != 0 || ((value & (1 << 15)) != 0 && (value & (1 << 12)) != 0);
       break;
 
-    case DMA0CNT_L:
-        WriteU32(address, ioRegStart, value);
-        WriteDmaControl(0);
-        break;
-
-    case DMA1CNT_L:
-        WriteU32(address, ioRegStart, value);
-        WriteDmaControl(1);
-        break;
-
-    case DMA2CNT_L:
-        WriteU32(address, ioRegStart, value);
-        WriteDmaControl(2);
-        break;
-
-    case DMA3CNT_L:
-        WriteU32(address, ioRegStart, value);
-        WriteDmaControl(3);
-        break;
-
-    case TM0D:
+    case BG0CNT:
+    case BG1CNT:
+    case BG2CNT:
+    case BG3CNT:
       {
-        uint16_t oldCnt = ReadU16(TM0CNT, ioRegStart);
-        WriteU32(address, ioRegStart, value);
-        WriteTimerControl(0, oldCnt);
+        PPUBackground &layer = ppu.bg[(address - BG0CNT) >> 1];
+        layer.priority = (uint8_t)(value & 0x3);
+        layer.charBase = ((value >> 2) & 0x3) * 0x4000;
+        layer.colors256 = (value & (1 << 7)) != 0;
+        layer.screenBase = ((value >> 8) & 0x1F) * 0x800;
+        layer.wrap = (value & (1 << 13)) != 0;
+        layer.size = (uint8_t)((value >> 14) & 0x3);
+        layer.width = (layer.size & 1) != 0 ? 512 : 256;
+        layer.height = (layer.size & 2) != 0 ? 512 : 256;
+        layer.affineSize = 128 << layer.size;
       }
       break;
 
-    case TM1D:
-      {
-        uint16_t oldCnt = ReadU16(TM1CNT, ioRegStart);
-        WriteU32(address, ioRegStart, value);
-        WriteTimerControl(1, oldCnt);
-      }
+    case WIN0H:
+      ppu.win0x1 = (uint8_t)(value >> 8);
+      ppu.win0x2 = (uint8_t)(value & 0xff);
+      if (ppu.win0x2 > 240 || ppu.win0x1 > ppu.win0x2) ppu.win0x2 = 240;
       break;
 
-    case TM2D:
-      {
-        uint16_t oldCnt = ReadU16(TM2CNT, ioRegStart);
-        WriteU32(address, ioRegStart, value);
-        WriteTimerControl(2, oldCnt);
-      }
+    case WIN1H:
+      ppu.win1x1 = (uint8_t)(value >> 8);
+      ppu.win1x2 = (uint8_t)(value & 0xff);
+      if (ppu.win1x2 > 240 || ppu.win1x1 > ppu.win1x2) ppu.win1x2 = 240;
       break;
 
-    case TM3D:
-      {
-        uint16_t oldCnt = ReadU16(TM3CNT, ioRegStart);
-        WriteU32(address, ioRegStart, value);
-        WriteTimerControl(3, oldCnt);
-      }
+    case WIN0V:
+      ppu.win0y1 = (uint8_t)(value >> 8);
+      ppu.win0y2 = (uint8_t)(value & 0xff);
+      if (ppu.win0y2 > 160 || ppu.win0y1 > ppu.win0y2) ppu.win0y2 = 160;
       break;
 
-    case FIFO_A_L:
-      {
-        WriteU32(address, ioRegStart, value);
-        sound.IncrementFifoA();
-      }
+    case WIN1V:
+      ppu.win1y1 = (uint8_t)(value >> 8);
+      ppu.win1y2 = (uint8_t)(value & 0xff);
+      if (ppu.win1y2 > 160 || ppu.win1y1 > ppu.win1y2) ppu.win1y2 = 160;
       break;
 
-    case FIFO_B_L:
-      {
-        WriteU32(address, ioRegStart, value);
-        sound.IncrementFifoB();
-      }
+    case WININ:
+      ppu.win0Enabled = (uint8_t)(value & 0xFF);
+      ppu.win1Enabled = (uint8_t)(value >> 8);
       break;
 
-    case SOUNDCNT_L:
-      {
-        WriteU32(address, ioRegStart, value);
-
-        if (((value >> 16) & (1 << 11)) != 0)
-        {
-          sound.ResetFifoA();
-        }
-        if (((value >> 16) & (1 << 15)) != 0)
-        {
-          sound.ResetFifoB();
-        }
-      }
+    case WINOUT:
+      ppu.winOutEnabled = (uint8_t)(value & 0xFF);
+      ppu.winObjEnabled = (uint8_t)(value >> 8);
       break;
 
-    case IE0:
-      {
-        uint32_t tmp = ReadU32(address, ioRegStart);
-        uint32_t res = (uint32_t)((value & 0xFFFF) | (tmp & (~(value & 0xFFFF0000))));
-        WriteU32(address, ioRegStart, res);
-      }
+    case BLDCNT:
+      ppu.blendType = (value >> 6) & 0x3;
+      ppu.blendSource = (uint8_t)(value & 0x3F);
+      ppu.blendTarget = (uint8_t)((value >> 8) & 0x3F);
       break;
 
-    case HALTCNT:
-      {
-        WriteU32(address, ioRegStart, value);
-        Halt();
-      }
+    case BLDALPHA:
+      ppu.blendA = (uint8_t)(value & 0x1F);
+      if (ppu.blendA > 0x10) ppu.blendA = 0x10;
+      ppu.blendB = (uint8_t)((value >> 8) & 0x1F);
+      if (ppu.blendB > 0x10) ppu.blendB = 0x10;
       break;
 
-    default:
-      WriteU32(address, ioRegStart, value);
+    case BLDY:
+      ppu.blendY = (uint8_t)(value & 0x1F);
+      if (ppu.blendY > 0x10) ppu.blendY = 0x10;
       break;
   }
 }
 
 void Processor::WritePalRam8(uint32_t address, uint8_t value)
 {
-  waitCycles++;
   address &= palRamMask & ~1U;
-  SPIRAMWrite((palRamStart + address), value);
-  SPIRAMWrite((palRamStart + address) + 1, value);
+  PALRAM[address] = value;
+  PALRAM[address + 1] = value;
+  MarkDirty(palRamDirty, address / PAL_DIRTY_BLOCK, (address + 1) / PAL_DIRTY_BLOCK, DIRTY_PAL);
 }
 
 void Processor::WritePalRam16(uint32_t address, uint16_t value)
 {
-  waitCycles++;
   address = (address & palRamMask);
   WriteU16(address, palRamStart, value);
+  MarkDirty(palRamDirty, address / PAL_DIRTY_BLOCK, (address + 1) / PAL_DIRTY_BLOCK, DIRTY_PAL);
 }
 
 void Processor::WritePalRam32(uint32_t address, uint32_t value)
 {
-  waitCycles += 2;
   address = (address & palRamMask);
   WriteU32(address, palRamStart, value);
+  MarkDirty(palRamDirty, address / PAL_DIRTY_BLOCK, (address + 3) / PAL_DIRTY_BLOCK, DIRTY_PAL);
 }
 
 void Processor::WriteVRam8(uint32_t address, uint8_t value)
 {
-  waitCycles++;
   address &= vRamMask & ~1U;
   if (address > 0x17FFF) address = 0x10000 + ((address - 0x17FFF) & 0x7FFF);
-  SPIRAMWrite((vRamStart + address), value);
-  SPIRAMWrite((vRamStart + address) + 1, value);
+  sramCache.Write8((vRamStart + address), value);
+  sramCache.Write8((vRamStart + address) + 1, value);
+  MarkDirty(vRamDirty, address / VRAM_DIRTY_BLOCK, (address + 1) / VRAM_DIRTY_BLOCK, DIRTY_VRAM);
 }
 
 void Processor::WriteVRam16(uint32_t address, uint16_t value)
 {
-  waitCycles++;
   address = (address & vRamMask);
   if (address > 0x17FFF) address = 0x10000 + ((address - 0x17FFF) & 0x7FFF);
-  WriteU16(address, vRamStart, value);
+  sramCache.Write16((vRamStart + address), value);
+  MarkDirty(vRamDirty, address / VRAM_DIRTY_BLOCK, (address + 1) / VRAM_DIRTY_BLOCK, DIRTY_VRAM);
 }
 
 void Processor::WriteVRam32(uint32_t address, uint32_t value)
 {
-  waitCycles += 2;
   address &= vRamMask;
   if (address > 0x17FFF) address = 0x10000 + ((address - 0x17FFF) & 0x7FFF);
-  WriteU32(address, vRamStart, value);
+  sramCache.Write32((vRamStart + address), value);
+  MarkDirty(vRamDirty, address / VRAM_DIRTY_BLOCK, (address + 3) / VRAM_DIRTY_BLOCK, DIRTY_VRAM);
 }
 
 void Processor::WriteOamRam8(uint32_t address, uint8_t value)
 {
-  waitCycles++;
   address &= oamRamMask & ~1U;
   OAMRAM[address] = value;
   OAMRAM[address + 1] = value;
+  MarkDirty(oamRamDirty, address / OAM_DIRTY_BLOCK, (address + 1) / OAM_DIRTY_BLOCK, DIRTY_OAM);
 }
 
 void Processor::WriteOamRam16(uint32_t address, uint16_t value)
 {
-  waitCycles++;
   address = (address & oamRamMask);
   WriteU16(address, oamRamStart, value);
+  MarkDirty(oamRamDirty, address / OAM_DIRTY_BLOCK, (address + 1) / OAM_DIRTY_BLOCK, DIRTY_OAM);
 }
 
 void Processor::WriteOamRam32(uint32_t address, uint32_t value)
 {
-  waitCycles++;
   address = (address & oamRamMask);
   WriteU32(address, oamRamStart, value);
+  MarkDirty(oamRamDirty, address / OAM_DIRTY_BLOCK, (address + 3) / OAM_DIRTY_BLOCK, DIRTY_OAM);
 }
 
 void Processor::WriteSRam8(uint32_t address, uint8_t value)
 {
   address = (address & sRamMask);
-  SPIRAMWrite((sRamStart + address), value);
+  sramCache.Write8((sRamStart + address), value);
 }
 
 void Processor::WriteSRam16(uint32_t address, uint16_t value)
@@ -1981,7 +1968,7 @@ void Processor::WriteEeprom8(uint32_t address, uint8_t value)
 
       for(uint8_t i = 0; i < 8; i++)
       {
-        SPIRAMWrite((eeStart + ((eepromAddress * (8 + i)))), (eepromStore[i + offSet]));
+        sramCache.Write8((eeStart + ((eepromAddress * (8 + i)))), (eepromStore[i + offSet]));
       }
 
       eepromMode = 0; //Idle
@@ -2007,7 +1994,7 @@ uint8_t Processor::ReadEeprom8(uint32_t address)
 
   if (curEepromByte >= 4)
   {
-    retval = SPIRAMRead(eeStart + (eepromReadAddress * 8 + ((curEepromByte - 4) / 8)));
+    retval = sramCache.Read8(eeStart + (eepromReadAddress * 8 + ((curEepromByte - 4) / 8)));
     retval = (uint8_t)((retval >> (7 - ((curEepromByte - 4) & 7))) & 1);
   }
 
@@ -2034,142 +2021,143 @@ uint32_t Processor::ReadEeprom32(uint32_t address)
 
 void Processor::ShaderWritePalRam8(uint32_t address, uint8_t value)
 {
-  waitCycles++;
   address &= palRamMask & ~1U;
   WriteU8(address, palRamStart, value);
   WriteU8(address + 1, palRamStart, value);
+  MarkDirty(palRamDirty, address / PAL_DIRTY_BLOCK, (address + 1) / PAL_DIRTY_BLOCK, DIRTY_PAL);
 }
 
 void Processor::ShaderWritePalRam16(uint32_t address, uint16_t value)
 {
-  waitCycles++;
-  WriteU16(address & palRamMask, palRamStart, value);
+  address &= palRamMask;
+  WriteU16(address, palRamStart, value);
+  MarkDirty(palRamDirty, address / PAL_DIRTY_BLOCK, (address + 1) / PAL_DIRTY_BLOCK, DIRTY_PAL);
 }
 
 void Processor::ShaderWritePalRam32(uint32_t address, uint32_t value)
 {
-  waitCycles+=2;
-  WriteU32(address & palRamMask, palRamStart, value);
+  address &= palRamMask;
+  WriteU32(address, palRamStart, value);
+  MarkDirty(palRamDirty, address / PAL_DIRTY_BLOCK, (address + 3) / PAL_DIRTY_BLOCK, DIRTY_PAL);
 }
 
 void Processor::ShaderWriteVRam8(uint32_t address, uint8_t value)
 {
-  waitCycles++;
   address &= vRamMask & ~1U;
   if (address > 0x17FFF) address = 0x10000 + ((address - 0x17FFF) & 0x7FFF);
   WriteU8(address, vRamStart, value);
   WriteU8(address + 1, vRamStart, value);
+  MarkDirty(vRamDirty, address / VRAM_DIRTY_BLOCK, (address + 1) / VRAM_DIRTY_BLOCK, DIRTY_VRAM);
 }
 
 void Processor::ShaderWriteVRam16(uint32_t address, uint16_t value)
 {
-  waitCycles++;
   address &= vRamMask;
   if (address > 0x17FFF) address = 0x10000 + ((address - 0x17FFF) & 0x7FFF);
-  WriteU16(address, vRamStart, value);
+  sramCache.Write16((vRamStart + address), value);
+  MarkDirty(vRamDirty, address / VRAM_DIRTY_BLOCK, (address + 1) / VRAM_DIRTY_BLOCK, DIRTY_VRAM);
 }
 
 void Processor::ShaderWriteVRam32(uint32_t address, uint32_t value)
 {
-  waitCycles += 2;
   address &= vRamMask;
   if (address > 0x17FFF) address = 0x10000 + ((address - 0x17FFF) & 0x7FFF);
-  WriteU32(address, vRamStart, value);
+  sramCache.Write32((vRamStart + address), value);
+  MarkDirty(vRamDirty, address / VRAM_DIRTY_BLOCK, (address + 3) / VRAM_DIRTY_BLOCK, DIRTY_VRAM);
 }
 
-uint8_t Processor::ReadU8(uint32_t address)
+void Processor::ClearDirty(uint8_t regions)
 {
-  uint16_t bank = (address >> 24) & 0xf;
-  return ReadU8Funcs(bank, address);
-}
+  if((regions & DIRTY_VRAM) != 0)
+  {
+    memset(vRamDirty, 0, sizeof(vRamDirty));
+  }
 
-uint16_t Processor::ReadU16(uint32_t address)
-{
-  address &= ~1;
-  uint16_t bank = (address >> 24) & 0xf;
-  return ReadU16Funcs(bank, address);
+  if((regions & DIRTY_PAL) != 0)
+  {
+    memset(palRamDirty, 0, sizeof(palRamDirty));
+  }
+
+  if((regions & DIRTY_OAM) != 0)
+  {
+    memset(oamRamDirty, 0, sizeof(oamRamDirty));
+  }
+
+  dirtyRegions &= (uint8_t)~regions;
 }
 
- uint32_t Processor::ReadU32(uint32_t address)
+void Processor::PrintMemoryStats()
 {
-  uint32_t shiftAmt = (int)((address & 3U) << 3);
-  address &= ~3;
-  uint16_t bank = (address >> 24) & 0xf;
-  uint32_t res = ReadU32Funcs(bank, address);
-  return (res >> shiftAmt) | (res << (32 - shiftAmt));
+#ifdef MEMORY_STATS
+  static const char *pageNames[PAGE_COUNT] = { "BIOS", "-", "EWRAM", "IWRAM", "IO", "PAL", "VRAM", "OAM", "ROM0", "ROM0", "ROM1", "ROM1", "ROM2", "EEPROM", "SRAM", "-" };
+  static const char *sourceNames[ACCESS_SOURCES] = { "CPU", "DMA", "REN" };
+
+  Serial.println("Memory Access (reads 8/16/32/span, writes 8/16/32)");
+
+  for(uint8_t page = 0; page < PAGE_COUNT; page++)
+  {
+    for(uint8_t source = 0; source < ACCESS_SOURCES; source++)
+    {
+      uint32_t total = 0;
+
+      for(uint8_t width = 0; width < ACCESS_WIDTHS; width++)
+      {
+        total += memStats[page][source][width][ACCESS_READ] + memStats[page][source][width][ACCESS_WRITE];
+      }
+
+      if(total == 0) continue;
+
+      Serial.println("  " + String(pageNames[page]) + " " + String(sourceNames[source]) +
+                     " R " + String(memStats[page][source][ACCESS_8][ACCESS_READ], DEC) + "/" + String(memStats[page][source][ACCESS_16][ACCESS_READ], DEC) + "/" +
+                     String(memStats[page][source][ACCESS_32][ACCESS_READ], DEC) + "/" + String(memStats[page][source][ACCESS_SPAN][ACCESS_READ], DEC) +
+                     " W " + String(memStats[page][source][ACCESS_8][ACCESS_WRITE], DEC) + "/" + String(memStats[page][source][ACCESS_16][ACCESS_WRITE], DEC) + "/" +
+                     String(memStats[page][source][ACCESS_32][ACCESS_WRITE], DEC));
+    }
+  }
+#endif
 }
 
-uint32_t Processor::ReadU32Aligned(uint32_t address)
+void Processor::ResetMemoryStats()
 {
-  uint16_t bank = (address >> 24) & 0xf;
-  return ReadU32Funcs(bank, address);
+#ifdef MEMORY_STATS
+  memset(memStats, 0, sizeof(memStats));
+#endif
 }
 
 uint16_t Processor::ReadU16Debug(uint32_t address)
 {
-  address &= ~1;
-  uint16_t bank = (address >> 24) & 0xf;
   uint32_t oldWaitCycles = waitCycles;
-  uint16_t res = ReadU16Funcs(bank, address);
+  uint16_t res = ReadU16(address);
   waitCycles = oldWaitCycles;
   return res;
 }
 
 uint32_t Processor::ReadU32Debug(uint32_t address)
 {
-  int32_t shiftAmt = (int)((address & 3) << 3);
-  address &= ~3;
-  uint16_t bank = (address >> 24) & 0xf;
   uint32_t oldWaitCycles = waitCycles;
-  uint32_t res = ReadU32Funcs(bank, address);
+  uint32_t res = ReadU32(address);
   waitCycles = oldWaitCycles;
-  uint32_t tmp = (res >> shiftAmt) | (res << (32 - shiftAmt));
-  return tmp;
-}
-
-void Processor::WriteU8(uint32_t address, uint8_t value)
-{
-  uint16_t bank = (address >> 24) & 0xf;
-  WriteU8Funcs(bank, address, value);
-}
-
-void Processor::WriteU16(uint32_t address, uint16_t value)
-{
-  address &= ~1U;
-  uint16_t bank = (address >> 24) & 0xf;
-  WriteU16Funcs(bank, address, value);
-}
-
-void Processor::WriteU32(uint32_t address, uint32_t value)
-{
-  address &= ~3U;
-  uint16_t bank = (address >> 24) & 0xf;
-  WriteU32Funcs(bank, address, value);
+  return res;
 }
 
 void Processor::WriteU8Debug(uint32_t address, uint8_t value)
 {
-  uint16_t bank = (address >> 24) & 0xf;
   uint32_t oldWaitCycles = waitCycles;
-  WriteU8Funcs(bank, address, value);
+  WriteU8(address, value);
   waitCycles = oldWaitCycles;
 }
 
 void Processor::WriteU16Debug(uint32_t address, uint16_t value)
 {
-  address &= ~1U;
-  uint16_t bank = (address >> 24) & 0xf;
   uint32_t oldWaitCycles = waitCycles;
-  WriteU16Funcs(bank, address, value);
+  WriteU16(address, value);
   waitCycles = oldWaitCycles;
 }
 
 void Processor::WriteU32Debug(uint32_t address, uint32_t value)
 {
-  address &= ~3U;
-  uint16_t bank = (address >> 24) & 0xf;
   uint32_t oldWaitCycles = waitCycles;
-  WriteU32Funcs(bank, address, value);
+  WriteU32(address, value);
   waitCycles = oldWaitCycles;
 }
 
@@ -2210,6 +2198,10 @@ void Processor::LoadCartridge()
     RomBankCount = 2;
   }
 
+  romCache.Begin(ROM, (uint32_t)ROMSize);
+
+  BuildPageTable();
+
   //Address Bytes Expl.
   //000h    4     ROM Entry Point  (32bit ARM branch opcode, eg. "B rom_start")
   //004h    156   Nintendo Logo    (compressed bitmap, required!)
@@ -2229,360 +2221,146 @@ void Processor::LoadCartridge()
   //0C5h    1     Slave ID Number  (init as 00h - BIOS overwrites this value!)
   //0C6h    26    Not used         (seems to be unused)
   //0E0h    4     JOYBUS Entry Pt. (32bit ARM branch opcode, eg. "B joy_start")
+
+  idleLoop.Begin(ReadU32Debug(0x080000AC));
+  placement.Begin(ReadU32Debug(0x080000AC));
 }
 
 void Processor::ResetRomBanks()
 {
   romBank1Mask = 0;
   romBank2Mask = 0;
-    
-  for(uint8_t i = 0; i < (sizeof(bankSTimes)/sizeof(uint32_t)); i++)
-  {
-    bankSTimes[i] = 2;
-  }
 
   RomBankCount = 0;
-  RomBankCount = 0;
+
+  BuildPageTable();
 }
 
-uint8_t Processor::ReadU8Funcs(uint16_t bank, uint32_t address)
+void Processor::BuildPageTable()
 {
-  switch(bank)
+  for(uint8_t i = 0; i < PAGE_COUNT; i++)
   {
-    case 0:
-      return ReadBIOS8(address);
-      break;
-    case 1:
-      return ReadNop8(address);
-      break;
-    case 2:
-      return ReadEwRam8(address);
-      break;
-    case 3:
-      return ReadIwRam8(address);
-      break;
-    case 4:
-      return ReadIO8(address);
-      break;
-    case 5:
-      return ReadPalRam8(address);
-      break;
-    case 6:
-      return ReadVRam8(address);
-      break;
-    case 7:
-      return ReadOamRam8(address);
-      break;
-    case 8: //0x8
-      return RomBankCount == 0 ? ReadNop8(address) : ReadROM8(address, 1);
-      break;
-    case 9: //0x9
-      return RomBankCount == 2 ? ReadROM8(address, 2) : ReadNop8(address);
-      break;
-    case 10:
-      return ReadNop8(address);
-      break;
-    case 11: //0xA
-      return RomBankCount == 0 ? ReadNop8(address) : ReadROM8(address, 1);
-      break;
-    case 12: //0xB
-      return RomBankCount == 2 ? ReadROM8(address, 2) : ReadNop8(address);
-      break;
-    case 13: //0xC
-      return RomBankCount == 0 ? ReadNop8(address) : ReadROM8(address, 1);
-      break;
-    case 14: //0xD
-      return RomBankCount == 2 ? ReadROM8(address, 2) : ReadNop8(address);
-      break;
-    case 15:
-      return ReadNop8(address);
-      break;
-    default:
-      return 0;
+    SetPage(i, PAGE_HANDLERS(ReadNop, WriteNop));
   }
-}
 
-uint16_t Processor::ReadU16Funcs(uint16_t bank, uint32_t address)
-{
-  //Serial.println("ReadU16 Bank: " + String(bank, DEC) + " Address: " + String(address, DEC));
-  switch(bank)
+  SetPage(0x0, PAGE_HANDLERS(ReadBIOS, WriteNop));
+  SetPage(0x2, PAGE_HANDLERS(ReadEwRam, WriteEwRam));
+  SetPage(0x3, PAGE_HANDLERS(ReadIwRam, WriteIwRam));
+  SetPage(0x4, PAGE_HANDLERS(ReadIO, WriteIO));
+
+  if(EnableVRUpdating)
   {
-    case 0:
-      return ReadBIOS16(address);
-      break;
-    case 1:
-      return ReadNop16(address);
-      break;
-    case 2:
-      return ReadEwRam16(address);
-      break;
-    case 3:
-      return ReadIwRam16(address);
-      break;
-    case 4:
-      return ReadIO16(address);
-      break;
-    case 5:
-      return ReadPalRam16(address);
-      break;
-    case 6:
-      return ReadVRam16(address);
-      break;
-    case 7:
-      return ReadOamRam16(address);
-      break;
-    case 8: //0x8
-      return RomBankCount == 0 ? ReadNop16(address) : ReadROM16(address, 1);
-      break;
-    case 9: //0x9
-      return RomBankCount == 2 ? ReadROM16(address, 2) : ReadNop16(address);
-      break;
-    case 10: 
-      return ReadNop16(address);
-      break;
-    case 11: //0xA
-      return RomBankCount == 0 ? ReadNop16(address) : ReadROM16(address, 1);
-      break; 
-    case 12: //0xB
-      return RomBankCount == 2 ? ReadROM16(address, 2) : ReadNop16(address);
-      break;
-    case 13: //0xC
-      return RomBankCount == 0 ? ReadNop16(address) : ReadROM16(address, 1);
-      break;
-    case 14: //0xD
-      return RomBankCount == 2 ? ReadROM16(address, 2) : ReadNop16(address);
-      break;
-    case 15:
-      return ReadNop16(address);
-      break;
-    default:
-      return 0;
+    SetPage(0x5, PAGE_HANDLERS(ReadPalRam, ShaderWritePalRam));
+    SetPage(0x6, PAGE_HANDLERS(ReadVRam, ShaderWriteVRam));
+  }
+  else
+  {
+    SetPage(0x5, PAGE_HANDLERS(ReadPalRam, WritePalRam));
+    SetPage(0x6, PAGE_HANDLERS(ReadVRam, WriteVRam));
   }
-}
 
-uint32_t Processor::ReadU32Funcs(uint16_t bank, uint32_t address)
-{
-  switch(bank)
+  SetPage(0x7, PAGE_HANDLERS(ReadOamRam, WriteOamRam));
+
+  //Cartridge ROM, each wait state region (0x8, 0xA, 0xC) maps both 16MB banks
+  for(uint8_t i = 0x8; i <= 0xC; i += 2)
   {
-    case 0:
-      return ReadBIOS32(address);
-      break;
-    case 1:
-      return ReadNop32(address);
-      break;
-    case 2:
-      return ReadEwRam32(address);
-      break;
-    case 3:
-      return ReadIwRam32(address);
-      break;
-    case 4:
-      return ReadIO32(address);
-      break;
-    case 5:
-      return ReadPalRam32(address);
-      break;
-    case 6:
-      return ReadVRam32(address);
-      break;
-    case 7:
-      return ReadOamRam32(address);
-      break;
-    case 8: //0x8
-      return RomBankCount == 0 ? ReadNop32(address) : ReadROM32(address, 1);
-      break;
-    case 9: //0x9
-      return RomBankCount == 2 ? ReadROM32(address, 2) : ReadNop32(address);
-      break;
-    case 10:
-      return ReadNop32(address);
-      break;
-    case 11: //0xA
-      return RomBankCount == 0 ? ReadNop32(address) : ReadROM32(address, 1);
-      break;
-    case 12: //0xB
-      return RomBankCount == 2 ? ReadROM32(address, 2) : ReadNop32(address);
-      break;
-    case 13: //0xC
-      return RomBankCount == 0 ? ReadNop32(address) : ReadROM32(address, 1);
-      break;
-    case 14: //0xD
-      return RomBankCount == 2 ? ReadROM32(address, 2) : ReadNop32(address);
-      break;
-    case 15:
-      return ReadNop32(address);
-      break;
-    default:
-      return 0;
+    if(RomBankCount >= 1)
+    {
+      SetPage(i, PAGE_HANDLERS(ReadROM, WriteNop));
+    }
+
+    if(RomBankCount == 2)
+    {
+      SetPage(i + 1, PAGE_HANDLERS(ReadROM, WriteNop));
+    }
   }
-}
 
-void Processor::WriteU8Funcs(uint16_t bank, uint32_t address, uint8_t value)
-{
-  switch(bank)
+  if(RomBankCount < 2) //EEPROM sits in the upper half of wait state 2 when the ROM doesn't need it
   {
-    case 0:
-      WriteNop8(address, value);
-      break;
-    case 1:
-      WriteNop8(address, value);
-      break;
-    case 2:
-      WriteEwRam8(address, value);
-      break;
-    case 3:
-      WriteIwRam8(address, value);
-      break;
-    case 4:
-      WriteIO8(address, value);
-      break;
-    case 5:
-      EnableVRUpdating ? ShaderWritePalRam8(address, value) : WritePalRam8(address, value);
-      break;
-    case 6:
-      EnableVRUpdating ? ShaderWriteVRam8(address, value) : WriteVRam8(address, value);
-      break;
-    case 7:
-      WriteOamRam8(address, value);
-      break;
-    case 8:
-      WriteNop8(address, value);
-      break;
-    case 9:
-      WriteNop8(address, value);
-      break;
-    case 10:
-      WriteNop8(address, value);
-      break;
-    case 11:
-      WriteNop8(address, value);
-      break;
-    case 12:
-      WriteNop8(address, value);
-      break;
-    case 13:
-      WriteNop8(address, value);
-      break;
-    case 14:
-      WriteSRam8(address, value);
-      break;
-    case 15:
-      WriteNop8(address, value);
-      break;
+    SetPage(0xD, PAGE_HANDLERS(ReadEeprom, WriteEeprom));
   }
+
+  SetPage(0xE, PAGE_HANDLERS(ReadSRam, WriteSRam));
+
+  //Internal RAM, 8/16 bit writes to palette and OAM duplicate bytes so they keep their handlers
+  SetPagePointers(0x3, IWRAM, IWRAM, iwRamMask);
+  SetPagePointers(0x5, PALRAM, NULL, palRamMask);
+  SetPagePointers(0x7, OAMRAM, NULL, oamRamMask);
+  TrackCodeWrites();
+
+  BuildWaitStates();
 }
 
-void Processor::WriteU16Funcs(uint16_t bank, uint32_t address, uint16_t value)
+void Processor::SetPage(uint8_t page, ReadU8Handler read8, ReadU16Handler read16, ReadU32Handler read32, WriteU8Handler write8, WriteU16Handler write16, WriteU32Handler write32)
 {
-  switch(bank)
-  {
-    case 0:
-      WriteNop16(address, value);
-      break;
-    case 1:
-      WriteNop16(address, value);
-      break;
-    case 2:
-      WriteEwRam16(address, value);
-      break;
-    case 3:
-      WriteIwRam16(address, value);
-      break;
-    case 4:
-      WriteIO16(address, value);
-      break;
-    case 5:
-      EnableVRUpdating ? ShaderWritePalRam16(address, value) : WritePalRam16(address, value);
-      break;
-    case 6:
-      EnableVRUpdating ? ShaderWriteVRam16(address, value) : WriteVRam16(address, value);
-      break;
-    case 7:
-      WriteOamRam16(address, value);
-      break;
-    case 8:
-      WriteNop16(address, value);
-      break;
-    case 9:
-      WriteNop16(address, value);
-      break;
-    case 10:
-      WriteNop16(address, value);
-      break;
-    case 11:
-      WriteNop16(address, value);
-      break;
-    case 12:
-      WriteNop16(address, value);
-      break;
-    case 13:
-      WriteNop16(address, value);
-      break;
-    case 14:
-      WriteSRam16(address, value);
-      break;
-    case 15:
-      WriteNop16(address, value);
-      break;
-  }
+  pages[page].readPtr = NULL;
+  pages[page].writePtr = NULL;
+  pages[page].mask = 0;
+  pages[page].read8 = read8;
+  pages[page].read16 = read16;
+  pages[page].read32 = read32;
+  pages[page].write8 = write8;
+  pages[page].write16 = write16;
+  pages[page].write32 = write32;
 }
 
-void Processor::WriteU32Funcs(uint16_t bank, uint32_t address, uint32_t value)
+void Processor::SetPagePointers(uint8_t page, uint8_t *readPtr, uint8_t *writePtr, uint32_t mask)
 {
-  switch(bank)
+  pages[page].readPtr = readPtr;
+  pages[page].writePtr = writePtr;
+  pages[page].mask = mask;
+}
+
+//IWRAM writes skip the handlers unless a block was recorded from IWRAM, then they have to be checked
+void Processor::TrackCodeWrites()
+{
+  pages[0x3].writePtr = blockCache.iwRamCodePages != 0 ? NULL : IWRAM;
+}
+
+void Processor::BuildWaitStates()
+{
+  //WAITCNT - Waitstate Control
+  //Bit   Expl.
+  //0-1   SRAM Wait Control          (0..3 = 4,3,2,8 cycles)
+  //2-3   Wait State 0 First Access  (0..3 = 4,3,2,8 cycles)
+  //4     Wait State 0 Second Access (0..1 = 2,1 cycles)
+  //5-6   Wait State 1 First Access  (0..3 = 4,3,2,8 cycles)
+  //7     Wait State 1 Second Access (0..1 = 4,1 cycles)
+  //8-9   Wait State 2 First Access  (0..3 = 4,3,2,8 cycles)
+  //10    Wait State 2 Second Access (0..1 = 8,1 cycles)
+  static const uint8_t firstAccess[4] = { 4, 3, 2, 8 };
+  static const uint8_t secondAccess[3][2] = { { 2, 1 }, { 4, 1 }, { 8, 1 } };
+
+  uint16_t waitCnt = (uint16_t)(IOREG[WAITCNT] | (IOREG[WAITCNT + 1] << 8));
+
+  for(uint8_t i = 0; i < PAGE_COUNT; i++)
   {
-    case 0:
-      WriteNop32(address, value);
-      break;
-    case 1:
-      WriteNop32(address, value);
-      break;
-    case 2:
-      WriteEwRam32(address, value);
-      break;
-    case 3:
-      WriteIwRam32(address, value);
-      break;
-    case 4:
-      WriteIO32(address, value);
-      break;
-    case 5:
-      EnableVRUpdating ? ShaderWritePalRam32(address, value) : WritePalRam32(address, value);
-      break;
-    case 6:
-      EnableVRUpdating ? ShaderWriteVRam32(address, value) : WriteVRam32(address, value);
-      break;
-    case 7:
-      WriteOamRam32(address, value);
-      break;
-    case 8:
-      WriteNop32(address, value);
-      break;
-    case 9:
-      WriteNop32(address, value);
-      break;
-    case 10:
-      WriteNop32(address, value);
-      break;
-    case 11:
-      WriteNop32(address, value);
-      break;
-    case 12:
-      WriteNop32(address, value);
-      break;
-    case 13:
-      WriteNop32(address, value);
-      break;
-    case 14:
-      WriteSRam32(address, value);
-      break;
-    case 15:
-      WriteNop32(address, value);
-      break;
+    SetWaitStates(i, 1, 1, 1, 1);
   }
-}
 
+  SetWaitStates(0x2, 3, 3, 6, 6); //EWRAM, 16 bit bus
+  SetWaitStates(0x5, 1, 1, 2, 2); //Palette, 16 bit bus
+  SetWaitStates(0x6, 1, 1, 2, 2); //VRAM, 16 bit bus
 
+  //Cartridge ROM, 16 bit bus so 32 bit accesses are a first access plus a second access
+  for(uint8_t ws = 0; ws < 3; ws++)
+  {
+    uint8_t nonSeq = 1 + firstAccess[(waitCnt >> (2 + (ws * 3))) & 0x03];
+    uint8_t seq = 1 + secondAccess[ws][(waitCnt >> (4 + (ws * 3))) & 0x01];
 
+    SetWaitStates(0x8 + (ws * 2), nonSeq, seq, nonSeq + seq, seq * 2);
+    SetWaitStates(0x9 + (ws * 2), nonSeq, seq, nonSeq + seq, seq * 2);
+  }
 
+  //Cartridge SRAM, 8 bit bus
+  uint8_t sram = 1 + firstAccess[waitCnt & 0x03];
+  SetWaitStates(0xE, sram, sram, sram, sram);
+}
 
+void Processor::SetWaitStates(uint8_t page, uint8_t nonSeq16, uint8_t seq16, uint8_t nonSeq32, uint8_t seq32)
+{
+  waitStates[page][WAIT_16][WAIT_N] = nonSeq16;
+  waitStates[page][WAIT_16][WAIT_S] = seq16;
+  waitStates[page][WAIT_32][WAIT_N] = nonSeq32;
+  waitStates[page][WAIT_32][WAIT_S] = seq32;
+}
@@ -27,12 +27,16 @@
 
 #include <inttypes.h>
 #include <Arduino.h>
+#include "GBA_SRAMCache.h"
+#include "GBA_BlockCache.h"
+#include "GBA_IdleLoop.h"
 
 #define REG_BASE 0x4000000
 #define PAL_BASE 0x5000000
 #define VRAM_BASE 0x6000000
 #define OAM_BASE 0x7000000
 
+#define DISPCNT 0x0
 #define DISPSTAT 0x4
 #define VCOUNT 0x6
 
@@ -67,6 +71,14 @@
 #define BG3Y_L 0x3C
 #define BG3Y_H 0x3E
 
+#define WIN0H 0x40
+#define WIN1H 0x42
+#define WIN0V 0x44
+#define WIN1V 0x46
+#define WININ 0x48
+#define WINOUT 0x4A
+#define MOSAIC 0x4C
+
 #define BLDCNT 0x50
 #define BLDALPHA 0x52
 #define BLDY 0x54
@@ -110,10 +122,17 @@
 #define KEYCNT 0x132
 #define IE0 0x200
 #define IF 0x202
+#define WAITCNT 0x204
 #define IME 0x208
 
 #define HALTCNT 0x300
 
+#define NATIVE_IRQ //Dispatch interrupts straight to the game's handler instead of running the BIOS IRQ vector
+#define IRQ_HANDLER 0x3FFFFFC //The game's handler pointer, mirror of 3007FFCh
+#define IRQ_RETURN 0x138      //Where the BIOS calls the handler from, the handler returns here
+#define IRQ_ENTRY_CYCLES 12   //Approximate cycles of the BIOS entry on top of the register pushes
+#define IRQ_RETURN_CYCLES 8   //Approximate cycles of the BIOS exit on top of the register pops
+
 #define biosRamMask 0x3FFF //BIOS ROM 16KB
 #define ewRamMask 0x3FFFF  //External Work Ram 256KB
 #define iwRamMask 0x7FFF   //Internal MCU Memory 32KB
@@ -124,14 +143,168 @@
 #define sRamMask 0xFFFF    //Cartridge RAM 64KB
 #define eeMask 0xFFFF
 
+//External SRAM Layout (19 address lines = 512KB)
 #define ewRamStart  0x00000000 //0x00000 - 0x3FFFF = 0x3FFFF
-#define iwRamStart  0x00040000 //0x40000 - 0x47FFF = 0x7FFF
-#define ioRegStart  0x00048000 //0x48000 - 0x484FF = 0x4FF
-#define vRamStart   0x00048500 //0x48500 - 0x684FF = 0x1FFFF
-#define palRamStart 0x00068500 //0x68500 - 0x688FF = 0x3FF
-#define oamRamStart 0x00068900 //0x68900 - 0x68CFF = 0x3FF
-#define sRamStart   0x00068D00 //0x68D00 - 0x78CFF = 0xFFFF
-#define eeStart     0x00078D00 //0x78D00 - 0x88CFF = 0xFFFF
+#define vRamStart   0x00040000 //0x40000 - 0x5FFFF = 0x1FFFF
+#define sRamStart   0x00060000 //0x60000 - 0x6FFFF = 0xFFFF
+#define eeStart     0x00070000 //0x70000 - 0x7FFFF = 0xFFFF
+
+//Internal Teensy RAM (RAMRange tags only, outside the SRAM address space)
+#define iwRamStart  0x00080000 //IWRAM[]
+#define ioRegStart  0x00088000 //IOREG[]
+#define palRamStart 0x00088500 //PALRAM[]
+#define oamRamStart 0x00088900 //OAMRAM[]
+
+//Renderer Memory Regions, resolved at compile time by Processor::Read/ReadSpan
+enum class Region
+{
+  EWRAM,
+  IWRAM,
+  IO,
+  PAL,
+  VRAM,
+  OAM
+};
+
+//Memory Page Table, one page per 16MB region (address >> 24)
+#define PAGE_COUNT 0x10
+
+class Processor;
+
+typedef uint8_t (Processor::*ReadU8Handler)(uint32_t address);
+typedef uint16_t (Processor::*ReadU16Handler)(uint32_t address);
+typedef uint32_t (Processor::*ReadU32Handler)(uint32_t address);
+typedef void (Processor::*WriteU8Handler)(uint32_t address, uint8_t value);
+typedef void (Processor::*WriteU16Handler)(uint32_t address, uint16_t value);
+typedef void (Processor::*WriteU32Handler)(uint32_t address, uint32_t value);
+
+struct MemoryPage
+{
+  uint8_t *readPtr;  //Internal RAM backing reads, NULL = use the handlers
+  uint8_t *writePtr; //Internal RAM backing writes, NULL = use the handlers
+  uint32_t mask;
+
+  ReadU8Handler read8;
+  ReadU16Handler read16;
+  ReadU32Handler read32;
+  WriteU8Handler write8;
+  WriteU16Handler write16;
+  WriteU32Handler write32;
+};
+
+//IO Register Descriptors, one per 16 bit register (address >> 1)
+#define IO_REGISTER_COUNT ((ioRegMask + 1) / 2)
+
+#define IO_READ_PLAIN 0 //Stored value
+#define IO_READ_KEYS 1
+#define IO_READ_DMA 2
+#define IO_READ_TIMER 3
+#define IO_READ_EFFECTS 4
+
+#define IO_WRITE_PLAIN 0 //Stored, no side effect
+#define IO_WRITE_REFPOINT 1
+#define IO_WRITE_DMA 2
+#define IO_WRITE_TIMER 3
+#define IO_WRITE_FIFO_A 4
+#define IO_WRITE_FIFO_B 5
+#define IO_WRITE_SOUNDCNT 6
+#define IO_WRITE_IF 7
+#define IO_WRITE_WAITCNT 8
+#define IO_WRITE_HALT 9
+#define IO_WRITE_PPU 10
+#define IO_WRITE_EFFECTS 11
+
+typedef uint16_t (Processor::*IOReadHandler)(uint32_t address, uint8_t param);
+typedef void (Processor::*IOWriteHandler)(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes);
+
+struct IORegister
+{
+  uint16_t readMask;  //Bits a CPU read returns, 0 for write only registers
+  uint16_t writeMask; //Bits a CPU write stores
+  uint8_t width;      //32 = a 32 bit write runs the effect once for both halves
+  uint8_t read;       //IO_READ_*
+  uint8_t write;      //IO_WRITE_*
+  uint8_t param;      //DMA channel, timer or reference point the effect works on
+};
+
+struct IORegisterTable
+{
+  IORegister regs[IO_REGISTER_COUNT];
+};
+
+//Decoded PPU Registers, kept current by the IO writes so the renderer never decodes IOREG
+struct PPUBackground
+{
+  uint8_t priority;
+  uint8_t size;        //BGxCNT screen size, 0 - 3
+  bool colors256;
+  bool wrap;           //Rotation/scaling area overflow wraps
+  int32_t charBase;
+  int32_t screenBase;
+  int32_t width;       //Text mode size in pixels
+  int32_t height;
+  int32_t affineSize;  //Rotation/scaling size in pixels
+  int32_t hofs;
+  int32_t vofs;
+  int16_t dx;          //BGxPA
+  int16_t dmx;         //BGxPB
+  int16_t dy;          //BGxPC
+  int16_t dmy;         //BGxPD
+};
+
+struct PPUState
+{
+  uint16_t dispCnt;
+  PPUBackground bg[4];
+
+  uint8_t win0x1, win0x2, win0y1, win0y2; //Clamped to the screen
+  uint8_t win1x1, win1x2, win1y1, win1y2;
+  uint8_t win0Enabled, win1Enabled, winObjEnabled, winOutEnabled;
+  bool winEnabled;
+
+  uint8_t blendSource, blendTarget;
+  uint8_t blendA, blendB, blendY;         //Clamped to 0x10
+  int32_t blendType;
+};
+
+//Wait State Table, [region][width][sequential]
+#define WAIT_16 0 //8 and 16 bit accesses
+#define WAIT_32 1
+#define WAIT_N 0  //Non-sequential
+#define WAIT_S 1  //Sequential
+
+//Dirty Tracking, one bit per block
+#define VRAM_DIRTY_BLOCK 32 //Bytes per VRAM block, one 4bpp tile
+#define PAL_DIRTY_BLOCK 2   //Bytes per palette block, one colour
+#define OAM_DIRTY_BLOCK 8   //Bytes per OAM block, one object
+#define VRAM_DIRTY_WORDS (((vRamMask + 1) / VRAM_DIRTY_BLOCK) / 32)
+#define PAL_DIRTY_WORDS (((palRamMask + 1) / PAL_DIRTY_BLOCK) / 32)
+#define OAM_DIRTY_WORDS (((oamRamMask + 1) / OAM_DIRTY_BLOCK) / 32)
+
+#define DIRTY_VRAM 0x01
+#define DIRTY_PAL 0x02
+#define DIRTY_OAM 0x04
+
+//Memory Access Statistics, counted per page, source, width and direction
+//#define MEMORY_STATS //Print the access table every MEMORY_STATS_FRAMES frames
+#define MEMORY_STATS_FRAMES 60
+
+#define ACCESS_CPU 0
+#define ACCESS_DMA 1
+#define ACCESS_RENDER 2
+#define ACCESS_SOURCES 3
+
+#define ACCESS_8 0
+#define ACCESS_16 1
+#define ACCESS_32 2
+#define ACCESS_SPAN 3 //Renderer block fetch
+#define ACCESS_WIDTHS 4
+
+#define ACCESS_READ 0
+#define ACCESS_WRITE 1
+
+//Handler set for SetPage, e.g. PAGE_HANDLERS(ReadIO, WriteIO)
+#define PAGE_HANDLERS(read, write) &Processor::read##8, &Processor::read##16, &Processor::read##32, &Processor::write##8, &Processor::write##16, &Processor::write##32
 
 class Processor
 {
@@ -163,9 +336,23 @@ class Processor
     int32_t bgx[2];
     int32_t bgy[2];
     bool cpuHalted = false;
-    uint8_t OAMRAM[0x3FF];
-    uint8_t IOREG[0x4FF];
+    uint8_t IWRAM[0x8000];
+    uint8_t PALRAM[0x400];
+    uint8_t OAMRAM[oamRamMask + 1];
+    uint8_t IOREG[ioRegMask + 1];
+    MemoryPage pages[PAGE_COUNT];
+    uint8_t waitStates[PAGE_COUNT][2][2]; //Total cycles per access, rebuilt from WAITCNT
+    uint32_t nextSeqAddress = 0;          //An access here continues the previous one
+    uint32_t vRamDirty[VRAM_DIRTY_WORDS];
+    uint32_t palRamDirty[PAL_DIRTY_WORDS];
+    uint32_t oamRamDirty[OAM_DIRTY_WORDS];
+    uint8_t dirtyRegions = 0;             //DIRTY_* bits written since the last ClearDirty
     uint16_t keyState = 0x3FF;
+    PPUState ppu;
+#ifdef MEMORY_STATS
+    uint32_t memStats[PAGE_COUNT][ACCESS_SOURCES][ACCESS_WIDTHS][2];
+    uint8_t accessSource = ACCESS_CPU; //Who the bus accessors are working for
+#endif
 
     //Methods
     Processor();
@@ -176,14 +363,17 @@ class Processor
     uint32_t GetWaitCycles();
     uint32_t GetSPSR();
     void SetSPSR(uint32_t value);
-    void SwapRegsHelper(uint32_t swapRegs[]);
+    void SwapRegsHelper(uint32_t swapRegs[], uint8_t swapRegsLength);
     void SwapRegisters(uint32_t bank);
     void WriteCpsr(uint32_t newCpsr);
     void EnterException(uint32_t mode, uint32_t vector, bool interruptDisabled, bool fiqDisabled);
     void RequestIrq(uint16_t irq);
     void FireIrq();
+    void EnterIrq();
+    void LeaveIrq();
     void Reset(bool skipBios);
     void Halt();
+    void IdleBranch(uint32_t flagsCpsr);
     void ReloadQueue();
     void UpdateTimer(uint16_t timer, uint32_t cycles, bool countUp);
     void UpdateTimers();
@@ -207,6 +397,9 @@ class Processor
     void WriteU8(uint32_t address, uint32_t RAMRange, uint8_t value);
     void WriteU16(uint32_t address, uint32_t RAMRange, uint16_t value);
     void WriteU32(uint32_t address, uint32_t RAMRange, uint32_t value);
+
+    template<Region R, typename T> T Read(uint32_t offset);
+    template<Region R> void ReadSpan(uint32_t offset, uint8_t *dst, uint32_t count);
     
     uint32_t ReadUnreadable();
     uint8_t ReadNop8(uint32_t address);
@@ -233,9 +426,9 @@ class Processor
     uint8_t ReadOamRam8(uint32_t address);
     uint16_t ReadOamRam16(uint32_t address);
     uint32_t ReadOamRam32(uint32_t address);
-    uint8_t  ReadROM8(uint32_t address, uint8_t bank);
-    uint16_t ReadROM16(uint32_t address, uint8_t bank);
-    uint32_t ReadROM32(uint32_t address, uint8_t bank);
+    uint8_t  ReadROM8(uint32_t address);
+    uint16_t ReadROM16(uint32_t address);
+    uint32_t ReadROM32(uint32_t address);
     uint8_t ReadSRam8(uint32_t address);
     uint16_t ReadSRam16(uint32_t address);
     uint32_t ReadSRam32(uint32_t address);
@@ -252,6 +445,22 @@ class Processor
     void WriteIO8(uint32_t address, uint8_t value);
     void WriteIO16(uint32_t address, uint16_t value);
     void WriteIO32(uint32_t address, uint32_t value);
+    void WriteIOHalf(uint32_t address, uint16_t value, uint16_t lanes);
+    uint16_t ReadIOKeys(uint32_t address, uint8_t param);
+    uint16_t ReadIODma(uint32_t address, uint8_t param);
+    uint16_t ReadIOTimer(uint32_t address, uint8_t param);
+    void WriteIORefPoint(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes);
+    void WriteIODma(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes);
+    void WriteIOTimer(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes);
+    void WriteIOFifoA(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes);
+    void WriteIOFifoB(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes);
+    void WriteIOSoundCnt(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes);
+    void WriteIOIf(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes);
+    void WriteIOWaitCnt(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes);
+    void WriteIOHalt(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes);
+    void WriteIOPpu(uint32_t address, uint8_t param, uint16_t oldValue, uint16_t value, uint16_t lanes);
+    void DecodePPU();
+    void DecodePPURegister(uint32_t address);
     void WritePalRam8(uint32_t address, uint8_t value);
     void WritePalRam16(uint32_t address, uint16_t value);
     void WritePalRam32(uint32_t address, uint32_t value);
@@ -295,159 +504,507 @@ class Processor
 
     void LoadCartridge();
     void ResetRomBanks();
-    
-    uint8_t ReadU8Funcs(uint16_t bank, uint32_t address);
-    uint16_t ReadU16Funcs(uint16_t bank, uint32_t address);
-    uint32_t ReadU32Funcs(uint16_t bank, uint32_t address);
 
-    void WriteU8Funcs(uint16_t bank, uint32_t address, uint8_t value);
-    void WriteU16Funcs(uint16_t bank, uint32_t address, uint16_t value);
-    void WriteU32Funcs(uint16_t bank, uint32_t address, uint32_t value);
+    void BuildPageTable();
+    void SetPage(uint8_t page, ReadU8Handler read8, ReadU16Handler read16, ReadU32Handler read32, WriteU8Handler write8, WriteU16Handler write16, WriteU32Handler write32);
+    void SetPagePointers(uint8_t page, uint8_t *readPtr, uint8_t *writePtr, uint32_t mask);
+    void TrackCodeWrites();
+    void BuildWaitStates();
+    void SetWaitStates(uint8_t page, uint8_t nonSeq16, uint8_t seq16, uint8_t nonSeq32, uint8_t seq32);
+    void AddWaitCycles(uint32_t address, uint8_t width, uint32_t size);
+
+    void CountAccess(uint32_t address, uint8_t width, uint8_t direction);
+    void CountRenderAccess(uint8_t page, uint8_t width);
+    void PrintMemoryStats();
+    void ResetMemoryStats();
+
+    void MarkDirty(uint32_t *bitmap, uint32_t first, uint32_t last, uint8_t region);
+    bool IsVRamDirty(uint32_t address);
+    bool IsPalRamDirty(uint32_t address);
+    bool IsOamRamDirty(uint32_t address);
+    uint8_t GetDirtyRegions();
+    void ClearDirty(uint8_t regions);
 };
 
-#ifdef __cplusplus
-extern "C" {
+//Called by the cores after a short backward branch, flagsCpsr is the CPSR with the current flags.
+//An idle loop gives up the rest of this Execute, and the CPU sleeps until something wakes it.
+inline void Processor::IdleBranch(uint32_t flagsCpsr)
+{
+  if(idleLoop.Branch(registers, flagsCpsr) && Cycles > 0)
+  {
+    idleLoop.cyclesSkipped += Cycles;
+    Cycles = 0;
+  }
+}
+
+inline void Processor::AddWaitCycles(uint32_t address, uint8_t width, uint32_t size)
+{
+  waitCycles += waitStates[(address >> 24) & 0xF][width][address == nextSeqAddress];
+  nextSeqAddress = address + size;
+}
+
+//Compiled out unless MEMORY_STATS is defined
+inline void Processor::CountAccess(uint32_t address, uint8_t width, uint8_t direction)
+{
+#ifdef MEMORY_STATS
+  memStats[(address >> 24) & 0xF][accessSource][width][direction]++;
 #endif
+}
 
-static inline void SetAddress(uint32_t value)
+inline void Processor::CountRenderAccess(uint8_t page, uint8_t width)
 {
-  //Pin assignments are going to have to change in order to acheive maximum speed...
-  //Memory Address Time Ran: 0.42us
-  //Memory Address Time Seq: 0.40us
-  
-  //           BITMASK       PORTSET       PORTCLR
-  // ADD0 0   //(1 << 16)    GPIOB_PSOR    GPIOB_PCOR
-  // ADD1 1   //(1 << 17)    GPIOB_PSOR    GPIOB_PCOR
-  // ADD2 24  //(1 << 26)    GPIOE_PSOR    GPIOE_PCOR
-  // ADD3 25  //(1 << 5)     GPIOA_PSOR    GPIOA_PCOR
-  // ADD4 31  //(1 << 10)    GPIOB_PSOR    GPIOB_PCOR
-  // ADD5 32  //(1 << 11)    GPIOB_PSOR    GPIOB_PCOR
-  // ADD6 40  //(1 << 28)    GPIOA_PSOR    GPIOA_PCOR
-  // ADD7 41  //(1 << 29)    GPIOA_PSOR    GPIOA_PCOR 
-  // ADD8 42  //(1 << 26)    GPIOA_PSOR    GPIOA_PCOR 
-  // ADD9 43  //(1 << 20)    GPIOB_PSOR    GPIOB_PCOR
-  // ADD10 44 //(1 << 22)    GPIOB_PSOR    GPIOB_PCOR
-  // ADD11 45 //(1 << 23)    GPIOB_PSOR    GPIOB_PCOR
-  // ADD12 46 //(1 << 21)    GPIOB_PSOR    GPIOB_PCOR
-  // ADD13 47 //(1 << 8)     GPIOD_PSOR    GPIOD_PCOR 
-  // ADD14 48 //(1 << 9)     GPIOD_PSOR    GPIOD_PCOR 
-  // ADD15 49 //(1 << 4)     GPIOB_PSOR    GPIOB_PCOR
-  // ADD16 50 //(1 << 5)     GPIOB_PSOR    GPIOB_PCOR 
-  // ADD17 51 //(1 << 14)    GPIOD_PSOR    GPIOD_PCOR
-  // ADD18 52 //(1 << 13)    GPIOD_PSOR    GPIOD_PCOR
-
-  //GPIOB
-  //Bit   24 23 22 21 20 19 18 17 16 15 14 13 12 11 10 9  8  7  6  5  4  3  2  1  0
-  //Pin   -  45 44 46 43 -  -  1  0  -  -  -  -  32 31 -  -  -  -  50 49 -  -  -  -
-  //Add   -  11 10 12 9  -  -  1  0  -  -  -  -  5  4  -  -  -  -  16 15 -  -  -  -
-
-  //GPIOA
-  //Bit   32 31 30 29 28 27 26 25 24 23 22 21 20 19 18 17 16 15 14 13 12 11 10 9  8  7  6  5  4  3  2  1  0
-  //Pin   -  -  -  41 40 -  42 -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  25 -  -  -  -  -
-  //Add   -  -  -  7  6  -  8  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  3  -  -  -  -  -
-
-  //GPIOD
-  //Bit   16 15 14 13 12 11 10 9  8  7  6  5  4  3  2  1  0
-  //Pin   -  -  51 52 -  -  -  48 47 -  -  -  -  -  -  -  -
-  //Add   -  -  17 18 -  -  -  14 13 -  -  -  -  -  -  -  -
-
-  //GPIOE
-  //Bit   32 31 30 29 28 27 26 25 24 23 22 21 20 19 18 17 16 15 14 13 12 11 10 9  8  7  6  5  4  3  2  1  0
-  //Pin   -  -  -  -  -  -  24 -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -
-  //Add   -  -  -  -  -  -  2  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -
-
-  //---------------------------Port B--------------------------------//
-  
-  GPIOB_PCOR |= 12782640; //Clear Address Lines On Port B
-  GPIOB_PSOR |= ((value & 0x03) << 16); //Set Address 0 & 1
-  GPIOB_PSOR |= (((value >> 4) & 0x03) << 10); //Set Address 4 & 5
-  GPIOB_PSOR |= (((value >> 10) & 0x03) << 22); //Set Address 10 & 11
-  GPIOB_PSOR |= (((value >> 15) & 0x03) << 4); //Set Address 15 & 16
+#ifdef MEMORY_STATS
+  memStats[page][ACCESS_RENDER][width][ACCESS_READ]++;
+#endif
+}
 
-  if(((value >> 9) & 0x01)) //ADD9
-  {
-    GPIOB_PSOR = (1 << 20);
-  }
-  else
+inline void Processor::MarkDirty(uint32_t *bitmap, uint32_t first, uint32_t last, uint8_t region)
+{
+  for(uint32_t i = first; i <= last; i++)
   {
-    GPIOB_PCOR = (1 << 20);
+    bitmap[i >> 5] |= (1U << (i & 31));
   }
 
-  if(((value >> 12) & 0x01)) //ADD12
-  {
-    GPIOB_PSOR = (1 << 21);
-  }
-  else
+  dirtyRegions |= region;
+}
+
+//Addresses are offsets into each region, as used with the RAMRange accessors
+inline bool Processor::IsVRamDirty(uint32_t address)
+{
+  uint32_t block = address / VRAM_DIRTY_BLOCK;
+  return (vRamDirty[block >> 5] & (1U << (block & 31))) != 0;
+}
+
+inline bool Processor::IsPalRamDirty(uint32_t address)
+{
+  uint32_t block = address / PAL_DIRTY_BLOCK;
+  return (palRamDirty[block >> 5] & (1U << (block & 31))) != 0;
+}
+
+inline bool Processor::IsOamRamDirty(uint32_t address)
+{
+  uint32_t block = address / OAM_DIRTY_BLOCK;
+  return (oamRamDirty[block >> 5] & (1U << (block & 31))) != 0;
+}
+
+inline uint8_t Processor::GetDirtyRegions()
+{
+  return dirtyRegions;
+}
+
+//CPU bus accessors, wait states come from the table and pages backed by internal RAM are served inline,
+//everything else goes to the page handlers
+inline uint8_t Processor::ReadU8(uint32_t address)
+{
+  AddWaitCycles(address, WAIT_16, 1);
+  CountAccess(address, ACCESS_8, ACCESS_READ);
+  MemoryPage *page = &pages[(address >> 24) & 0xF];
+
+  if(page->readPtr != NULL)
   {
-    GPIOB_PCOR = (1 << 21);
+    return page->readPtr[address & page->mask];
   }
-  
-  //---------------------------Port A--------------------------------//
 
-  GPIOA_PCOR |= 805306368; //Clear Address Lines On Port A
-  GPIOA_PSOR |= (((value >> 6) & 0x03) << 28); //Set Address 6 & 7
+  return (this->*page->read8)(address);
+}
+
+inline uint16_t Processor::ReadU16(uint32_t address)
+{
+  address &= ~1U;
+  AddWaitCycles(address, WAIT_16, 2);
+  CountAccess(address, ACCESS_16, ACCESS_READ);
+  MemoryPage *page = &pages[(address >> 24) & 0xF];
 
-  if(((value >> 3) & 0x01)) //ADD3
+  if(page->readPtr != NULL)
   {
-    GPIOA_PSOR = (1 << 5);
+    uint8_t *ptr = &page->readPtr[address & page->mask];
+    return (uint16_t)(ptr[0] | (ptr[1] << 8));
   }
-  else
+
+  return (this->*page->read16)(address);
+}
+
+inline uint32_t Processor::ReadU32Aligned(uint32_t address)
+{
+  AddWaitCycles(address, WAIT_32, 4);
+  CountAccess(address, ACCESS_32, ACCESS_READ);
+  MemoryPage *page = &pages[(address >> 24) & 0xF];
+
+  if(page->readPtr != NULL)
   {
-    GPIOA_PCOR = (1 << 5);
+    uint8_t *ptr = &page->readPtr[address & page->mask];
+    return (uint32_t)(ptr[0] | (ptr[1] << 8) | (ptr[2] << 16) | (ptr[3] << 24));
   }
-    
-  if(((value >> 8) & 0x01)) //ADD8
+
+  return (this->*page->read32)(address);
+}
+
+inline uint32_t Processor::ReadU32(uint32_t address)
+{
+  uint32_t shiftAmt = (int)((address & 3U) << 3);
+  uint32_t res = ReadU32Aligned(address & ~3U);
+  return (res >> shiftAmt) | (res << (32 - shiftAmt));
+}
+
+inline void Processor::WriteU8(uint32_t address, uint8_t value)
+{
+  AddWaitCycles(address, WAIT_16, 1);
+  CountAccess(address, ACCESS_8, ACCESS_WRITE);
+  idleLoop.writes++;
+  MemoryPage *page = &pages[(address >> 24) & 0xF];
+
+  if(page->writePtr != NULL)
   {
-    GPIOA_PSOR = (1 << 26);
+    page->writePtr[address & page->mask] = value;
+    return;
   }
-  else
+
+  (this->*page->write8)(address, value);
+}
+
+inline void Processor::WriteU16(uint32_t address, uint16_t value)
+{
+  address &= ~1U;
+  AddWaitCycles(address, WAIT_16, 2);
+  CountAccess(address, ACCESS_16, ACCESS_WRITE);
+  idleLoop.writes++;
+  MemoryPage *page = &pages[(address >> 24) & 0xF];
+
+  if(page->writePtr != NULL)
   {
-    GPIOA_PCOR = (1 << 26);
+    uint8_t *ptr = &page->writePtr[address & page->mask];
+    ptr[0] = (uint8_t)(value & 0xFF);
+    ptr[1] = (uint8_t)(value >> 8);
+    return;
   }
 
-  //---------------------------Port D--------------------------------//
-  GPIOD_PCOR |= 3840; //Clear Address Lines On Port D
-  GPIOD_PSOR |= (((value >> 13) & 0x03) << 8); //Set Address 13 & 14
+  (this->*page->write16)(address, value);
+}
+
+inline void Processor::WriteU32(uint32_t address, uint32_t value)
+{
+  address &= ~3U;
+  AddWaitCycles(address, WAIT_32, 4);
+  CountAccess(address, ACCESS_32, ACCESS_WRITE);
+  idleLoop.writes++;
+  MemoryPage *page = &pages[(address >> 24) & 0xF];
 
-  if(((value >> 17) & 0x01)) //ADD17
+  if(page->writePtr != NULL)
   {
-    GPIOD_PSOR = (1 << 14);
+    uint8_t *ptr = &page->writePtr[address & page->mask];
+    ptr[0] = (uint8_t)(value & 0xFF);
+    ptr[1] = (uint8_t)((value >> 8) & 0xFF);
+    ptr[2] = (uint8_t)((value >> 16) & 0xFF);
+    ptr[3] = (uint8_t)(value >> 24);
+    return;
   }
-  else
+
+  (this->*page->write32)(address, value);
+}
+
+//Backing store of each Region, internal arrays or an external SRAM range
+template<Region R> struct RegionStore;
+
+template<> struct RegionStore<Region::EWRAM>
+{
+  static const uint8_t Page = 0x2;
+  static const bool Internal = false;
+  static const uint32_t Start = ewRamStart;
+  static uint8_t *Data(Processor *p) { return NULL; }
+};
+
+template<> struct RegionStore<Region::VRAM>
+{
+  static const uint8_t Page = 0x6;
+  static const bool Internal = false;
+  static const uint32_t Start = vRamStart;
+  static uint8_t *Data(Processor *p) { return NULL; }
+};
+
+template<> struct RegionStore<Region::IWRAM>
+{
+  static const uint8_t Page = 0x3;
+  static const bool Internal = true;
+  static const uint32_t Start = iwRamStart;
+  static uint8_t *Data(Processor *p) { return p->IWRAM; }
+};
+
+template<> struct RegionStore<Region::IO>
+{
+  static const uint8_t Page = 0x4;
+  static const bool Internal = true;
+  static const uint32_t Start = ioRegStart;
+  static uint8_t *Data(Processor *p) { return p->IOREG; }
+};
+
+template<> struct RegionStore<Region::PAL>
+{
+  static const uint8_t Page = 0x5;
+  static const bool Internal = true;
+  static const uint32_t Start = palRamStart;
+  static uint8_t *Data(Processor *p) { return p->PALRAM; }
+};
+
+template<> struct RegionStore<Region::OAM>
+{
+  static const uint8_t Page = 0x7;
+  static const bool Internal = true;
+  static const uint32_t Start = oamRamStart;
+  static uint8_t *Data(Processor *p) { return p->OAMRAM; }
+};
+
+template<typename T> T ReadLittleEndian(const uint8_t *ptr);
+template<typename T> T ReadSRAM(uint32_t address);
+
+template<> inline uint8_t ReadLittleEndian<uint8_t>(const uint8_t *ptr)
+{
+  return ptr[0];
+}
+
+template<> inline uint16_t ReadLittleEndian<uint16_t>(const uint8_t *ptr)
+{
+  return (uint16_t)(ptr[0] | (ptr[1] << 8));
+}
+
+template<> inline uint32_t ReadLittleEndian<uint32_t>(const uint8_t *ptr)
+{
+  return (uint32_t)(ptr[0] | (ptr[1] << 8) | (ptr[2] << 16) | (ptr[3] << 24));
+}
+
+template<> inline uint8_t ReadSRAM<uint8_t>(uint32_t address)
+{
+  return sramCache.Read8(address);
+}
+
+template<> inline uint16_t ReadSRAM<uint16_t>(uint32_t address)
+{
+  return sramCache.Read16(address);
+}
+
+template<> inline uint32_t ReadSRAM<uint32_t>(uint32_t address)
+{
+  return sramCache.Read32(address);
+}
+
+//Renderer reads, e.g. Read<Region::VRAM, uint16_t>(offset), no RAMRange comparisons or wait states
+template<Region R, typename T> inline T Processor::Read(uint32_t offset)
+{
+  CountRenderAccess(RegionStore<R>::Page, sizeof(T) >> 1);
+
+  if(RegionStore<R>::Internal)
   {
-    GPIOD_PCOR = (1 << 14);
+    return ReadLittleEndian<T>(RegionStore<R>::Data(this) + offset);
   }
 
-  if(((value >> 18) & 0x01)) //ADD18
+  return ReadSRAM<T>(RegionStore<R>::Start + offset);
+}
+
+//Copies count bytes starting at offset, used to fetch a whole tile, map or bitmap row at once
+template<Region R> inline void Processor::ReadSpan(uint32_t offset, uint8_t *dst, uint32_t count)
+{
+  CountRenderAccess(RegionStore<R>::Page, ACCESS_SPAN);
+
+  if(RegionStore<R>::Internal)
   {
-    GPIOD_PSOR = (1 << 13);
+    memcpy(dst, RegionStore<R>::Data(this) + offset, count);
+    return;
   }
-  else
+
+  sramCache.ReadBlock(RegionStore<R>::Start + offset, dst, count);
+}
+
+//SRAM Pin Map
+#define SRAM_PORT_A 0
+#define SRAM_PORT_B 1
+#define SRAM_PORT_C 2
+#define SRAM_PORT_D 3
+#define SRAM_PORT_E 4
+#define SRAM_PORT_COUNT 5
+
+struct SRAMPin
+{
+  uint8_t port;
+  uint8_t bit;
+};
+
+//           BITMASK       PORTSET       PORTCLR
+// ADD0 0   //(1 << 16)    GPIOB_PSOR    GPIOB_PCOR
+// ADD1 1   //(1 << 17)    GPIOB_PSOR    GPIOB_PCOR
+// ADD2 24  //(1 << 26)    GPIOE_PSOR    GPIOE_PCOR
+// ADD3 25  //(1 << 5)     GPIOA_PSOR    GPIOA_PCOR
+// ADD4 31  //(1 << 10)    GPIOB_PSOR    GPIOB_PCOR
+// ADD5 32  //(1 << 11)    GPIOB_PSOR    GPIOB_PCOR
+// ADD6 40  //(1 << 28)    GPIOA_PSOR    GPIOA_PCOR
+// ADD7 41  //(1 << 29)    GPIOA_PSOR    GPIOA_PCOR 
+// ADD8 42  //(1 << 26)    GPIOA_PSOR    GPIOA_PCOR 
+// ADD9 43  //(1 << 20)    GPIOB_PSOR    GPIOB_PCOR
+// ADD10 44 //(1 << 22)    GPIOB_PSOR    GPIOB_PCOR
+// ADD11 45 //(1 << 23)    GPIOB_PSOR    GPIOB_PCOR
+// ADD12 46 //(1 << 21)    GPIOB_PSOR    GPIOB_PCOR
+// ADD13 47 //(1 << 8)     GPIOD_PSOR    GPIOD_PCOR 
+// ADD14 48 //(1 << 9)     GPIOD_PSOR    GPIOD_PCOR 
+// ADD15 49 //(1 << 4)     GPIOB_PSOR    GPIOB_PCOR
+// ADD16 50 //(1 << 5)     GPIOB_PSOR    GPIOB_PCOR 
+// ADD17 51 //(1 << 14)    GPIOD_PSOR    GPIOD_PCOR
+// ADD18 52 //(1 << 13)    GPIOD_PSOR    GPIOD_PCOR
+
+//GPIOB
+//Bit   24 23 22 21 20 19 18 17 16 15 14 13 12 11 10 9  8  7  6  5  4  3  2  1  0
+//Pin   -  45 44 46 43 -  -  1  0  -  -  -  -  32 31 -  -  -  -  50 49 -  -  -  -
+//Add   -  11 10 12 9  -  -  1  0  -  -  -  -  5  4  -  -  -  -  16 15 -  -  -  -
+
+//GPIOA
+//Bit   32 31 30 29 28 27 26 25 24 23 22 21 20 19 18 17 16 15 14 13 12 11 10 9  8  7  6  5  4  3  2  1  0
+//Pin   -  -  -  41 40 -  42 -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  25 -  -  -  -  -
+//Add   -  -  -  7  6  -  8  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  3  -  -  -  -  -
+
+//GPIOD
+//Bit   16 15 14 13 12 11 10 9  8  7  6  5  4  3  2  1  0
+//Pin   -  -  51 52 -  -  -  48 47 -  -  -  -  -  -  -  -
+//Add   -  -  17 18 -  -  -  14 13 -  -  -  -  -  -  -  -
+
+//GPIOE
+//Bit   32 31 30 29 28 27 26 25 24 23 22 21 20 19 18 17 16 15 14 13 12 11 10 9  8  7  6  5  4  3  2  1  0
+//Pin   -  -  -  -  -  -  24 -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -
+//Add   -  -  -  -  -  -  2  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -  -
+
+constexpr SRAMPin SRAMAddressPins[19] =
+{
+  { SRAM_PORT_B, 16 }, { SRAM_PORT_B, 17 }, { SRAM_PORT_E, 26 }, { SRAM_PORT_A, 5 },  //ADD0 - ADD3
+  { SRAM_PORT_B, 10 }, { SRAM_PORT_B, 11 }, { SRAM_PORT_A, 28 }, { SRAM_PORT_A, 29 }, //ADD4 - ADD7
+  { SRAM_PORT_A, 26 }, { SRAM_PORT_B, 20 }, { SRAM_PORT_B, 22 }, { SRAM_PORT_B, 23 }, //ADD8 - ADD11
+  { SRAM_PORT_B, 21 }, { SRAM_PORT_D, 8 },  { SRAM_PORT_D, 9 },  { SRAM_PORT_B, 4 },  //ADD12 - ADD15
+  { SRAM_PORT_B, 5 },  { SRAM_PORT_D, 14 }, { SRAM_PORT_D, 13 }                       //ADD16 - ADD18
+};
+
+//           BITMASK       PORT
+// DIO0 2   //(1 << 0)     GPIOD
+// DIO1 3   //(1 << 12)    GPIOA
+// DIO2 4   //(1 << 13)    GPIOA
+// DIO3 5   //(1 << 7)     GPIOD
+// DIO4 6   //(1 << 4)     GPIOD
+// DIO5 7   //(1 << 2)     GPIOD
+// DIO6 8   //(1 << 3)     GPIOD
+// DIO7 9   //(1 << 3)     GPIOC
+
+constexpr SRAMPin SRAMDataPins[8] =
+{
+  { SRAM_PORT_D, 0 }, { SRAM_PORT_A, 12 }, { SRAM_PORT_A, 13 }, { SRAM_PORT_D, 7 }, //DIO0 - DIO3
+  { SRAM_PORT_D, 4 }, { SRAM_PORT_D, 2 },  { SRAM_PORT_D, 3 },  { SRAM_PORT_C, 3 }  //DIO4 - DIO7
+};
+
+//Port bits driven by pins[first] to pins[first + count - 1]
+constexpr uint32_t SRAMPinMask(const SRAMPin *pins, uint32_t first, uint32_t count, uint8_t port)
+{
+  uint32_t mask = 0;
+  for(uint32_t i = first; i < first + count; i++)
   {
-    GPIOD_PCOR = (1 << 13);
+    if(pins[i].port == port)
+    {
+      mask |= (1U << pins[i].bit);
+    }
   }
+  return mask;
+}
 
-  //---------------------------Port E--------------------------------//
+//PSOR mask per port for every value of one byte of the address/data bus,
+//the matching PCOR mask is the byte's SRAMPinMask with these bits removed
+struct SRAMByteTable
+{
+  uint32_t set[256][SRAM_PORT_COUNT];
+};
 
-  if(((value >> 2) & 0x01)) //ADD2
+constexpr SRAMByteTable MakeSRAMByteTable(const SRAMPin *pins, uint32_t first, uint32_t count)
+{
+  SRAMByteTable table = {};
+  for(uint32_t value = 0; value < 256; value++)
   {
-    GPIOE_PSOR = (1 << 26);
+    for(uint32_t i = 0; i < count; i++)
+    {
+      if(((value >> i) & 0x01))
+      {
+        table.set[value][pins[first + i].port] |= (1U << pins[first + i].bit);
+      }
+    }
   }
-  else
+  return table;
+}
+
+//Generated in GBA_Arm7.cpp, [0] = ADD0 - ADD7, [1] = ADD8 - ADD15, [2] = ADD16 - ADD18
+extern const SRAMByteTable SRAMAddressTable[3];
+extern const SRAMByteTable SRAMDataTable;
+
+#define SRAM_ADDRESS_MASK(port) SRAMPinMask(SRAMAddressPins, 0, 19, port)
+#define SRAM_ADDRESS_LO_MASK(port) SRAMPinMask(SRAMAddressPins, 0, 8, port)
+#define SRAM_DATA_MASK(port) SRAMPinMask(SRAMDataPins, 0, 8, port)
+
+//#define SRAM_HOST_MODEL //Run the SRAM functions below against the counting bus model in GBA_SRAMModel.h, Linux only (host/Makefile)
+
+#ifdef SRAM_HOST_MODEL
+#include "GBA_SRAMModel.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline void SetAddress(uint32_t value)
+{
+#ifdef SRAM_HOST_MODEL
+  sramModel.AddressUpdate(true);
+#endif
+
+  //Three table loads per port, no branches
+  const uint32_t *lo = SRAMAddressTable[0].set[value & 0xFF];
+  const uint32_t *mid = SRAMAddressTable[1].set[(value >> 8) & 0xFF];
+  const uint32_t *hi = SRAMAddressTable[2].set[(value >> 16) & 0xFF];
+  uint32_t set;
+
+  set = lo[SRAM_PORT_B] | mid[SRAM_PORT_B] | hi[SRAM_PORT_B];
+  GPIOB_PSOR = set;
+  GPIOB_PCOR = SRAM_ADDRESS_MASK(SRAM_PORT_B) & ~set;
+
+  set = lo[SRAM_PORT_A] | mid[SRAM_PORT_A] | hi[SRAM_PORT_A];
+  GPIOA_PSOR = set;
+  GPIOA_PCOR = SRAM_ADDRESS_MASK(SRAM_PORT_A) & ~set;
+
+  set = lo[SRAM_PORT_D] | mid[SRAM_PORT_D] | hi[SRAM_PORT_D];
+  GPIOD_PSOR = set;
+  GPIOD_PCOR = SRAM_ADDRESS_MASK(SRAM_PORT_D) & ~set;
+
+  set = lo[SRAM_PORT_E] | mid[SRAM_PORT_E] | hi[SRAM_PORT_E];
+  GPIOE_PSOR = set;
+  GPIOE_PCOR = SRAM_ADDRESS_MASK(SRAM_PORT_E) & ~set;
+}
+
+//Only the address lines in "changed" are driven, used when stepping through sequential addresses
+static inline void UpdateAddress(uint32_t value, uint32_t changed)
+{
+  if((changed & ~0xFFU) != 0) //Carry past ADD7, rewrite everything
   {
-    GPIOE_PCOR = (1 << 26);
+    SetAddress(value);
+    return;
   }
+
+#ifdef SRAM_HOST_MODEL
+  sramModel.AddressUpdate(false);
+#endif
+
+  const uint32_t *lo = SRAMAddressTable[0].set[value & 0xFF];
+
+  GPIOB_PSOR = lo[SRAM_PORT_B];
+  GPIOB_PCOR = SRAM_ADDRESS_LO_MASK(SRAM_PORT_B) & ~lo[SRAM_PORT_B];
+  GPIOA_PSOR = lo[SRAM_PORT_A];
+  GPIOA_PCOR = SRAM_ADDRESS_LO_MASK(SRAM_PORT_A) & ~lo[SRAM_PORT_A];
+  GPIOE_PSOR = lo[SRAM_PORT_E];
+  GPIOE_PCOR = SRAM_ADDRESS_LO_MASK(SRAM_PORT_E) & ~lo[SRAM_PORT_E];
 }
 
-static uint8_t AccessMode = 2;
+extern uint8_t AccessMode; //0 = Read, 1 = Write, 2 = Unknown
+extern uint32_t SRAMTurnarounds; //Data bus direction changes
 
-static inline void SPIRAMWrite(uint32_t address, uint8_t value)
+static inline void SPIRAMDataOutput()
 {
-  SetAddress(address);
-  
-  GPIOB_PCOR = (1 << 18); //WE LOW
-  GPIOB_PSOR = (1 << 19); //OE HIGH
-
   if(AccessMode != 1) //Write pinMode(OUTPUT);
   {
     *portModeRegister(2) = 1; //IO 0
@@ -459,63 +1016,12 @@ static inline void SPIRAMWrite(uint32_t address, uint8_t value)
     *portModeRegister(8) = 1; //IO 6
     *portModeRegister(9) = 1; //IO 7
     AccessMode = 1;
+    SRAMTurnarounds++;
   }
-
-  if((value & 0x01)) //DIO0
-  {
-    GPIOD_PSOR = (1 << 0);
-  }
-  else
-  {
-    GPIOD_PCOR = (1 << 0);
-  }
-
-  GPIOA_PCOR |= 12288; //Clear PORTA Data Lines
-  GPIOA_PSOR |= (((value >> 1) & 0x03) << 12); //DIO1 & DIO2
-
-  if(((value >> 3) & 0x01)) //DIO3
-  {
-    GPIOD_PSOR = (1 << 7);
-  }
-  else
-  {
-    GPIOD_PCOR = (1 << 7);
-  }
-
-  if(((value >> 4) & 0x01)) //DIO4
-  {
-    GPIOD_PSOR = (1 << 4);
-  }
-  else
-  {
-    GPIOD_PCOR = (1 << 4);
-  }
-
-  GPIOD_PCOR |= 12; //Clear PORTD Data Lines
-  GPIOD_PSOR |= (((value >> 5) & 0x03) << 2); //DIO5 & DIO6
-
-  if(((value >> 7) & 0x01)) //DIO7
-  {
-    GPIOC_PSOR = (1 << 3);
-  }
-  else
-  {
-    GPIOC_PCOR = (1 << 3);
-  }
-
-  //Back to Read
-  GPIOB_PSOR = (1 << 18); //WE HIGH
 }
 
-static inline uint8_t SPIRAMRead(uint32_t address)
+static inline void SPIRAMDataInput()
 {
-  SetAddress(address);
-
-  GPIOB_PSOR = (1 << 18); //WE HIGH
-  GPIOB_PCOR = (1 << 19); //OE LOW
-
-  uint8_t value;
-
   if(AccessMode != 0) //Read pinMode(INPUT);
   {
     *portModeRegister(2) = 0; //IO 0
@@ -527,19 +1033,110 @@ static inline uint8_t SPIRAMRead(uint32_t address)
     *portModeRegister(8) = 0; //IO 6
     *portModeRegister(9) = 0; //IO 7
     AccessMode = 0;
+    SRAMTurnarounds++;
   }
+}
+
+static inline void SPIRAMPutData(uint8_t value)
+{
+  const uint32_t *set = SRAMDataTable.set[value];
+
+  GPIOD_PSOR = set[SRAM_PORT_D];
+  GPIOD_PCOR = SRAM_DATA_MASK(SRAM_PORT_D) & ~set[SRAM_PORT_D];
+  GPIOA_PSOR = set[SRAM_PORT_A];
+  GPIOA_PCOR = SRAM_DATA_MASK(SRAM_PORT_A) & ~set[SRAM_PORT_A];
+  GPIOC_PSOR = set[SRAM_PORT_C];
+  GPIOC_PCOR = SRAM_DATA_MASK(SRAM_PORT_C) & ~set[SRAM_PORT_C];
+}
 
+static inline uint8_t SPIRAMGetData()
+{
   //Read IO Pins
+  uint8_t value;
   value = (GPIOD_PDIR & (1 << 0) ? 1 : 0);            //DIO0
   value |= (((GPIOA_PDIR >> 12) & 0x03) << 1);        //DIO1 & DIO2
   value |= ((GPIOD_PDIR & (1 << 7) ? 1 : 0) << 3);    //DIO3
   value |= ((GPIOD_PDIR & (1 << 4) ? 1 : 0) << 4);    //DIO4
   value |= (((GPIOD_PDIR >> 2) & 0x03) << 5);         //DIO5 & DIO6
   value |= ((GPIOC_PDIR & (1 << 3) ? 1 : 0) << 7);    //DIO7
-  
   return value;
 }
 
+static inline void SPIRAMWrite(uint32_t address, uint8_t value)
+{
+  SetAddress(address);
+  
+  GPIOB_PCOR = (1 << 18); //WE LOW
+  GPIOB_PSOR = (1 << 19); //OE HIGH
+
+  SPIRAMDataOutput();
+  SPIRAMPutData(value);
+
+  //Back to Read
+  GPIOB_PSOR = (1 << 18); //WE HIGH
+}
+
+static inline uint8_t SPIRAMRead(uint32_t address)
+{
+  SetAddress(address);
+
+  GPIOB_PSOR = (1 << 18); //WE HIGH
+  GPIOB_PCOR = (1 << 19); //OE LOW
+
+  SPIRAMDataInput();
+  
+  return SPIRAMGetData();
+}
+
+//Sequential reads: full address once, then only the low address lines that change.
+//The bus stays in input mode for the whole burst.
+static inline void SPIRAMReadBurst(uint32_t address, uint8_t *dst, uint32_t count)
+{
+  if(count == 0) return;
+
+  SetAddress(address);
+
+  GPIOB_PSOR = (1 << 18); //WE HIGH
+  GPIOB_PCOR = (1 << 19); //OE LOW
+
+  SPIRAMDataInput();
+
+  dst[0] = SPIRAMGetData();
+
+  for(uint32_t i = 1; i < count; i++)
+  {
+    address++;
+    UpdateAddress(address, address ^ (address - 1));
+    dst[i] = SPIRAMGetData();
+  }
+}
+
+//Sequential writes: full address once, then only the low address lines that change.
+//The bus stays in output mode for the whole burst, WE is pulsed per byte.
+static inline void SPIRAMWriteBurst(uint32_t address, const uint8_t *src, uint32_t count)
+{
+  if(count == 0) return;
+
+  SetAddress(address);
+
+  GPIOB_PSOR = (1 << 19); //OE HIGH
+
+  SPIRAMDataOutput();
+
+  for(uint32_t i = 0; i < count; i++)
+  {
+    if(i != 0)
+    {
+      address++;
+      UpdateAddress(address, address ^ (address - 1));
+    }
+
+    GPIOB_PCOR = (1 << 18); //WE LOW
+    SPIRAMPutData(src[i]);
+    GPIOB_PSOR = (1 << 18); //WE HIGH
+  }
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -24,6 +24,7 @@
 
 #include "GBA_ArmCore.h"
 #include "GBA_Arm7.h"
+#include "GBA_BiosHle.h"
 
 #define SHIFT_LSL 0
 #define SHIFT_LSR 1
@@ -51,6 +52,49 @@ ArmCore::ArmCore(class Processor *par)
   parent = par;
 }
 
+//Rebuild instruction bits 27-20 and 7-4 from a handler table index
+constexpr uint32_t ArmFixedBits(uint32_t op)
+{
+  return ((op & 0xFF0) << 16) | ((op & 0xF) << 4);
+}
+
+//Pick the handler for a table index, the bits a handler does not use are
+//masked off so each distinct handler is only instantiated once
+template <uint32_t op>
+constexpr ArmHandler ArmEntry()
+{
+  if (op < 0x200)
+  {
+    // Bits 7 and 4 set are multiply, swap and halfword transfers
+    if ((op & 0x9) == 0x9)
+    {
+      if ((op & 0x6) == 0) return &ArmCore::MultiplyOrSwap<op & 0x1F0>;
+      return &ArmCore::LoadStoreHalfword<op & 0x1F6>;
+    }
+    return &ArmCore::DataProcessing<op & 0x1F7>;
+  }
+  if (op < 0x400) return &ArmCore::DataProcessingImmed<op & 0x1F0>;
+  if (op < 0x600) return &ArmCore::LoadStoreImmediate<op & 0x1F0>;
+  if (op < 0x800) return &ArmCore::LoadStoreRegister<op & 0x1F7>;
+  if (op < 0xA00) return &ArmCore::LoadStoreMultiple<op & 0x1F0>;
+  if (op < 0xC00) return &ArmCore::Branch<(op >> 8) & 0x1>;
+  if (op < 0xE00) return &ArmCore::CoprocessorLoadStore;
+  return &ArmCore::SoftwareInterrupt;
+}
+
+#define ARM_ENTRY_4(n) ArmEntry<(n)>(), ArmEntry<(n) + 1>(), ArmEntry<(n) + 2>(), ArmEntry<(n) + 3>()
+#define ARM_ENTRY_16(n) ARM_ENTRY_4(n), ARM_ENTRY_4((n) + 4), ARM_ENTRY_4((n) + 8), ARM_ENTRY_4((n) + 12)
+#define ARM_ENTRY_64(n) ARM_ENTRY_16(n), ARM_ENTRY_16((n) + 16), ARM_ENTRY_16((n) + 32), ARM_ENTRY_16((n) + 48)
+#define ARM_ENTRY_256(n) ARM_ENTRY_64(n), ARM_ENTRY_64((n) + 64), ARM_ENTRY_64((n) + 128), ARM_ENTRY_64((n) + 192)
+
+constexpr ArmHandler ArmHandlers[ARM_HANDLERS] =
+{
+  ARM_ENTRY_256(0x000), ARM_ENTRY_256(0x100), ARM_ENTRY_256(0x200), ARM_ENTRY_256(0x300),
+  ARM_ENTRY_256(0x400), ARM_ENTRY_256(0x500), ARM_ENTRY_256(0x600), ARM_ENTRY_256(0x700),
+  ARM_ENTRY_256(0x800), ARM_ENTRY_256(0x900), ARM_ENTRY_256(0xA00), ARM_ENTRY_256(0xB00),
+  ARM_ENTRY_256(0xC00), ARM_ENTRY_256(0xD00), ARM_ENTRY_256(0xE00), ARM_ENTRY_256(0xF00)
+};
+
 void ArmCore::BeginExecution()
 {
   FlushQueue();
@@ -60,100 +104,160 @@ void ArmCore::Execute()
 {
   UnpackFlags();
   thumbMode = false;
+
+  Block *block = NULL; //Block being recorded
   
   while(parent->Cycles > 0)
   {
-    curInstruction = instructionQueue;
-    
-    instructionQueue = parent->ReadU32Aligned(parent->registers[15]);
-    parent->registers[15] += 4;
-    
-    if((curInstruction >> 28) == COND_AL)
-    {
-      NormalOps((curInstruction >> 25) & 0x7);
-    }
-    else
+    uint32_t address = parent->registers[15] - 4;
+
+    if(block == NULL)
     {
-      uint32_t cond = 0;
-      switch(curInstruction >> 28)
+#ifdef NATIVE_IRQ
+      if(address == IRQ_RETURN)
       {
-        case COND_EQ: cond = zero; break;
-        case COND_NE: cond = 1 - zero; break;
-        case COND_CS: cond = carry; break;
-        case COND_CC: cond = 1 - carry; break;
-        case COND_MI: cond = negative; break;
-        case COND_PL: cond = 1 - negative; break;
-        case COND_VS: cond = overFlow; break;
-        case COND_VC: cond = 1 - overFlow; break;
-        case COND_HI: cond = carry & (1 - zero); break;
-        case COND_LS: cond = (1 - carry) | zero; break;
-        case COND_GE: cond = (1 - negative) ^ overFlow; break;
-        case COND_LT: cond = negative ^ overFlow; break;
-        case COND_GT: cond = (1 - zero) & (negative ^ (1 - overFlow)); break;
-        case COND_LE: cond = (negative ^ overFlow) | zero; break;
+        parent->LeaveIrq();
+        UnpackFlags();
+
+        if((parent->cpsr & parent->T_MASK) == parent->T_MASK)
+        {
+          break;
+        }
+        continue;
       }
+#endif
 
-      if(cond == 1)
+      // With the cache off this is the plain interpreter, nothing is looked up or recorded
+      if(blockCache.enabled)
       {
-        NormalOps((curInstruction >> 25) & 0x7);
+        Block *cached = blockCache.Find(address, BLOCK_ARM);
+
+        if(cached != NULL && cached->ops[0].instruction == instructionQueue)
+        {
+          ExecuteBlock(cached);
+
+          if(thumbMode)
+          {
+            parent->ReloadQueue();
+            break;
+          }
+          continue;
+        }
+
+        block = blockCache.Begin(address, BLOCK_ARM);
+        parent->TrackCodeWrites();
       }
     }
 
+    curInstruction = instructionQueue;
+    
+    instructionQueue = parent->ReadU32Aligned(parent->registers[15]);
+    parent->registers[15] += 4;
+
+    uint16_t handler = ARM_HANDLER(curInstruction);
+    uint32_t invalidations = blockCache.invalidations;
+
+    if(block != NULL)
+    {
+      block->ops[block->count].instruction = curInstruction;
+      block->ops[block->count].handler = handler;
+      block->count++;
+    }
+    
+    ExecuteOp(handler);
+
     parent->Cycles -= parent->GetWaitCycles();
+#ifdef BLOCK_CACHE_STATS
+    blockCache.executed++;
+#endif
     
     if(thumbMode)
     {
       parent->ReloadQueue();
       break;
     }
+
+    //Recording stops at a branch, a write to its own code, a full block or the end of the code page
+    if(block != NULL && (parent->registers[15] != address + 8 || blockCache.invalidations != invalidations || block->count == BLOCK_MAX_OPS || ((address + 4) & (BLOCK_PAGE_SIZE - 1)) == 0))
+    {
+      block = NULL;
+    }
   }
 
   PackFlags();
 }
 
-void ArmCore::NormalOps(uint8_t index)
+//Run a recorded block, the fetches come from the block but still charge their wait states.
+//Carries on into the linked block at its end, returns as soon as the flow leaves a block
+//anywhere else or there's no block to link to.
+void ArmCore::ExecuteBlock(Block *block)
 {
-  switch(index)
+  uint32_t invalidations = blockCache.invalidations;
+
+  while(true)
   {
-    case 0:
-      DataProcessing();
-      break;
-    case 1:
-      DataProcessingImmed();
-      break;
-    case 2:
-      LoadStoreImmediate();
-      break;
-    case 3:
-      LoadStoreRegister();
-      break;
-    case 4:
-      LoadStoreMultiple();
-      break;
-    case 5:
-      Branch();
-      break;
-    case 6:
-      CoprocessorLoadStore();
-      break;
-    case 7:
-      SoftwareInterrupt();
-      break;
+    for(uint32_t i = 0; i < block->count; i++)
+    {
+      uint32_t address = parent->registers[15];
+
+      curInstruction = block->ops[i].instruction;
+
+      if(i + 1 < block->count)
+      {
+        instructionQueue = block->ops[i + 1].instruction;
+        parent->AddWaitCycles(address, WAIT_32, 4);
+        parent->CountAccess(address, ACCESS_32, ACCESS_READ);
+      }
+      else
+      {
+        instructionQueue = parent->ReadU32Aligned(address);
+      }
+      parent->registers[15] += 4;
+
+      ExecuteOp(block->ops[i].handler);
+
+      parent->Cycles -= parent->GetWaitCycles();
+#ifdef BLOCK_CACHE_STATS
+      blockCache.executed++;
+#endif
+
+      if(thumbMode || blockCache.invalidations != invalidations || parent->Cycles <= 0 || (parent->registers[15] != address + 4 && i + 1 < block->count))
+      {
+        return;
+      }
+    }
+
+#ifdef BLOCK_LINKING
+    block = blockCache.Link(block, parent->registers[15] - 4, BLOCK_ARM);
+
+    if(block == NULL || block->ops[0].instruction != instructionQueue)
+    {
+      return;
+    }
+#else
+    return;
+#endif
   }
 }
 
-uint32_t ArmCore::BarrelShifter(uint32_t shifterOperand)
+//Run curInstruction through its handler if its condition passes
+void ArmCore::ExecuteOp(uint16_t handler)
 {
-  uint32_t type = (shifterOperand >> 5) & 0x3;
-
-  bool registerShift = (shifterOperand & (1 << 4)) == (1 << 4);
+  if((curInstruction >> 28) == COND_AL || flags.Passes(curInstruction >> 28))
+  {
+    (this->*ArmHandlers[handler])();
+  }
+}
 
-  uint32_t rm = parent->registers[shifterOperand & 0xF];
+template <uint32_t type, uint32_t registerShift>
+uint32_t ArmCore::BarrelShifter()
+{
+  uint32_t rm = parent->registers[curInstruction & 0xF];
 
   int32_t amount;
   if (registerShift)
   {
-    uint32_t rs = (shifterOperand >> 8) & 0xF;
+    uint32_t rs = (curInstruction >> 8) & 0xF;
     
     if (rs == 15)
     {
@@ -164,21 +268,21 @@ uint32_t ArmCore::BarrelShifter(uint32_t shifterOperand)
       amount = (int32_t)(parent->registers[rs] & 0xFF);
     }
 
-    if ((shifterOperand & 0xF) == 15)
+    if ((curInstruction & 0xF) == 15)
     {
       rm += 4;
     }
   }
   else
   {
-    amount = (int32_t)((shifterOperand >> 7) & 0x1F);
+    amount = (int32_t)((curInstruction >> 7) & 0x1F);
   }
 
   if (registerShift)
   {
     if (amount == 0)
     {
-      shifterCarry = carry;
+      shifterCarry = CARRY_UNCHANGED;
       return rm;
     }
 
@@ -247,7 +351,7 @@ uint32_t ArmCore::BarrelShifter(uint32_t shifterOperand)
         else
         {
           amount &= 0x1F;
-          shifterCarry = (rm >> amount) & 1;
+          shifterCarry = (rm >> (amount - 1)) & 1;
           return (rm >> amount) | (rm << (32 - amount));
         }
       default:
@@ -261,7 +365,7 @@ uint32_t ArmCore::BarrelShifter(uint32_t shifterOperand)
       case SHIFT_LSL:
         if (amount == 0)
         {
-          shifterCarry = carry;
+          shifterCarry = CARRY_UNCHANGED;
           return rm;
         }
         else
@@ -307,7 +411,7 @@ uint32_t ArmCore::BarrelShifter(uint32_t shifterOperand)
         {
           // Actually an RRX
           shifterCarry = rm & 1;
-          return (carry << 31) | (rm >> 1);
+          return (flags.Carry() << 31) | (rm >> 1);
         }
         else
         {
@@ -320,27 +424,14 @@ uint32_t ArmCore::BarrelShifter(uint32_t shifterOperand)
   }
 }
 
-void ArmCore::OverflowCarryAdd(uint32_t a, uint32_t b, uint32_t r)
-{
-  overFlow = ((a & b & ~r) | (~a & ~b & r)) >> 31;
-  carry = ((a & b) | (a & ~r) | (b & ~r)) >> 31;
-}
-
-void ArmCore::OverflowCarrySub(uint32_t a, uint32_t b, uint32_t r)
-{
-  overFlow = ((a & ~b & ~r) | (~a & b & r)) >> 31;
-  carry = ((a & ~b) | (a & ~r) | (~b & ~r)) >> 31;
-}
-
+template <uint32_t opcode, uint32_t setFlags, uint32_t registerShift>
 void ArmCore::DoDataProcessing(uint32_t shifterOperand)
 {
   uint32_t rn = (curInstruction >> 16) & 0xF;
   uint32_t rd = (curInstruction >> 12) & 0xF;
   uint32_t alu;
 
-  bool registerShift = (curInstruction & (1 << 4)) == (1 << 4);
-  
-  if (rn == 15 && ((curInstruction >> 25) & 0x7) == 0 && registerShift)
+  if (registerShift && rn == 15)
   {
     rn = parent->registers[rn] + 4;
   }
@@ -349,139 +440,105 @@ void ArmCore::DoDataProcessing(uint32_t shifterOperand)
     rn = parent->registers[rn];
   }
 
-  uint32_t opcode = (curInstruction >> 21) & 0xF;
-
-  if (((curInstruction >> 20) & 1) == 1)
+  if (setFlags)
   {
     // Set flag bit set
     switch (opcode)
     {
       case OP_ADC:
-        parent->registers[rd] = rn + shifterOperand + carry;
+        parent->registers[rd] = rn + shifterOperand + flags.Carry();
 
-        negative = parent->registers[rd] >> 31;
-        zero = parent->registers[rd] == 0 ? 1U : 0U;
-        OverflowCarryAdd(rn, shifterOperand, parent->registers[rd]);
+        flags.SetAdd(rn, shifterOperand, parent->registers[rd]);
         break;
 
       case OP_ADD:
         parent->registers[rd] = rn + shifterOperand;
 
-        negative = parent->registers[rd] >> 31;
-        zero = parent->registers[rd] == 0 ? 1U : 0U;
-        OverflowCarryAdd(rn, shifterOperand, parent->registers[rd]);
+        flags.SetAdd(rn, shifterOperand, parent->registers[rd]);
         break;
 
       case OP_AND:
         parent->registers[rd] = rn & shifterOperand;
 
-        negative = parent->registers[rd] >> 31;
-        zero = parent->registers[rd] == 0 ? 1U : 0U;
-        carry = shifterCarry;
+        flags.SetLogic(parent->registers[rd], shifterCarry);
         break;
 
       case OP_BIC:
         parent->registers[rd] = rn & ~shifterOperand;
 
-        negative = parent->registers[rd] >> 31;
-        zero = parent->registers[rd] == 0 ? 1U : 0U;
-        carry = shifterCarry;
+        flags.SetLogic(parent->registers[rd], shifterCarry);
         break;
 
       case OP_CMN:
         alu = rn + shifterOperand;
 
-        negative = alu >> 31;
-        zero = alu == 0 ? 1U : 0U;
-        OverflowCarryAdd(rn, shifterOperand, alu);
+        flags.SetAdd(rn, shifterOperand, alu);
         break;
 
       case OP_CMP:
         alu = rn - shifterOperand;
 
-        negative = alu >> 31;
-        zero = alu == 0 ? 1U : 0U;
-        OverflowCarrySub(rn, shifterOperand, alu);
+        flags.SetSub(rn, shifterOperand, alu);
         break;
 
       case OP_EOR:
         parent->registers[rd] = rn ^ shifterOperand;
 
-        negative = parent->registers[rd] >> 31;
-        zero = parent->registers[rd] == 0 ? 1U : 0U;
-        carry = shifterCarry;
+        flags.SetLogic(parent->registers[rd], shifterCarry);
         break;
 
       case OP_MOV:
         parent->registers[rd] = shifterOperand;
 
-        negative = parent->registers[rd] >> 31;
-        zero = parent->registers[rd] == 0 ? 1U : 0U;
-        carry = shifterCarry;
+        flags.SetLogic(parent->registers[rd], shifterCarry);
         break;
 
       case OP_MVN:
         parent->registers[rd] = ~shifterOperand;
 
-        negative = parent->registers[rd] >> 31;
-        zero = parent->registers[rd] == 0 ? 1U : 0U;
-        carry = shifterCarry;
+        flags.SetLogic(parent->registers[rd], shifterCarry);
         break;
 
       case OP_ORR:
         parent->registers[rd] = rn | shifterOperand;
 
-        negative = parent->registers[rd] >> 31;
-        zero = parent->registers[rd] == 0 ? 1U : 0U;
-        carry = shifterCarry;
+        flags.SetLogic(parent->registers[rd], shifterCarry);
         break;
 
       case OP_RSB:
         parent->registers[rd] = shifterOperand - rn;
 
-        negative = parent->registers[rd] >> 31;
-        zero = parent->registers[rd] == 0 ? 1U : 0U;
-        OverflowCarrySub(shifterOperand, rn, parent->registers[rd]);
+        flags.SetSub(shifterOperand, rn, parent->registers[rd]);
         break;
 
       case OP_RSC:
-        parent->registers[rd] = shifterOperand - rn - (1U - carry);
+        parent->registers[rd] = shifterOperand - rn - (1U - flags.Carry());
 
-        negative = parent->registers[rd] >> 31;
-        zero = parent->registers[rd] == 0 ? 1U : 0U;
-        OverflowCarrySub(shifterOperand, rn, parent->registers[rd]);
+        flags.SetSub(shifterOperand, rn, parent->registers[rd]);
         break;
 
       case OP_SBC:
-        parent->registers[rd] = rn - shifterOperand - (1U - carry);
+        parent->registers[rd] = rn - shifterOperand - (1U - flags.Carry());
 
-        negative = parent->registers[rd] >> 31;
-        zero = parent->registers[rd] == 0 ? 1U : 0U;
-        OverflowCarrySub(rn, shifterOperand, parent->registers[rd]);
+        flags.SetSub(rn, shifterOperand, parent->registers[rd]);
         break;
 
       case OP_SUB:
         parent->registers[rd] = rn - shifterOperand;
 
-        negative = parent->registers[rd] >> 31;
-        zero = parent->registers[rd] == 0 ? 1U : 0U;
-        OverflowCarrySub(rn, shifterOperand, parent->registers[rd]);
+        flags.SetSub(rn, shifterOperand, parent->registers[rd]);
         break;
 
       case OP_TEQ:
         alu = rn ^ shifterOperand;
 
-        negative = alu >> 31;
-        zero = alu == 0 ? 1U : 0U;
-        carry = shifterCarry;
+        flags.SetLogic(alu, shifterCarry);
         break;
 
       case OP_TST:
         alu = rn & shifterOperand;
 
-        negative = alu >> 31;
-        zero = alu == 0 ? 1U : 0U;
-        carry = shifterCarry;
+        flags.SetLogic(alu, shifterCarry);
         break;
     }
 
@@ -511,7 +568,7 @@ void ArmCore::DoDataProcessing(uint32_t shifterOperand)
     // Set flag bit not set
     switch (opcode)
     {
-      case OP_ADC: parent->registers[rd] = rn + shifterOperand + carry; break;
+      case OP_ADC: parent->registers[rd] = rn + shifterOperand + flags.Carry(); break;
       case OP_ADD: parent->registers[rd] = rn + shifterOperand; break;
       case OP_AND: parent->registers[rd] = rn & shifterOperand; break;
       case OP_BIC: parent->registers[rd] = rn & ~shifterOperand; break;
@@ -520,8 +577,8 @@ void ArmCore::DoDataProcessing(uint32_t shifterOperand)
       case OP_MVN: parent->registers[rd] = ~shifterOperand; break;
       case OP_ORR: parent->registers[rd] = rn | shifterOperand; break;
       case OP_RSB: parent->registers[rd] = shifterOperand - rn; break;
-      case OP_RSC: parent->registers[rd] = shifterOperand - rn - (1U - carry); break;
-      case OP_SBC: parent->registers[rd] = rn - shifterOperand - (1U - carry); break;
+      case OP_RSC: parent->registers[rd] = shifterOperand - rn - (1U - flags.Carry()); break;
+      case OP_SBC: parent->registers[rd] = rn - shifterOperand - (1U - flags.Carry()); break;
       case OP_SUB: parent->registers[rd] = rn - shifterOperand; break;
 
       case OP_CMN:
@@ -608,8 +665,9 @@ void ArmCore::DoDataProcessing(uint32_t shifterOperand)
           }
           if ((curInstruction & (1 << 19)) == 1 << 19)
           {
-            tmpCPSR &= 0x00FFFFFF;
-            tmpCPSR |= shifterOperand & 0xFF000000;
+            // Only NZCV exist in the flags byte, the ARM7TDMI reads bits 27-24 as 0
+            tmpCPSR &= 0x0FFFFFFF;
+            tmpCPSR |= shifterOperand & 0xF0000000;
           }
 
           parent->WriteCpsr(tmpCPSR);
@@ -643,32 +701,14 @@ void ArmCore::DoDataProcessing(uint32_t shifterOperand)
   }
 }
 
+template <uint32_t op>
 void ArmCore::DataProcessing()
 {
-  // Special instruction
-  switch ((curInstruction >> 4) & 0xF)
-  {
-    case 0x9:
-      // Multiply or swap instructions
-      MultiplyOrSwap();
-      return;
-    case 0xB:
-      // Load/Store Unsigned halfword
-      LoadStoreHalfword();
-      return;
-    case 0xD:
-      // Load/Store Signed byte
-      LoadStoreHalfword();
-      return;
-    case 0xF:
-      // Load/Store Signed halfword
-      LoadStoreHalfword();
-      return;
-  }
-
-  DoDataProcessing(BarrelShifter(curInstruction));
+  // Multiply, swap and halfword transfers have their own table entries
+  DoDataProcessing<(op >> 5) & 0xF, (op >> 4) & 0x1, op & 0x1>(BarrelShifter<(op >> 1) & 0x3, op & 0x1>());
 }
 
+template <uint32_t op>
 void ArmCore::DataProcessingImmed()
 {
   uint32_t immed = curInstruction & 0xFF;
@@ -678,29 +718,32 @@ void ArmCore::DataProcessingImmed()
 
   if (rotateAmount == 0)
   {
-    shifterCarry = carry;
+    shifterCarry = CARRY_UNCHANGED;
   }
   else
   {
     shifterCarry = (immed >> 31) & 1;
   }
 
-  DoDataProcessing(immed);
+  DoDataProcessing<(op >> 5) & 0xF, (op >> 4) & 0x1, 0>(immed);
 }
 
+template <uint32_t op>
 void ArmCore::LoadStore(uint32_t offSet)
 {
+  constexpr uint32_t fixed = ArmFixedBits(op);
+
   uint32_t rn = (curInstruction >> 16) & 0xF;
   uint32_t rd = (curInstruction >> 12) & 0xF;
 
   uint32_t address = parent->registers[rn];
 
-  bool preIndexed = (curInstruction & (1 << 24)) == 1 << 24;
-  bool byteTransfer = (curInstruction & (1 << 22)) == 1 << 22;
-  bool writeback = (curInstruction & (1 << 21)) == 1 << 21;
+  bool preIndexed = (fixed & (1 << 24)) == 1 << 24;
+  bool byteTransfer = (fixed & (1 << 22)) == 1 << 22;
+  bool writeback = (fixed & (1 << 21)) == 1 << 21;
 
   // Add or subtract offset
-  if ((curInstruction & (1 << 23)) != 1 << 23) offSet = (uint32_t)-offSet;
+  if ((fixed & (1 << 23)) != 1 << 23) offSet = (uint32_t)-offSet;
 
   if (preIndexed)
   {
@@ -712,7 +755,7 @@ void ArmCore::LoadStore(uint32_t offSet)
     }
   }
 
-  if ((curInstruction & (1 << 20)) == 1 << 20)
+  if ((fixed & (1 << 20)) == 1 << 20)
   {
     // Load
     if (byteTransfer)
@@ -762,28 +805,33 @@ void ArmCore::LoadStore(uint32_t offSet)
   }
 }
 
+template <uint32_t op>
 void ArmCore::LoadStoreImmediate()
 {
-  LoadStore(curInstruction & 0xFFF);
+  LoadStore<op>(curInstruction & 0xFFF);
 }
 
+template <uint32_t op>
 void ArmCore::LoadStoreRegister()
 {
   // The barrel shifter expects a 0 in bit 4 for immediate shifts, this is implicit in
   // the meaning of the instruction, so it is fine
-  LoadStore(BarrelShifter(curInstruction));
+  LoadStore<op>(BarrelShifter<(op >> 1) & 0x3, op & 0x1>());
 }
 
+template <uint32_t op>
 void ArmCore::LoadStoreMultiple()
 {
+  constexpr uint32_t fixed = ArmFixedBits(op);
+
   uint32_t rn = (curInstruction >> 16) & 0xF;
 
   PackFlags();
   uint32_t curCpsr = parent->cpsr;
 
-  bool preIncrement = (curInstruction & (1 << 24)) != 0;
-  bool up = (curInstruction & (1 << 23)) != 0;
-  bool writeback = (curInstruction & (1 << 21)) != 0;
+  bool preIncrement = (fixed & (1 << 24)) != 0;
+  bool up = (fixed & (1 << 23)) != 0;
+  bool writeback = (fixed & (1 << 21)) != 0;
 
   uint32_t address;
   uint32_t bitsSet = 0;
@@ -839,9 +887,9 @@ void ArmCore::LoadStoreMultiple()
     }
   }
 
-  if ((curInstruction & (1 << 20)) != 0)
+  if ((fixed & (1 << 20)) != 0)
   {
-    if ((curInstruction & (1 << 22)) != 0 && ((curInstruction >> 15) & 1) == 0)
+    if ((fixed & (1 << 22)) != 0 && ((curInstruction >> 15) & 1) == 0)
     {
       // Switch to user mode temporarily
       parent->WriteCpsr((curCpsr & ~0x1FU) | USR);
@@ -864,7 +912,7 @@ void ArmCore::LoadStoreMultiple()
 
       parent->registers[15] = parent->ReadU32Aligned(address & (~0x3U));
 
-      if ((curInstruction & (1 << 22)) != 0)
+      if ((fixed & (1 << 22)) != 0)
       {
         // Load the CPSR from the SPSR
         if (parent->SPSRExists())
@@ -887,7 +935,7 @@ void ArmCore::LoadStoreMultiple()
     }
     else
     {
-      if ((curInstruction & (1 << 22)) != 0)
+      if ((fixed & (1 << 22)) != 0)
       {
         // Switch back to the correct mode
         parent->WriteCpsr(curCpsr);
@@ -903,7 +951,7 @@ void ArmCore::LoadStoreMultiple()
   }
   else
   {
-    if ((curInstruction & (1 << 22)) != 0)
+    if ((fixed & (1 << 22)) != 0)
     {
       // Switch to user mode temporarily
       parent->WriteCpsr((curCpsr & ~0x1FU) | USR);
@@ -933,7 +981,7 @@ void ArmCore::LoadStoreMultiple()
       }
     }
 
-    if ((curInstruction & (1 << 22)) != 0)
+    if ((fixed & (1 << 22)) != 0)
     {
       // Switch back to the correct mode
       parent->WriteCpsr(curCpsr);
@@ -942,9 +990,10 @@ void ArmCore::LoadStoreMultiple()
   }
 }
 
+template <uint32_t link>
 void ArmCore::Branch()
 {
-  if ((curInstruction & (1 << 24)) != 0)
+  if (link != 0)
   {
     parent->registers[14] = (parent->registers[15] - 4U) & ~3U;
   }
@@ -957,6 +1006,11 @@ void ArmCore::Branch()
 
   parent->registers[15] += branchOffset << 2;
 
+  if (link == 0 && (int32_t)(branchOffset << 2) < 0 && (int32_t)(branchOffset << 2) >= -IDLE_LOOP_BYTES)
+  {
+    parent->IdleBranch(flags.Pack(parent->cpsr));
+  }
+
   FlushQueue();
 }
 
@@ -967,21 +1021,31 @@ void ArmCore::CoprocessorLoadStore()
 
 void ArmCore::SoftwareInterrupt()
 {
+#ifdef BIOS_HLE
+  if (biosHle.Call((curInstruction >> 16) & 0xFF))
+  {
+    return;
+  }
+#endif
+
   // Adjust PC for prefetch
   parent->registers[15] -= 4U;
   parent->EnterException(SVC, 0x8, false, false);
 }
 
+template <uint32_t op>
 void ArmCore::MultiplyOrSwap()
 {
-  if ((curInstruction & (1 << 24)) == 1 << 24)
+  constexpr uint32_t fixed = ArmFixedBits(op);
+
+  if ((fixed & (1 << 24)) == 1 << 24)
   {
     // Swap instruction
     uint32_t rn = (curInstruction >> 16) & 0xF;
     uint32_t rd = (curInstruction >> 12) & 0xF;
     uint32_t rm = curInstruction & 0xF;
 
-    if ((curInstruction & (1 << 22)) != 0)
+    if ((fixed & (1 << 22)) != 0)
     {
       // SWPB
       uint8_t tmp = parent->ReadU8(parent->registers[rn]);
@@ -999,7 +1063,7 @@ void ArmCore::MultiplyOrSwap()
   else
   {
     // Multiply instruction
-    switch ((curInstruction >> 21) & 0x7)
+    switch ((fixed >> 21) & 0x7)
     {
       case 0:
       case 1:
@@ -1028,16 +1092,15 @@ void ArmCore::MultiplyOrSwap()
           parent->registers[rd] = parent->registers[rs] * parent->registers[rm];
           parent->Cycles -= cycles;
 
-          if ((curInstruction & (1 << 21)) == 1 << 21)
+          if ((fixed & (1 << 21)) == 1 << 21)
           {
             parent->registers[rd] += rn;
             parent->Cycles -= 1;
           }
 
-          if ((curInstruction & (1 << 20)) == 1 << 20)
+          if ((fixed & (1 << 20)) == 1 << 20)
           {
-            negative = parent->registers[rd] >> 31;
-            zero = parent->registers[rd] == 0 ? 1U : 0U;
+            flags.SetNZ(parent->registers[rd]);
           }
           break;
         }
@@ -1074,7 +1137,7 @@ void ArmCore::MultiplyOrSwap()
 
           parent->Cycles -= cycles;
 
-          switch ((curInstruction >> 21) & 0x3)
+          switch ((fixed >> 21) & 0x3)
           {
             case 0:
               {
@@ -1114,10 +1177,10 @@ void ArmCore::MultiplyOrSwap()
               }
           }
 
-          if ((curInstruction & (1 << 20)) == 1 << 20)
+          if ((fixed & (1 << 20)) == 1 << 20)
           {
-            negative = parent->registers[rdhi] >> 31;
-            zero = (parent->registers[rdhi] == 0 && parent->registers[rdlo] == 0) ? 1U : 0U;
+            flags.negative = parent->registers[rdhi];
+            flags.zero = parent->registers[rdhi] | parent->registers[rdlo];
           }
           break;
         }
@@ -1125,20 +1188,23 @@ void ArmCore::MultiplyOrSwap()
   }
 }
 
+template <uint32_t op>
 void ArmCore::LoadStoreHalfword()
 {
+  constexpr uint32_t fixed = ArmFixedBits(op);
+
   uint32_t rn = (curInstruction >> 16) & 0xF;
   uint32_t rd = (curInstruction >> 12) & 0xF;
 
   uint32_t address = parent->registers[rn];
 
-  bool preIndexed = (curInstruction & (1 << 24)) != 0;
-  bool byteTransfer = (curInstruction & (1 << 5)) == 0;
-  bool signedTransfer = (curInstruction & (1 << 6)) != 0;
-  bool writeback = (curInstruction & (1 << 21)) != 0;
+  bool preIndexed = (fixed & (1 << 24)) != 0;
+  bool byteTransfer = (fixed & (1 << 5)) == 0;
+  bool signedTransfer = (fixed & (1 << 6)) != 0;
+  bool writeback = (fixed & (1 << 21)) != 0;
 
   uint32_t offSet;
-  if ((curInstruction & (1 << 22)) != 0)
+  if ((fixed & (1 << 22)) != 0)
   {
     // Immediate offset
     offSet = ((curInstruction & 0xF00) >> 4) | (curInstruction & 0xF);
@@ -1150,7 +1216,7 @@ void ArmCore::LoadStoreHalfword()
   }
 
   // Add or subtract offset
-  if ((curInstruction & (1 << 23)) == 0) offSet = (uint32_t)-offSet;
+  if ((fixed & (1 << 23)) == 0) offSet = (uint32_t)-offSet;
 
   if (preIndexed)
   {
@@ -1162,7 +1228,7 @@ void ArmCore::LoadStoreHalfword()
     }
   }
 
-  if ((curInstruction & (1 << 20)) != 0)
+  if ((fixed & (1 << 20)) != 0)
   {
     // Load
     if (byteTransfer)
@@ -1231,19 +1297,12 @@ void ArmCore::LoadStoreHalfword()
 
 void ArmCore::PackFlags()
 {
-  parent->cpsr &= 0x0FFFFFFF;
-  parent->cpsr |= negative << parent->N_BIT;
-  parent->cpsr |= zero << parent->Z_BIT;
-  parent->cpsr |= carry << parent->C_BIT;
-  parent->cpsr |= overFlow << parent->V_BIT;
+  parent->cpsr = flags.Pack(parent->cpsr);
 }
 
 void ArmCore::UnpackFlags()
 {
-  negative = (parent->cpsr >> parent->N_BIT) & 1;
-  zero = (parent->cpsr >> parent->Z_BIT) & 1;
-  carry = (parent->cpsr >> parent->C_BIT) & 1;
-  overFlow = (parent->cpsr >> parent->V_BIT) & 1;
+  flags.Unpack(parent->cpsr);
 }
 
 void ArmCore::FlushQueue()
@@ -26,6 +26,7 @@
 #define ArmCore_h
 
 #include <inttypes.h>
+#include "GBA_Flags.h"
 
 #define COND_EQ 0   // Z set
 #define COND_NE 1   // Z clear
@@ -61,16 +62,17 @@
 #define OP_BIC 0xE
 #define OP_MVN 0xF
 
+//ARM handlers are indexed by instruction bits 27-20 and 7-4
+#define ARM_HANDLERS 4096
+#define ARM_HANDLER(instruction) ((((instruction) >> 16) & 0xFF0) | (((instruction) >> 4) & 0xF))
+
 class ArmCore
 {
   public:
     //Variables
     uint32_t instructionQueue = 0;
     uint32_t curInstruction = 0;
-    uint32_t zero;
-    uint32_t carry;
-    uint32_t negative;
-    uint32_t overFlow;
+    LazyFlags flags;
     uint32_t shifterCarry;
     bool thumbMode;
   
@@ -79,27 +81,28 @@ class ArmCore
     ArmCore(class Processor *par);
     void BeginExecution();
     void Execute();
-    void NormalOps(uint8_t index);
-    uint32_t BarrelShifter(uint32_t shifterOperand);
-    void OverflowCarryAdd(uint32_t a, uint32_t b, uint32_t r);
-    void OverflowCarrySub(uint32_t a, uint32_t b, uint32_t r);
-    void DoDataProcessing(uint32_t shifterOperand);
-    void DataProcessing();
-    void DataProcessingImmed();
-    void LoadStore(uint32_t offSet);
-    void LoadStoreImmediate();
-    void LoadStoreRegister();
-    void LoadStoreMultiple();
-    void Branch();
+    void ExecuteBlock(struct Block *block);
+    void ExecuteOp(uint16_t handler);
+    template <uint32_t type, uint32_t registerShift> uint32_t BarrelShifter();
+    template <uint32_t opcode, uint32_t setFlags, uint32_t registerShift> void DoDataProcessing(uint32_t shifterOperand);
+    template <uint32_t op> void DataProcessing();
+    template <uint32_t op> void DataProcessingImmed();
+    template <uint32_t op> void LoadStore(uint32_t offSet);
+    template <uint32_t op> void LoadStoreImmediate();
+    template <uint32_t op> void LoadStoreRegister();
+    template <uint32_t op> void LoadStoreMultiple();
+    template <uint32_t link> void Branch();
     void CoprocessorLoadStore();
     void SoftwareInterrupt();
-    void MultiplyOrSwap();
-    void LoadStoreHalfword();
+    template <uint32_t op> void MultiplyOrSwap();
+    template <uint32_t op> void LoadStoreHalfword();
     void PackFlags();
     void UnpackFlags();
     void FlushQueue();
 };
 
+typedef void (ArmCore::*ArmHandler)();
+
 #endif
 
 
@@ -0,0 +1,665 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include "GBA_BiosHle.h"
+#include "GBA_Arm7.h"
+
+BiosHle biosHle;
+
+//First quarter of the BIOS sine table, sin(i * 2pi / 256) in 1.14 fixed point
+static const int16_t sineQuarter[65] =
+{
+  0, 402, 804, 1205, 1606, 2006, 2404, 2801, 3196, 3590, 3981, 4370, 4756, 5139, 5520, 5897,
+  6270, 6639, 7005, 7366, 7723, 8076, 8423, 8765, 9102, 9434, 9760, 10080, 10394, 10702, 11003, 11297,
+  11585, 11866, 12140, 12406, 12665, 12916, 13160, 13395, 13623, 13842, 14053, 14256, 14449, 14635, 14811, 14978,
+  15137, 15286, 15426, 15557, 15679, 15791, 15893, 15986, 16069, 16143, 16207, 16261, 16305, 16340, 16364, 16379,
+  16384
+};
+
+//Collects decompressed bytes, VRAM only takes 16 bit writes so they go out in pairs there
+class BiosWriter
+{
+  public:
+    BiosWriter(Processor *par, uint32_t dest, bool toVram)
+    {
+      parent = par;
+      start = dest;
+      address = dest;
+      vram = toVram;
+    }
+
+    void Write(uint8_t value)
+    {
+      if(!vram)
+      {
+        parent->WriteU8(address, value);
+      }
+      else if((address & 1) == 0)
+      {
+        pending = value;
+      }
+      else
+      {
+        parent->WriteU16(address - 1, (uint16_t)(pending | (value << 8)));
+      }
+
+      address++;
+    }
+
+    //Byte written distance bytes ago, the low half of an unwritten VRAM pair is still pending
+    uint8_t Back(uint32_t distance)
+    {
+      if(vram && distance == 1 && (address & 1) != 0)
+      {
+        return pending;
+      }
+
+      return parent->ReadU8(address - distance);
+    }
+
+    uint32_t Written()
+    {
+      return address - start;
+    }
+
+  private:
+    Processor *parent;
+    uint32_t start;
+    uint32_t address;
+    bool vram;
+    uint8_t pending = 0;
+};
+
+void BiosHle::Begin(Processor *par)
+{
+  parent = par;
+  waiting = false;
+}
+
+//Runs swi natively, false leaves it to the BIOS image
+bool BiosHle::Call(uint32_t swi)
+{
+  uint32_t *r = parent->registers;
+
+  switch(swi)
+  {
+    case 0x01: RegisterRamReset(r[0]); break;
+    case 0x02: parent->Halt(); break;
+    case 0x04: IntrWait(r[0] != 0, (uint16_t)r[1]); break;
+    case 0x05: IntrWait(true, 1); break;
+    case 0x06: Div((int32_t)r[0], (int32_t)r[1]); break;
+    case 0x07: Div((int32_t)r[1], (int32_t)r[0]); break;
+    case 0x08: Sqrt(); break;
+    case 0x09: r[0] = (uint32_t)ArcTan((int32_t)r[0]); parent->Cycles -= BIOS_MATH_CYCLES; break;
+    case 0x0A: r[0] = ArcTan2((int32_t)r[0], (int32_t)r[1]); parent->Cycles -= BIOS_MATH_CYCLES; break;
+    case 0x0B: CpuSet(); break;
+    case 0x0C: CpuFastSet(); break;
+    case 0x0E: BgAffineSet(); break;
+    case 0x0F: ObjAffineSet(); break;
+    case 0x10: BitUnPack(); break;
+    case 0x11: LZ77UnComp(false); break;
+    case 0x12: LZ77UnComp(true); break;
+    case 0x13: HuffUnComp(); break;
+    case 0x14: RLUnComp(false); break;
+    case 0x15: RLUnComp(true); break;
+    default: return false;
+  }
+
+  //Halting ends the slice, the call is over once the CPU wakes
+  if(parent->cpuHalted)
+  {
+    return true;
+  }
+
+  parent->Cycles -= BIOS_CALL_CYCLES;
+  return true;
+}
+
+void BiosHle::Fill(uint32_t address, uint32_t length)
+{
+  for(uint32_t i = 0; i < length; i += 4)
+  {
+    parent->WriteU32(address + i, 0);
+  }
+
+  parent->Cycles -= (length >> 2) * BIOS_UNIT_CYCLES;
+}
+
+void BiosHle::FillIO(uint32_t first, uint32_t last)
+{
+  for(uint32_t i = first; i <= last; i += 2)
+  {
+    parent->WriteU16(REG_BASE + i, 0);
+  }
+}
+
+//SWI 01h, r0 bits pick what gets cleared
+void BiosHle::RegisterRamReset(uint32_t flags)
+{
+  if((flags & (1 << 0)) != 0) Fill(0x02000000, 0x40000);
+  if((flags & (1 << 1)) != 0) Fill(0x03000000, 0x7E00); //The top 200h (stacks and IRQ vectors) survive
+  if((flags & (1 << 2)) != 0) Fill(PAL_BASE, 0x400);
+  if((flags & (1 << 3)) != 0) Fill(VRAM_BASE, 0x18000);
+  if((flags & (1 << 4)) != 0) Fill(OAM_BASE, 0x400);
+  if((flags & (1 << 5)) != 0) FillIO(0x120, 0x15A); //Serial
+  if((flags & (1 << 6)) != 0) FillIO(0x060, 0x0AE); //Sound
+
+  if((flags & (1 << 7)) != 0)
+  {
+    FillIO(0x002, 0x05E); //Display
+    FillIO(0x0B0, 0x10E); //DMA and timers
+    parent->WriteU16(REG_BASE + BG2PA, 0x0100);
+    parent->WriteU16(REG_BASE + BG2PD, 0x0100);
+    parent->WriteU16(REG_BASE + BG3PA, 0x0100);
+    parent->WriteU16(REG_BASE + BG3PD, 0x0100);
+  }
+
+  //Always ends in forced blank
+  parent->WriteU16(REG_BASE + DISPCNT, 0x0080);
+}
+
+//SWI 04h/05h, returns once one of irqs has been flagged at BIOS_IRQ_FLAGS by the game's IRQ
+//handler. Otherwise it halts with the PC back on the SWI, which runs again after the interrupt.
+void BiosHle::IntrWait(bool discard, uint16_t irqs)
+{
+  uint16_t flags = parent->ReadU16(BIOS_IRQ_FLAGS);
+
+  parent->WriteU16(REG_BASE + IME, 1);
+
+  if(discard && !waiting)
+  {
+    flags &= (uint16_t)~irqs;
+    parent->WriteU16(BIOS_IRQ_FLAGS, flags);
+  }
+  else if((flags & irqs) != 0)
+  {
+    parent->WriteU16(BIOS_IRQ_FLAGS, (uint16_t)(flags & ~irqs));
+    waiting = false;
+    return;
+  }
+
+  waiting = true;
+  parent->registers[15] -= parent->ArmState() ? 8 : 4;
+  parent->ReloadQueue();
+  parent->Halt();
+}
+
+//SWI 06h/07h, dividing by 0 hangs the real BIOS, this returns +-1 instead
+void BiosHle::Div(int32_t numerator, int32_t denominator)
+{
+  uint32_t *r = parent->registers;
+  int32_t quotient;
+
+  if(denominator == 0)
+  {
+    quotient = numerator < 0 ? -1 : 1;
+    r[1] = (uint32_t)numerator;
+  }
+  else if(denominator == -1)
+  {
+    quotient = (int32_t)(0U - (uint32_t)numerator); //0x80000000 / -1 stays 0x80000000
+    r[1] = 0;
+  }
+  else
+  {
+    quotient = numerator / denominator;
+    r[1] = (uint32_t)(numerator % denominator);
+  }
+
+  r[0] = (uint32_t)quotient;
+  r[3] = quotient < 0 ? 0U - (uint32_t)quotient : (uint32_t)quotient;
+  parent->Cycles -= BIOS_MATH_CYCLES;
+}
+
+//SWI 08h, unsigned 32 bit square root
+void BiosHle::Sqrt()
+{
+  uint32_t value = parent->registers[0];
+  uint32_t root = 0;
+  uint32_t bit = 1U << 30;
+
+  while(bit > value)
+  {
+    bit >>= 2;
+  }
+
+  while(bit != 0)
+  {
+    if(value >= root + bit)
+    {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else
+    {
+      root >>= 1;
+    }
+
+    bit >>= 2;
+  }
+
+  parent->registers[0] = root;
+  parent->Cycles -= BIOS_MATH_CYCLES;
+}
+
+//SWI 09h, tan in 1.14 fixed point to an angle where 4000h is 90 degrees, same polynomial as the BIOS
+int32_t BiosHle::ArcTan(int32_t tan)
+{
+  int32_t a = -(int32_t)(((int64_t)tan * tan) >> 14);
+  int32_t b = (int32_t)((0xA9 * (int64_t)a) >> 14) + 0x390;
+
+  b = (int32_t)(((int64_t)b * a) >> 14) + 0x91C;
+  b = (int32_t)(((int64_t)b * a) >> 14) + 0xFB6;
+  b = (int32_t)(((int64_t)b * a) >> 14) + 0x16AA;
+  b = (int32_t)(((int64_t)b * a) >> 14) + 0x2081;
+  b = (int32_t)(((int64_t)b * a) >> 14) + 0x3651;
+  b = (int32_t)(((int64_t)b * a) >> 14) + 0xA2F9;
+
+  return (int32_t)(((int64_t)tan * b) >> 16);
+}
+
+//SWI 0Ah, angle of the vector x,y, 0000h-FFFFh for the full circle
+uint16_t BiosHle::ArcTan2(int32_t x, int32_t y)
+{
+  if(y == 0)
+  {
+    return x >= 0 ? 0x0000 : 0x8000;
+  }
+
+  if(x == 0)
+  {
+    return y >= 0 ? 0x4000 : 0xC000;
+  }
+
+  int32_t yx = (int32_t)(((int64_t)y << 14) / x);
+  int32_t xy = (int32_t)(((int64_t)x << 14) / y);
+
+  if(y >= 0)
+  {
+    if(x >= 0 && x >= y)
+    {
+      return (uint16_t)ArcTan(yx);
+    }
+
+    if(x < 0 && -x >= y)
+    {
+      return (uint16_t)(ArcTan(yx) + 0x8000);
+    }
+
+    return (uint16_t)(0x4000 - ArcTan(xy));
+  }
+
+  if(x <= 0 && -x > -y)
+  {
+    return (uint16_t)(ArcTan(yx) + 0x8000);
+  }
+
+  if(x > 0 && x >= -y)
+  {
+    return (uint16_t)(ArcTan(yx) + 0x10000);
+  }
+
+  return (uint16_t)(0xC000 - ArcTan(xy));
+}
+
+//SWI 0Bh, r2 bits 0-20 unit count, bit 24 fill with the first unit, bit 26 32 bit units
+void BiosHle::CpuSet()
+{
+  uint32_t source = parent->registers[0];
+  uint32_t dest = parent->registers[1];
+  uint32_t control = parent->registers[2];
+  uint32_t count = control & 0x1FFFFF;
+  bool fill = (control & (1 << 24)) != 0;
+
+  if((control & (1 << 26)) != 0)
+  {
+    source &= ~3U;
+    dest &= ~3U;
+    uint32_t value = parent->ReadU32(source);
+
+    for(uint32_t i = 0; i < count; i++)
+    {
+      if(!fill && i != 0)
+      {
+        value = parent->ReadU32(source + (i << 2));
+      }
+
+      parent->WriteU32(dest + (i << 2), value);
+    }
+  }
+  else
+  {
+    source &= ~1U;
+    dest &= ~1U;
+    uint16_t value = parent->ReadU16(source);
+
+    for(uint32_t i = 0; i < count; i++)
+    {
+      if(!fill && i != 0)
+      {
+        value = parent->ReadU16(source + (i << 1));
+      }
+
+      parent->WriteU16(dest + (i << 1), value);
+    }
+  }
+
+  parent->Cycles -= count * BIOS_UNIT_CYCLES;
+}
+
+//SWI 0Ch, 32 bit only and the count rounds up to 8 words
+void BiosHle::CpuFastSet()
+{
+  uint32_t source = parent->registers[0] & ~3U;
+  uint32_t dest = parent->registers[1] & ~3U;
+  uint32_t control = parent->registers[2];
+  uint32_t count = ((control & 0x1FFFFF) + 7) & ~7U;
+  bool fill = (control & (1 << 24)) != 0;
+  uint32_t value = parent->ReadU32(source);
+
+  for(uint32_t i = 0; i < count; i++)
+  {
+    if(!fill && i != 0)
+    {
+      value = parent->ReadU32(source + (i << 2));
+    }
+
+    parent->WriteU32(dest + (i << 2), value);
+  }
+
+  //LDMIA/STMIA of 8 words per loop
+  parent->Cycles -= (count >> 3) * BIOS_UNIT_CYCLES;
+}
+
+int32_t BiosHle::Sine(uint32_t angle)
+{
+  angle &= 0xFF;
+
+  switch(angle >> 6)
+  {
+    case 0: return sineQuarter[angle];
+    case 1: return sineQuarter[128 - angle];
+    case 2: return -sineQuarter[angle - 128];
+    default: return -sineQuarter[256 - angle];
+  }
+}
+
+int32_t BiosHle::Cosine(uint32_t angle)
+{
+  return Sine(angle + 64);
+}
+
+//SWI 0Eh, r0 source entries of 20 bytes, r1 BG2/BG3 style PA-PD,X,Y destinations of 16 bytes, r2 count
+void BiosHle::BgAffineSet()
+{
+  uint32_t source = parent->registers[0];
+  uint32_t dest = parent->registers[1];
+  uint32_t count = parent->registers[2];
+
+  for(uint32_t i = 0; i < count; i++)
+  {
+    int32_t originX = (int32_t)parent->ReadU32(source);
+    int32_t originY = (int32_t)parent->ReadU32(source + 4);
+    int32_t displayX = (int16_t)parent->ReadU16(source + 8);
+    int32_t displayY = (int16_t)parent->ReadU16(source + 10);
+    int32_t scaleX = (int16_t)parent->ReadU16(source + 12);
+    int32_t scaleY = (int16_t)parent->ReadU16(source + 14);
+    uint32_t angle = parent->ReadU16(source + 16) >> 8;
+
+    int32_t sine = Sine(angle);
+    int32_t cosine = Cosine(angle);
+    int32_t pa = (cosine * scaleX) >> 14;
+    int32_t pb = -((sine * scaleX) >> 14);
+    int32_t pc = (sine * scaleY) >> 14;
+    int32_t pd = (cosine * scaleY) >> 14;
+
+    parent->WriteU16(dest, (uint16_t)pa);
+    parent->WriteU16(dest + 2, (uint16_t)pb);
+    parent->WriteU16(dest + 4, (uint16_t)pc);
+    parent->WriteU16(dest + 6, (uint16_t)pd);
+    parent->WriteU32(dest + 8, (uint32_t)(originX - (pa * displayX + pb * displayY)));
+    parent->WriteU32(dest + 12, (uint32_t)(originY - (pc * displayX + pd * displayY)));
+
+    source += 20;
+    dest += 16;
+  }
+
+  parent->Cycles -= count * BIOS_AFFINE_CYCLES;
+}
+
+//SWI 0Fh, r0 source entries of 8 bytes, r1 destination, r2 count, r3 bytes between PA, PB, PC and PD
+//(2 for a packed array, 8 to write straight into OAM)
+void BiosHle::ObjAffineSet()
+{
+  uint32_t source = parent->registers[0];
+  uint32_t dest = parent->registers[1];
+  uint32_t count = parent->registers[2];
+  uint32_t stride = parent->registers[3];
+
+  for(uint32_t i = 0; i < count; i++)
+  {
+    int32_t scaleX = (int16_t)parent->ReadU16(source);
+    int32_t scaleY = (int16_t)parent->ReadU16(source + 2);
+    uint32_t angle = parent->ReadU16(source + 4) >> 8;
+
+    int32_t sine = Sine(angle);
+    int32_t cosine = Cosine(angle);
+
+    parent->WriteU16(dest, (uint16_t)((cosine * scaleX) >> 14));
+    parent->WriteU16(dest + stride, (uint16_t)(-((sine * scaleX) >> 14)));
+    parent->WriteU16(dest + stride * 2, (uint16_t)((sine * scaleY) >> 14));
+    parent->WriteU16(dest + stride * 3, (uint16_t)((cosine * scaleY) >> 14));
+
+    source += 8;
+    dest += stride * 4;
+  }
+
+  parent->Cycles -= count * BIOS_AFFINE_CYCLES;
+}
+
+//SWI 10h, r2 points at the unpack info: u16 source length, u8 source bits, u8 destination bits,
+//u32 offset added to each unit (to zero units too when bit 31 is set)
+void BiosHle::BitUnPack()
+{
+  uint32_t source = parent->registers[0];
+  uint32_t dest = parent->registers[1] & ~3U;
+  uint32_t info = parent->registers[2];
+
+  uint32_t length = parent->ReadU16(info);
+  uint32_t sourceBits = parent->ReadU8(info + 2);
+  uint32_t destBits = parent->ReadU8(info + 3);
+  uint32_t offset = parent->ReadU32(info + 4);
+  bool offsetZero = (offset & 0x80000000) != 0;
+  offset &= 0x7FFFFFFF;
+
+  if(sourceBits == 0 || sourceBits > 8 || destBits == 0 || destBits > 32)
+  {
+    return;
+  }
+
+  uint32_t sourceMask = (1U << sourceBits) - 1;
+  uint32_t destMask = destBits == 32 ? 0xFFFFFFFF : (1U << destBits) - 1;
+  uint32_t out = 0;
+  uint32_t outBits = 0;
+
+  for(uint32_t i = 0; i < length; i++)
+  {
+    uint8_t in = parent->ReadU8(source + i);
+
+    for(uint32_t bit = 0; bit < 8; bit += sourceBits)
+    {
+      uint32_t unit = (in >> bit) & sourceMask;
+
+      if(unit != 0 || offsetZero)
+      {
+        unit += offset;
+      }
+
+      out |= (unit & destMask) << outBits;
+      outBits += destBits;
+
+      if(outBits >= 32)
+      {
+        parent->WriteU32(dest, out);
+        dest += 4;
+        out = 0;
+        outBits = 0;
+      }
+    }
+  }
+
+  parent->Cycles -= length * BIOS_UNIT_CYCLES;
+}
+
+//SWI 11h/12h, header word bits 8-31 hold the decompressed size. Each flag byte covers the next
+//8 blocks, a set bit is a 2 byte back reference (length 3-18, distance 1-4096), clear is a literal.
+void BiosHle::LZ77UnComp(bool vram)
+{
+  uint32_t source = parent->registers[0];
+  uint32_t size = parent->ReadU32(source) >> 8;
+  BiosWriter out(parent, parent->registers[1], vram);
+
+  source += 4;
+
+  while(out.Written() < size)
+  {
+    uint8_t flags = parent->ReadU8(source++);
+
+    for(uint32_t i = 0; i < 8 && out.Written() < size; i++, flags <<= 1)
+    {
+      if((flags & 0x80) == 0)
+      {
+        out.Write(parent->ReadU8(source++));
+        continue;
+      }
+
+      uint8_t high = parent->ReadU8(source++);
+      uint8_t low = parent->ReadU8(source++);
+      uint32_t length = (uint32_t)(high >> 4) + 3;
+      uint32_t distance = (uint32_t)(((high & 0xF) << 8) | low) + 1;
+
+      for(uint32_t j = 0; j < length && out.Written() < size; j++)
+      {
+        out.Write(out.Back(distance));
+      }
+    }
+  }
+
+  parent->Cycles -= size * BIOS_UNIT_CYCLES;
+}
+
+//SWI 13h, header bits 0-3 are the data size (4 or 8 bits) and 8-31 the decompressed size. The tree
+//follows (size byte, then nodes), then the bitstream as 32 bit words read from bit 31 down.
+//A node's low 6 bits give its children at (node address AND NOT 1) + offset * 2 + 2 and +3, bit 7
+//and 6 mark child 0 and 1 as data rather than nodes.
+void BiosHle::HuffUnComp()
+{
+  uint32_t source = parent->registers[0];
+  uint32_t dest = parent->registers[1] & ~3U;
+  uint32_t header = parent->ReadU32(source);
+  uint32_t dataBits = header & 0xF;
+  uint32_t size = header >> 8;
+
+  if(dataBits != 4 && dataBits != 8)
+  {
+    return;
+  }
+
+  uint32_t tree = source + 4;
+  uint32_t root = tree + 1;
+  uint32_t stream = tree + ((uint32_t)parent->ReadU8(tree) + 1) * 2;
+  uint32_t node = root;
+  uint32_t out = 0;
+  uint32_t outBits = 0;
+  uint32_t written = 0;
+
+  while(written < size)
+  {
+    uint32_t bits = parent->ReadU32(stream);
+    stream += 4;
+
+    for(int32_t bit = 31; bit >= 0 && written < size; bit--)
+    {
+      uint32_t direction = (bits >> bit) & 1;
+      uint8_t value = parent->ReadU8(node);
+      uint32_t child = (node & ~1U) + (value & 0x3F) * 2 + 2 + direction;
+
+      if((value & (0x80 >> direction)) == 0)
+      {
+        node = child;
+        continue;
+      }
+
+      out |= (uint32_t)(parent->ReadU8(child) & ((1 << dataBits) - 1)) << outBits;
+      outBits += dataBits;
+      node = root;
+
+      if(outBits == 32)
+      {
+        parent->WriteU32(dest, out);
+        dest += 4;
+        written += 4;
+        out = 0;
+        outBits = 0;
+      }
+    }
+  }
+
+  parent->Cycles -= size * BIOS_UNIT_CYCLES;
+}
+
+//SWI 14h/15h, header word bits 8-31 hold the decompressed size. A flag byte with bit 7 set repeats
+//the next byte (flag & 7Fh) + 3 times, clear copies the next (flag & 7Fh) + 1 bytes.
+void BiosHle::RLUnComp(bool vram)
+{
+  uint32_t source = parent->registers[0];
+  uint32_t size = parent->ReadU32(source) >> 8;
+  BiosWriter out(parent, parent->registers[1], vram);
+
+  source += 4;
+
+  while(out.Written() < size)
+  {
+    uint8_t flag = parent->ReadU8(source++);
+
+    if((flag & 0x80) != 0)
+    {
+      uint8_t value = parent->ReadU8(source++);
+
+      for(uint32_t i = 0; i < (uint32_t)(flag & 0x7F) + 3 && out.Written() < size; i++)
+      {
+        out.Write(value);
+      }
+    }
+    else
+    {
+      for(uint32_t i = 0; i < (uint32_t)(flag & 0x7F) + 1 && out.Written() < size; i++)
+      {
+        out.Write(parent->ReadU8(source++));
+      }
+    }
+  }
+
+  parent->Cycles -= size * BIOS_UNIT_CYCLES;
+}
@@ -0,0 +1,77 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef BiosHle_h
+#define BiosHle_h
+
+#include <inttypes.h>
+
+#define BIOS_HLE //Run the common SWIs natively instead of through the BIOS image
+
+//Approximate cycles on top of the memory accesses each call makes
+#define BIOS_CALL_CYCLES 40   //SWI entry, dispatch and return
+#define BIOS_MATH_CYCLES 60   //Div, Sqrt, ArcTan
+#define BIOS_AFFINE_CYCLES 50 //Per BgAffineSet/ObjAffineSet entry
+#define BIOS_UNIT_CYCLES 3    //Per unit copied, filled or decompressed
+
+#define BIOS_IRQ_FLAGS 0x03007FF8 //Where the game's IRQ handler marks interrupts for IntrWait
+
+//Native versions of the BIOS SWIs games lean on, so they run without a BIOS image and
+//copies/decompression run as native loops. Memory goes through the normal bus accessors,
+//so wait states, dirty tracking and the caches see every access.
+class BiosHle
+{
+  public:
+    //Methods
+    void Begin(class Processor *par);
+    bool Call(uint32_t swi);
+
+  private:
+    class Processor *parent;
+    bool waiting = false; //IntrWait halted and will run again after the next interrupt
+
+    void RegisterRamReset(uint32_t flags);
+    void IntrWait(bool discard, uint16_t irqs);
+    void Div(int32_t numerator, int32_t denominator);
+    void Sqrt();
+    int32_t ArcTan(int32_t tan);
+    uint16_t ArcTan2(int32_t x, int32_t y);
+    void CpuSet();
+    void CpuFastSet();
+    void BgAffineSet();
+    void ObjAffineSet();
+    void BitUnPack();
+    void LZ77UnComp(bool vram);
+    void HuffUnComp();
+    void RLUnComp(bool vram);
+
+    int32_t Sine(uint32_t angle);
+    int32_t Cosine(uint32_t angle);
+    void Fill(uint32_t address, uint32_t length);
+    void FillIO(uint32_t first, uint32_t last);
+};
+
+extern BiosHle biosHle;
+
+#endif
@@ -0,0 +1,136 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <Arduino.h>
+#include "GBA_BlockCache.h"
+
+BlockCache blockCache;
+
+BlockCache::BlockCache()
+{
+  Invalidate();
+}
+
+//Claim the slot for address and start an empty block in it, NULL if the region isn't cached or the cache is off
+Block *BlockCache::Begin(uint32_t address, uint32_t mode)
+{
+  if(!enabled || (BLOCK_REGIONS & (1 << ((address >> 24) & 0xF))) == 0 || (address >> 28) != 0)
+  {
+    return NULL;
+  }
+
+  Block *block = &blocks[Index(address)];
+  block->tag = address | mode;
+  block->count = 0;
+  block->link = NULL;
+  recorded++;
+
+  uint32_t page = CodePage(address);
+
+  if(page != BLOCK_NO_PAGE && (codePages[page >> 5] & (1U << (page & 31))) == 0)
+  {
+    codePages[page >> 5] |= 1U << (page & 31);
+
+    if(page >= BLOCK_EWRAM_PAGES)
+    {
+      iwRamCodePages++;
+    }
+  }
+
+  return block;
+}
+
+void BlockCache::InvalidatePage(uint32_t page)
+{
+  for(uint32_t i = 0; i < BLOCK_CACHE_BLOCKS; i++)
+  {
+    if(blocks[i].tag != BLOCK_NO_TAG && CodePage(blocks[i].tag) == page)
+    {
+      blocks[i].tag = BLOCK_NO_TAG;
+      invalidations++;
+    }
+  }
+
+  codePages[page >> 5] &= ~(1U << (page & 31));
+
+  if(page >= BLOCK_EWRAM_PAGES)
+  {
+    iwRamCodePages--;
+  }
+}
+
+void BlockCache::Invalidate()
+{
+  for(uint32_t i = 0; i < BLOCK_CACHE_BLOCKS; i++)
+  {
+    blocks[i].tag = BLOCK_NO_TAG;
+    blocks[i].count = 0;
+    blocks[i].link = NULL;
+  }
+
+  for(uint32_t i = 0; i < (BLOCK_CODE_PAGES + 31) / 32; i++)
+  {
+    codePages[i] = 0;
+  }
+
+  iwRamCodePages = 0;
+}
+
+uint32_t BlockCache::BlockCount()
+{
+  uint32_t count = 0;
+
+  for(uint32_t i = 0; i < BLOCK_CACHE_BLOCKS; i++)
+  {
+    if(blocks[i].tag != BLOCK_NO_TAG)
+    {
+      count++;
+    }
+  }
+
+  return count;
+}
+
+void BlockCache::ResetCounters()
+{
+  lookups = 0;
+  hits = 0;
+  recorded = 0;
+  linked = 0;
+  fused = 0;
+  executed = 0;
+  invalidations = 0;
+  statsStart = millis();
+}
+
+void BlockCache::PrintStats(uint32_t frames)
+{
+  float hitRate = lookups == 0 ? 0.0f : ((float)hits * 100.0f) / (float)lookups;
+  uint32_t elapsed = millis() - statsStart;
+  float mips = elapsed == 0 ? 0.0f : (float)executed / ((float)elapsed * 1000.0f);
+  float fusedRate = executed == 0 ? 0.0f : ((float)fused * 200.0f) / (float)executed;
+
+  Serial.println("Block Cache Blocks: " + String(BlockCount(), DEC) + " Recorded: " + String(recorded, DEC) + " Invalidations: " + String(invalidations, DEC) + " Hit Rate: " + String(hitRate) + "% Linked: " + String(linked, DEC) + " MIPS: " + String(mips));
+  Serial.println("Block Cache Fused Pairs: " + String((float)fused / (float)frames) + "/frame (" + String(fusedRate) + "% of instructions)");
+}
@@ -0,0 +1,177 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef BlockCache_h
+#define BlockCache_h
+
+#include <inttypes.h>
+#include <stddef.h>
+
+//All must be powers of 2
+#define BLOCK_CACHE_BLOCKS 64 //Blocks in the cache
+#define BLOCK_MAX_OPS 16      //Instructions per block (64 blocks of 16 ops is 8KB)
+#define BLOCK_PAGE_SIZE 256   //Granularity of the code page write bitmap, blocks never cross a page
+
+#define BLOCK_LINKING //Run from the end of one block straight into the one that followed it last time
+
+//#define BLOCK_CACHE_STATS //Print block/hit/invalidation counters and emulated MIPS once a second
+
+#define BLOCK_ARM 0   //Mode bit stored in the low bit of the tag
+#define BLOCK_THUMB 1
+#define BLOCK_NO_TAG 0xFFFFFFFF
+
+//Regions blocks are recorded from, BIOS, EWRAM, IWRAM and cartridge ROM
+#define BLOCK_REGIONS ((1 << 0x0) | (1 << 0x2) | (1 << 0x3) | (0x3F << 0x8))
+
+//Only EWRAM and IWRAM can be written, they get a bit per code page
+#define BLOCK_EWRAM_PAGES (0x40000 / BLOCK_PAGE_SIZE)
+#define BLOCK_IWRAM_PAGES (0x8000 / BLOCK_PAGE_SIZE)
+#define BLOCK_CODE_PAGES (BLOCK_EWRAM_PAGES + BLOCK_IWRAM_PAGES)
+#define BLOCK_NO_PAGE 0xFFFFFFFF
+
+//One predecoded instruction, handler is its index in ArmHandlers or ThumbHandlers
+struct BlockOp
+{
+  uint32_t instruction;
+  uint16_t handler;
+  uint8_t fuse; //FUSE_* pair starting at this op, Thumb blocks only
+};
+
+//Straight-line run of instructions starting at the tag address
+struct Block
+{
+  uint32_t tag; //Address | BLOCK_ARM/BLOCK_THUMB
+  uint32_t count;
+  Block *link;  //Block that ran after this one, only valid while its tag still matches
+  BlockOp ops[BLOCK_MAX_OPS];
+};
+
+//Direct mapped cache of predecoded instruction runs, keyed by PC and ARM/Thumb state.
+//The cores record a block from their own fetches the first time they run an address, later
+//runs take the instructions and handlers from the block and only charge the fetch wait states.
+//A write to a code page drops every block recorded from it, IWRAM writes are only routed
+//through the handlers (and checked) while some IWRAM page holds a block.
+//Each block remembers its successor, so a hot loop chains block to block inside ExecuteBlock.
+class BlockCache
+{
+  public:
+    //Variables
+    uint32_t lookups = 0;
+    uint32_t hits = 0;
+    uint32_t recorded = 0;
+    uint32_t linked = 0;         //Blocks entered through a link instead of a lookup
+    uint32_t fused = 0;          //Thumb pairs run as one op
+    uint32_t executed = 0;       //Instructions run, only counted with BLOCK_CACHE_STATS
+    uint32_t statsStart = 0;     //millis() at the last ResetCounters
+    uint32_t invalidations = 0;  //Blocks dropped by writes, the cores compare it around each op
+    uint32_t iwRamCodePages = 0; //IWRAM pages holding blocks
+    bool enabled = true;         //Cleared to run the plain interpreter, recorded blocks still run until the next Invalidate
+
+    //Methods
+    BlockCache();
+    Block *Find(uint32_t address, uint32_t mode);
+    Block *Begin(uint32_t address, uint32_t mode);
+    Block *Link(Block *block, uint32_t address, uint32_t mode);
+    void Write(uint32_t address);
+    void Invalidate();
+    uint32_t BlockCount();
+    void ResetCounters();
+    void PrintStats(uint32_t frames);
+
+  private:
+    Block blocks[BLOCK_CACHE_BLOCKS];
+    uint32_t codePages[(BLOCK_CODE_PAGES + 31) / 32];
+
+    uint32_t Index(uint32_t address);
+    uint32_t CodePage(uint32_t address);
+    void InvalidatePage(uint32_t page);
+};
+
+extern BlockCache blockCache;
+
+inline uint32_t BlockCache::Index(uint32_t address)
+{
+  return ((address >> 1) ^ (address >> 7)) & (BLOCK_CACHE_BLOCKS - 1);
+}
+
+inline uint32_t BlockCache::CodePage(uint32_t address)
+{
+  switch((address >> 24) & 0xF)
+  {
+    case 0x2:
+      return (address & 0x3FFFF) / BLOCK_PAGE_SIZE;
+    case 0x3:
+      return BLOCK_EWRAM_PAGES + (address & 0x7FFF) / BLOCK_PAGE_SIZE;
+    default:
+      return BLOCK_NO_PAGE;
+  }
+}
+
+inline Block *BlockCache::Find(uint32_t address, uint32_t mode)
+{
+  Block *block = &blocks[Index(address)];
+  lookups++;
+
+  if(block->tag == (address | mode))
+  {
+    hits++;
+    return block;
+  }
+
+  return NULL;
+}
+
+//The block to run after block at address, through its link when that still holds address
+inline Block *BlockCache::Link(Block *block, uint32_t address, uint32_t mode)
+{
+  Block *next = block->link;
+
+  if(next != NULL && next->tag == (address | mode))
+  {
+    linked++;
+    return next;
+  }
+
+  next = Find(address, mode);
+
+  if(next != NULL)
+  {
+    block->link = next;
+  }
+
+  return next;
+}
+
+//Called for every EWRAM write and for IWRAM writes while iwRamCodePages is non zero
+inline void BlockCache::Write(uint32_t address)
+{
+  uint32_t page = CodePage(address);
+
+  if(page != BLOCK_NO_PAGE && (codePages[page >> 5] & (1U << (page & 31))) != 0)
+  {
+    InvalidatePage(page);
+  }
+}
+
+#endif
@@ -0,0 +1,190 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef Flags_h
+#define Flags_h
+
+#include <inttypes.h>
+
+//What the last flag setting op left behind, see LazyFlags::op
+#define FLAGS_NONE  0x0 //V is held in overFlow
+#define FLAGS_ADD   0x1 //C and V come from the last add
+#define FLAGS_SUB   0x2 //C and V come from the last subtract
+#define FLAGS_CARRY 0x4 //C is held in carry, it was set after the last add or subtract
+
+#define CARRY_UNCHANGED 2 //shifterCarry of a shift that leaves C alone
+
+//Which of the 16 NZCV combinations (bit N<<3 | Z<<2 | C<<1 | V) pass each condition code
+static const uint16_t ConditionTable[16] =
+{
+  0xF0F0, //EQ
+  0x0F0F, //NE
+  0xCCCC, //CS
+  0x3333, //CC
+  0xFF00, //MI
+  0x00FF, //PL
+  0xAAAA, //VS
+  0x5555, //VC
+  0x0C0C, //HI
+  0xF3F3, //LS
+  0xAA55, //GE
+  0x55AA, //LT
+  0x0A05, //GT
+  0xF5FA, //LE
+  0xFFFF, //AL
+  0x0000  //NV
+};
+
+//Flag setting ops only store their result (and operands for add and subtract), most are
+//overwritten before anything reads them. N, Z, C and V are worked out when a condition,
+//ADC/SBC/RRX or PackFlags needs them.
+class LazyFlags
+{
+  public:
+    uint32_t negative = 0; //N is bit 31
+    uint32_t zero = 1;     //Z is set when this is 0
+    uint32_t carry = 0;
+    uint32_t overFlow = 0;
+    uint32_t operandA = 0; //Last add or subtract
+    uint32_t operandB = 0;
+    uint32_t result = 0;
+    uint32_t op = FLAGS_NONE | FLAGS_CARRY;
+
+    void SetNZ(uint32_t value);
+    void SetLogic(uint32_t value, uint32_t shifterCarry);
+    void SetAdd(uint32_t a, uint32_t b, uint32_t r);
+    void SetSub(uint32_t a, uint32_t b, uint32_t r);
+    void SetCarry(uint32_t value);
+    uint32_t Carry();
+    uint32_t OverFlow();
+    uint32_t Nzcv();
+    bool Passes(uint32_t cond);
+    uint32_t Pack(uint32_t cpsr);
+    void Unpack(uint32_t cpsr);
+};
+
+inline void LazyFlags::SetNZ(uint32_t value)
+{
+  negative = value;
+  zero = value;
+}
+
+//Logical ops set C from the shifter unless it passed C through
+inline void LazyFlags::SetLogic(uint32_t value, uint32_t shifterCarry)
+{
+  negative = value;
+  zero = value;
+
+  if(shifterCarry != CARRY_UNCHANGED)
+  {
+    SetCarry(shifterCarry);
+  }
+}
+
+inline void LazyFlags::SetAdd(uint32_t a, uint32_t b, uint32_t r)
+{
+  negative = r;
+  zero = r;
+  operandA = a;
+  operandB = b;
+  result = r;
+  op = FLAGS_ADD;
+}
+
+inline void LazyFlags::SetSub(uint32_t a, uint32_t b, uint32_t r)
+{
+  negative = r;
+  zero = r;
+  operandA = a;
+  operandB = b;
+  result = r;
+  op = FLAGS_SUB;
+}
+
+//V stays with the last add or subtract
+inline void LazyFlags::SetCarry(uint32_t value)
+{
+  carry = value;
+  op |= FLAGS_CARRY;
+}
+
+inline uint32_t LazyFlags::Carry()
+{
+  uint32_t a = operandA;
+  uint32_t b = operandB;
+  uint32_t r = result;
+
+  switch(op)
+  {
+    case FLAGS_ADD:
+      return ((a & b) | (a & ~r) | (b & ~r)) >> 31;
+    case FLAGS_SUB:
+      return ((a & ~b) | (a & ~r) | (~b & ~r)) >> 31;
+    default:
+      return carry;
+  }
+}
+
+inline uint32_t LazyFlags::OverFlow()
+{
+  uint32_t a = operandA;
+  uint32_t b = operandB;
+  uint32_t r = result;
+
+  switch(op & ~FLAGS_CARRY)
+  {
+    case FLAGS_ADD:
+      return ((a & b & ~r) | (~a & ~b & r)) >> 31;
+    case FLAGS_SUB:
+      return ((a & ~b & ~r) | (~a & b & r)) >> 31;
+    default:
+      return overFlow;
+  }
+}
+
+inline uint32_t LazyFlags::Nzcv()
+{
+  return ((negative >> 28) & 0x8) | (zero == 0 ? 0x4 : 0) | (Carry() << 1) | OverFlow();
+}
+
+inline bool LazyFlags::Passes(uint32_t cond)
+{
+  return ((ConditionTable[cond] >> Nzcv()) & 1) != 0;
+}
+
+inline uint32_t LazyFlags::Pack(uint32_t cpsr)
+{
+  return (cpsr & 0x0FFFFFFF) | (Nzcv() << 28);
+}
+
+inline void LazyFlags::Unpack(uint32_t cpsr)
+{
+  negative = cpsr;
+  zero = ~cpsr & 0x40000000;
+  carry = (cpsr >> 29) & 1;
+  overFlow = (cpsr >> 28) & 1;
+  op = FLAGS_NONE | FLAGS_CARRY;
+}
+
+#endif
@@ -0,0 +1,95 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <Arduino.h>
+#include <string.h>
+#include "GBA_IdleLoop.h"
+
+IdleLoop idleLoop;
+
+//Games whose idle loop is known, or that misbehave when their loops are skipped.
+//{"ABCE", 0x08000ABC} sleeps whenever that game branches back to 0x08000ABC,
+//{"ABCE", IDLE_LOOP_NONE} never sleeps. The empty code ends the list.
+static const IdleLoopOverride idleLoopOverrides[] =
+{
+  {"", IDLE_LOOP_NONE}
+};
+
+void IdleLoop::Begin(uint32_t gameCode)
+{
+  enabled = true;
+  overrideAddress = IDLE_LOOP_NONE;
+  target = IDLE_LOOP_NONE;
+  Wake();
+
+  for(uint32_t i = 0; idleLoopOverrides[i].gameCode[0] != 0; i++)
+  {
+    const char *code = idleLoopOverrides[i].gameCode;
+
+    if(gameCode == (uint32_t)(code[0] | (code[1] << 8) | (code[2] << 16) | (code[3] << 24)))
+    {
+      overrideAddress = idleLoopOverrides[i].address;
+      enabled = overrideAddress != IDLE_LOOP_NONE;
+      break;
+    }
+  }
+}
+
+//Called after a short backward branch, registers[15] holds the branch target.
+//Returns true when the loop has gone round once without changing anything.
+bool IdleLoop::Branch(const uint32_t *registers, uint32_t cpsr)
+{
+  if(!enabled)
+  {
+    return false;
+  }
+
+  //Stores (an IF acknowledge, a FIFO or DMA trigger) are side effects even when they leave the registers alone
+  if(writes == lastWrites && (registers[15] == overrideAddress || (registers[15] == target && cpsr == lastCpsr && memcmp(registers, lastRegisters, sizeof(lastRegisters)) == 0)))
+  {
+    idle = true;
+    loopsFound++;
+    return true;
+  }
+
+  target = registers[15];
+  lastCpsr = cpsr;
+  lastWrites = writes;
+  memcpy(lastRegisters, registers, sizeof(lastRegisters));
+  return false;
+}
+
+void IdleLoop::ResetCounters()
+{
+  cyclesSkipped = 0;
+  loopsFound = 0;
+}
+
+void IdleLoop::PrintStats(uint32_t frames)
+{
+  //280896 cycles per frame
+  float skipped = (float)cyclesSkipped / (float)frames;
+
+  Serial.println("Idle Loop Skipped: " + String(skipped) + " cycles/frame (" + String(skipped * 100.0f / 280896.0f) + "%) Sleeps: " + String(loopsFound, DEC));
+}
@@ -0,0 +1,82 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef IdleLoop_h
+#define IdleLoop_h
+
+#include <inttypes.h>
+
+#define IDLE_LOOP_BYTES 32         //Only backward branches this short are checked
+#define IDLE_LOOP_NONE 0xFFFFFFFF  //Override address that turns detection off for a game
+
+//#define IDLE_LOOP_STATS //Print cycles skipped per frame once a second
+
+//Per game override, keyed by the 4 character game code at 0x080000AC in the ROM header
+struct IdleLoopOverride
+{
+  char gameCode[5];
+  uint32_t address; //Branch target of the game's idle loop, or IDLE_LOOP_NONE
+};
+
+//Finds loops that spin on memory without changing anything, polling VCOUNT, DISPSTAT, IF or a
+//flag an interrupt handler sets. A short backward branch that lands on the same target with the
+//same registers and CPSR as the last time, and with no store in between, went round once without
+//changing any state, so until something outside the CPU changes (line/HBlank/VBlank, an interrupt
+//request, a key) it would only keep spinning. The CPU then sleeps like a halt and the rest of
+//each Execute is skipped.
+class IdleLoop
+{
+  public:
+    //Variables
+    bool idle = false;
+    uint32_t cyclesSkipped = 0;
+    uint32_t loopsFound = 0;
+    uint32_t writes = 0; //Bumped by every store through the bus, a loop that stores isn't idle
+
+    //Methods
+    void Begin(uint32_t gameCode);
+    bool Branch(const uint32_t *registers, uint32_t cpsr);
+    void Wake();
+    void ResetCounters();
+    void PrintStats(uint32_t frames);
+
+  private:
+    bool enabled = true;
+    uint32_t overrideAddress = IDLE_LOOP_NONE;
+    uint32_t target = IDLE_LOOP_NONE;
+    uint32_t lastCpsr = 0;
+    uint32_t lastWrites = 0;
+    uint32_t lastRegisters[15];
+};
+
+extern IdleLoop idleLoop;
+
+//Anything that can change what an idle loop reads ends the idle state. The last registers are
+//kept, if the loop reads nothing new it goes straight back to sleep at its next branch.
+inline void IdleLoop::Wake()
+{
+  idle = false;
+}
+
+#endif
@@ -0,0 +1,261 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include "GBA_Placement.h"
+#include "GBA_Arm7.h"
+#include "GBA_ROMCache.h"
+#include "GBA_SoundManager.h"
+#include <ILI9341_t3.h>
+
+//Everything else in internal RAM, the DMAMEM framebuffer in ILI9341_t3DMA.cpp, the Processor and the caches
+#define PLACEMENT_FIXED_RAM (ILI9341_TFTWIDTH * ILI9341_TFTHEIGHT * 2 + sizeof(Processor) + sizeof(ROMCache) + sizeof(BlockCache) + sizeof(SRAMCache) + sizeof(SoundManager))
+
+static_assert(PLACEMENT_SLOTS <= 32, "Plan keeps a bit per slot");
+static_assert(PLACEMENT_FIXED_RAM + sizeof(PlacementPlanner) + PLACEMENT_HEADROOM <= PLACEMENT_RAM, "PLACEMENT_BUDGET doesn't fit in internal RAM next to the framebuffer, Processor and caches");
+
+PlacementPlanner placement;
+
+//Games whose placement is known, e.g. from the "Placement for" line printed after a plan.
+//{"ABCE", {0x00000, 0x41000, PLACEMENT_NO_BLOCK, PLACEMENT_NO_BLOCK}} pins the first EWRAM block
+//and a VRAM block at boot and never moves them. The empty code ends the list.
+static const PlacementOverride placementOverrides[] =
+{
+  {"", {PLACEMENT_NO_BLOCK, PLACEMENT_NO_BLOCK, PLACEMENT_NO_BLOCK, PLACEMENT_NO_BLOCK}}
+};
+
+PlacementPlanner::PlacementPlanner()
+{
+  for(uint32_t i = 0; i < PLACEMENT_SLOTS; i++)
+  {
+    slots[i] = PLACEMENT_NO_BLOCK;
+    slotRatio[i] = 0;
+  }
+}
+
+//Called from LoadCartridge, the last game's placement and profile say nothing about this one
+void PlacementPlanner::Begin(uint32_t gameCode)
+{
+  this->gameCode = gameCode;
+  frames = 0;
+  fixed = false;
+
+  for(uint32_t slot = 0; slot < PLACEMENT_SLOTS; slot++)
+  {
+    Unplace(slot);
+  }
+
+  sramCache.ResetProfile();
+
+  for(uint32_t i = 0; placementOverrides[i].gameCode[0] != 0; i++)
+  {
+    const char *code = placementOverrides[i].gameCode;
+
+    if(gameCode == (uint32_t)(code[0] | (code[1] << 8) | (code[2] << 16) | (code[3] << 24)))
+    {
+      fixed = true;
+
+      for(uint32_t slot = 0; slot < PLACEMENT_SLOTS && slot < PLACEMENT_OVERRIDE_BLOCKS; slot++)
+      {
+        if(placementOverrides[i].blocks[slot] != PLACEMENT_NO_BLOCK)
+        {
+          Place(slot, placementOverrides[i].blocks[slot] & ~(SRAM_PIN_BLOCK_SIZE - 1), 0x10000); //No profile, every access counts as a line
+        }
+      }
+      break;
+    }
+  }
+}
+
+void PlacementPlanner::ReportLayout()
+{
+  Serial.println("Memory Placement");
+  Serial.println("  Internal: IWRAM 32KB, IO 1KB, Palette 1KB, OAM 1KB");
+  Serial.println("  SRAM:     EWRAM 0x" + String(ewRamStart, HEX) + ", VRAM 0x" + String(vRamStart, HEX) + ", Save 0x" + String(sRamStart, HEX) + ", EEPROM 0x" + String(eeStart, HEX));
+  Serial.println("  RAM:      " + String((uint32_t)(PLACEMENT_FIXED_RAM / 1024), DEC) + "KB framebuffer, Processor and caches, " + String(PLACEMENT_BUDGET / 1024, DEC) + "KB placement, " + String(PLACEMENT_HEADROOM / 1024, DEC) + "KB headroom of " + String(PLACEMENT_RAM / 1024, DEC) + "KB");
+  Serial.println("  Budget:   " + String(PLACEMENT_SLOTS, DEC) + " x " + String(SRAM_PIN_BLOCK_SIZE, DEC) + " byte blocks, " + (fixed ? String("fixed for this game") : "revisited every " + String(PLACEMENT_PROFILE_FRAMES, DEC) + " frames"));
+
+  if(fixed)
+  {
+    PrintPlacement();
+  }
+}
+
+void PlacementPlanner::EndFrame()
+{
+  if(++frames < PLACEMENT_PROFILE_FRAMES) return;
+
+  frames = 0;
+
+  if(!fixed)
+  {
+    Plan();
+  }
+
+  sramCache.ResetProfile();
+}
+
+void PlacementPlanner::Plan()
+{
+  uint32_t total = 0;
+  uint32_t moved = 0; //Slots filled by this plan, each slot changes at most once a plan
+
+  for(uint32_t i = 0; i < SRAM_PIN_BLOCKS; i++)
+  {
+    total += Traffic(i * SRAM_PIN_BLOCK_SIZE);
+  }
+
+  //Every block costs the same, so the busiest unplaced block takes a free slot or the quietest
+  //placed block's slot for as long as it saves more traffic than the move costs
+  while(true)
+  {
+    uint32_t best = PLACEMENT_NO_BLOCK;
+    uint32_t bestTraffic = 0;
+
+    for(uint32_t i = 0; i < SRAM_PIN_BLOCKS; i++)
+    {
+      if(sramCache.blockTraffic[i] > bestTraffic && !sramCache.IsPinned(i * SRAM_PIN_BLOCK_SIZE))
+      {
+        best = i;
+        bestTraffic = sramCache.blockTraffic[i];
+      }
+    }
+
+    if(best == PLACEMENT_NO_BLOCK) break;
+
+    uint32_t slot = PLACEMENT_NO_BLOCK;
+    uint32_t slotTraffic = 0xFFFFFFFF;
+
+    for(uint32_t i = 0; i < PLACEMENT_SLOTS; i++)
+    {
+      if((moved & (1U << i)) != 0) continue;
+
+      uint32_t traffic = slots[i] == PLACEMENT_NO_BLOCK ? 0 : Traffic(slots[i]);
+
+      if(slots[i] == PLACEMENT_NO_BLOCK || traffic < slotTraffic)
+      {
+        slot = i;
+        slotTraffic = traffic;
+      }
+
+      if(slots[i] == PLACEMENT_NO_BLOCK) break;
+    }
+
+    if(slot == PLACEMENT_NO_BLOCK) break;
+
+    uint32_t cost = slots[slot] == PLACEMENT_NO_BLOCK ? PLACEMENT_MOVE_LINES : 2 * PLACEMENT_MOVE_LINES;
+
+    if(bestTraffic <= slotTraffic + cost) break;
+
+    uint32_t address = best * SRAM_PIN_BLOCK_SIZE;
+
+    if(slots[slot] == PLACEMENT_NO_BLOCK)
+    {
+      Serial.println("  Placed " + String(RegionName(address)) + " 0x" + String(address, HEX) + " (" + String(bestTraffic, DEC) + " lines)");
+    }
+    else
+    {
+      Serial.println("  Placed " + String(RegionName(address)) + " 0x" + String(address, HEX) + " (" + String(bestTraffic, DEC) + " lines) over " +
+                     String(RegionName(slots[slot])) + " 0x" + String(slots[slot], HEX) + " (" + String(slotTraffic, DEC) + " lines)");
+    }
+
+    Unplace(slot);
+    Place(slot, address, (uint32_t)(((uint64_t)bestTraffic << 16) / sramCache.blockAccesses[best]));
+    moved |= 1U << slot;
+  }
+
+  if(moved == 0) return;
+
+  uint32_t saved = 0;
+
+  for(uint32_t slot = 0; slot < PLACEMENT_SLOTS; slot++)
+  {
+    if(slots[slot] != PLACEMENT_NO_BLOCK)
+    {
+      saved += Traffic(slots[slot]);
+    }
+  }
+
+  //Each line of traffic is one burst of SRAM_CACHE_LINE_SIZE bytes
+  uint32_t savedPerFrame = (saved * SRAM_CACHE_LINE_SIZE) / PLACEMENT_PROFILE_FRAMES;
+  float share = total == 0 ? 0.0f : ((float)saved * 100.0f) / (float)total;
+
+  Serial.println("  Predicted SRAM traffic saved: " + String(savedPerFrame, DEC) + " bytes/frame (" + String(share) + "%)");
+  PrintPlacement();
+}
+
+void PlacementPlanner::Place(uint32_t slot, uint32_t address, uint32_t ratio)
+{
+#if PLACEMENT_SLOTS > 0
+  sramCache.Pin(address, store[slot]);
+#endif
+  slots[slot] = address;
+  slotRatio[slot] = ratio;
+}
+
+void PlacementPlanner::Unplace(uint32_t slot)
+{
+  if(slots[slot] == PLACEMENT_NO_BLOCK) return;
+
+  sramCache.Unpin(slots[slot]);
+  slots[slot] = PLACEMENT_NO_BLOCK;
+}
+
+//Line traffic of the block at address over this window, estimated for placed blocks
+uint32_t PlacementPlanner::Traffic(uint32_t address)
+{
+  uint32_t block = (address / SRAM_PIN_BLOCK_SIZE) & (SRAM_PIN_BLOCKS - 1);
+
+  for(uint32_t slot = 0; slot < PLACEMENT_SLOTS; slot++)
+  {
+    if(slots[slot] == address)
+    {
+      return (uint32_t)(((uint64_t)sramCache.blockAccesses[block] * slotRatio[slot] + 0x8000) >> 16);
+    }
+  }
+
+  return sramCache.blockTraffic[block];
+}
+
+//In the form placementOverrides takes, so a game's placement can be fixed from boot
+void PlacementPlanner::PrintPlacement()
+{
+  char code[5] = { (char)(gameCode & 0xFF), (char)((gameCode >> 8) & 0xFF), (char)((gameCode >> 16) & 0xFF), (char)(gameCode >> 24), 0 };
+  String blocks = "";
+
+  for(uint32_t i = 0; i < PLACEMENT_OVERRIDE_BLOCKS; i++)
+  {
+    uint32_t address = i < PLACEMENT_SLOTS ? slots[i] : PLACEMENT_NO_BLOCK;
+    blocks = blocks + (i == 0 ? "" : ", ") + (address == PLACEMENT_NO_BLOCK ? String("PLACEMENT_NO_BLOCK") : "0x" + String(address, HEX));
+  }
+
+  Serial.println("  Placement for " + String(code) + ": {\"" + String(code) + "\", {" + blocks + "}}");
+}
+
+const char *PlacementPlanner::RegionName(uint32_t address)
+{
+  if(address >= eeStart) return "EEPROM";
+  if(address >= sRamStart) return "Save";
+  if(address >= vRamStart) return "VRAM";
+  return "EWRAM";
+}
@@ -0,0 +1,86 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef Placement_h
+#define Placement_h
+
+#include <inttypes.h>
+#include "GBA_SRAMCache.h"
+
+//Internal RAM handed to the planner. The 150KB DMAMEM framebuffer, the Processor (IWRAM, IOREG, PALRAM,
+//OAMRAM), the ROM, block and SRAM caches and the sound buffers take most of the Teensy 3.6's 256KB,
+//GBA_Placement.cpp checks at compile time that the budget fits in what's left. 0 disables placement.
+#define PLACEMENT_BUDGET (8 * 1024)
+#define PLACEMENT_RAM (256 * 1024)     //Teensy 3.6
+#define PLACEMENT_HEADROOM (16 * 1024) //Stack, heap, the Teensy core, SD and Audio buffers and the smaller globals
+#define PLACEMENT_SLOTS (PLACEMENT_BUDGET / SRAM_PIN_BLOCK_SIZE)
+#define PLACEMENT_PROFILE_FRAMES 120 //Frames in each profile window, the placement is revisited after every one
+#define PLACEMENT_MOVE_LINES (SRAM_PIN_BLOCK_SIZE / SRAM_CACHE_LINE_SIZE) //Bus cost of pinning or unpinning a block, in lines
+#define PLACEMENT_OVERRIDE_BLOCKS 4
+#define PLACEMENT_NO_BLOCK 0xFFFFFFFF
+
+//Per game placement, keyed by the 4 character game code at 0x080000AC in the ROM header
+struct PlacementOverride
+{
+  char gameCode[5];
+  uint32_t blocks[PLACEMENT_OVERRIDE_BLOCKS]; //SRAM addresses pinned at boot, PLACEMENT_NO_BLOCK pads
+};
+
+//Chooses which SRAM blocks (EWRAM pages, VRAM char blocks, save RAM) move into internal RAM.
+//The profile is the cache's per block line traffic for the running game over the last window.
+//After each window the busiest unplaced block replaces the quietest placed one for as long as
+//that saves more traffic than the move itself costs, so the placement follows the game from
+//its intro into play. Placed blocks don't miss, their traffic is estimated from their accesses
+//and the lines per access they had when they were placed. Games in placementOverrides get
+//their placement at boot and keep it.
+class PlacementPlanner
+{
+  public:
+    //Methods
+    PlacementPlanner();
+    void Begin(uint32_t gameCode);
+    void ReportLayout();
+    void EndFrame();
+    void Plan();
+
+  private:
+    uint32_t gameCode = 0;
+    uint32_t frames = 0;
+    bool fixed = false;                  //Placement came from placementOverrides
+    uint32_t slots[PLACEMENT_SLOTS];     //SRAM address placed in each slot
+    uint32_t slotRatio[PLACEMENT_SLOTS]; //Lines per access of the block when it was placed, 16.16 fixed point
+#if PLACEMENT_SLOTS > 0
+    uint8_t store[PLACEMENT_SLOTS][SRAM_PIN_BLOCK_SIZE];
+#endif
+
+    void Place(uint32_t slot, uint32_t address, uint32_t ratio);
+    void Unplace(uint32_t slot);
+    uint32_t Traffic(uint32_t address);
+    void PrintPlacement();
+    const char *RegionName(uint32_t address);
+};
+
+extern PlacementPlanner placement;
+
+#endif
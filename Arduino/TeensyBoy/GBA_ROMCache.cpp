@@ -0,0 +1,157 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include "GBA_ROMCache.h"
+
+ROMCache::ROMCache()
+{
+  for(uint32_t i = 0; i < ROM_CACHE_PAGES; i++)
+  {
+    tags[i] = ROM_CACHE_NO_PAGE;
+    stamps[i] = 0;
+  }
+}
+
+void ROMCache::Begin(File *rom, uint32_t romSize)
+{
+  file = rom;
+  size = romSize;
+  Invalidate();
+}
+
+uint8_t *ROMCache::Lookup(uint32_t tag)
+{
+  int32_t index = FindPage(tag);
+
+  if(index < 0)
+  {
+    return Miss(tag);
+  }
+
+  hits++;
+  stamps[index] = ++clock;
+  lastTag = tag;
+  lastPage = pages[index];
+  return lastPage;
+}
+
+uint8_t *ROMCache::Miss(uint32_t tag)
+{
+  misses++;
+  uint32_t start = ARM_DWT_CYCCNT;
+
+  uint32_t index = OldestPage();
+  FillPage(index, tag);
+  stamps[index] = ++clock;
+
+#ifdef ROM_CACHE_PREFETCH
+  //The next page follows straight on in the file, most code runs sequentially into it
+  uint32_t next = tag + 1;
+  if(next * ROM_CACHE_PAGE_SIZE < size && FindPage(next) < 0)
+  {
+    uint32_t nextIndex = OldestPage();
+    FillPage(nextIndex, next);
+    stamps[nextIndex] = clock;
+    prefetches++;
+  }
+#endif
+
+  missCycles += ARM_DWT_CYCCNT - start;
+
+  lastTag = tag;
+  lastPage = pages[index];
+  return lastPage;
+}
+
+int32_t ROMCache::FindPage(uint32_t tag)
+{
+  for(uint32_t i = 0; i < ROM_CACHE_PAGES; i++)
+  {
+    if(tags[i] == tag)
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+uint32_t ROMCache::OldestPage()
+{
+  uint32_t oldest = 0;
+
+  for(uint32_t i = 0; i < ROM_CACHE_PAGES; i++)
+  {
+    if(tags[i] == ROM_CACHE_NO_PAGE)
+    {
+      return i;
+    }
+
+    if(stamps[i] < stamps[oldest])
+    {
+      oldest = i;
+    }
+  }
+
+  return oldest;
+}
+
+void ROMCache::FillPage(uint32_t index, uint32_t tag)
+{
+  //One block read per page instead of a seek and read per byte
+  file->seek(tag * ROM_CACHE_PAGE_SIZE);
+  file->read(pages[index], ROM_CACHE_PAGE_SIZE);
+
+  tags[index] = tag;
+}
+
+void ROMCache::Invalidate()
+{
+  for(uint32_t i = 0; i < ROM_CACHE_PAGES; i++)
+  {
+    tags[i] = ROM_CACHE_NO_PAGE;
+    stamps[i] = 0;
+  }
+
+  clock = 0;
+  lastTag = ROM_CACHE_NO_PAGE;
+  lastPage = NULL;
+}
+
+void ROMCache::ResetCounters()
+{
+  hits = 0;
+  misses = 0;
+  prefetches = 0;
+  missCycles = 0;
+}
+
+void ROMCache::PrintStats()
+{
+  uint32_t total = hits + misses;
+  float hitRate = total == 0 ? 0.0f : ((float)hits * 100.0f) / (float)total;
+  uint32_t missLatency = misses == 0 ? 0 : missCycles / misses;
+
+  Serial.println("ROM Cache Hits: " + String(hits, DEC) + " Misses: " + String(misses, DEC) + " Prefetches: " + String(prefetches, DEC) + " Hit Rate: " + String(hitRate) + "% Avg Miss: " + String(missLatency, DEC) + " cycles");
+}
@@ -0,0 +1,115 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef ROMCache_h
+#define ROMCache_h
+
+#include <inttypes.h>
+#include <SD.h>
+
+//Both must be powers of 2
+#define ROM_CACHE_PAGE_SIZE 512 //Bytes per page, one SD sector
+#define ROM_CACHE_PAGES 32      //Pages in the cache (16KB)
+
+#define ROM_CACHE_PREFETCH //Load the following page along with every miss
+//#define ROM_CACHE_STATS  //Print hit/miss/latency counters once a second
+
+#define ROM_CACHE_PAGE_MASK (ROM_CACHE_PAGE_SIZE - 1)
+#define ROM_CACHE_NO_PAGE 0xFFFFFFFF
+
+//Fully associative LRU cache of cartridge ROM pages in internal RAM.
+//Addresses are offsets into the ROM file, not GBA addresses.
+class ROMCache
+{
+  public:
+    //Variables
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t prefetches = 0;
+    uint32_t missCycles = 0; //CPU cycles spent waiting on the SD card
+
+    //Methods
+    ROMCache();
+    void Begin(File *rom, uint32_t romSize);
+    uint8_t Read8(uint32_t address);
+    uint16_t Read16(uint32_t address);
+    uint32_t Read32(uint32_t address);
+    void Invalidate();
+    void ResetCounters();
+    void PrintStats();
+
+  private:
+    File *file = NULL;
+    uint32_t size = 0;
+    uint8_t pages[ROM_CACHE_PAGES][ROM_CACHE_PAGE_SIZE];
+    uint32_t tags[ROM_CACHE_PAGES];
+    uint32_t stamps[ROM_CACHE_PAGES]; //Last time each page became the current one, oldest is evicted
+    uint32_t clock = 0;
+
+    //Page of the previous access, almost every fetch lands here
+    uint32_t lastTag = ROM_CACHE_NO_PAGE;
+    uint8_t *lastPage = NULL;
+
+    uint8_t *GetPage(uint32_t address);
+    uint8_t *Lookup(uint32_t tag);
+    uint8_t *Miss(uint32_t tag);
+    int32_t FindPage(uint32_t tag);
+    uint32_t OldestPage();
+    void FillPage(uint32_t index, uint32_t tag);
+};
+
+extern ROMCache romCache;
+
+inline uint8_t *ROMCache::GetPage(uint32_t address)
+{
+  uint32_t tag = address / ROM_CACHE_PAGE_SIZE;
+
+  if(tag == lastTag)
+  {
+    hits++;
+    return lastPage;
+  }
+
+  return Lookup(tag);
+}
+
+//Callers align 16/32 bit reads, so they never straddle a page
+inline uint8_t ROMCache::Read8(uint32_t address)
+{
+  return GetPage(address)[address & ROM_CACHE_PAGE_MASK];
+}
+
+inline uint16_t ROMCache::Read16(uint32_t address)
+{
+  uint8_t *page = GetPage(address) + (address & ROM_CACHE_PAGE_MASK);
+  return (uint16_t)(page[0] | (page[1] << 8));
+}
+
+inline uint32_t ROMCache::Read32(uint32_t address)
+{
+  uint8_t *page = GetPage(address) + (address & ROM_CACHE_PAGE_MASK);
+  return (uint32_t)(page[0] | (page[1] << 8) | (page[2] << 16) | (page[3] << 24));
+}
+
+#endif
@@ -0,0 +1,259 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include "GBA_SRAMCache.h"
+#include "GBA_Arm7.h"
+
+SRAMCache::SRAMCache()
+{
+  for(uint32_t i = 0; i < SRAM_CACHE_LINES; i++)
+  {
+    tags[i] = SRAM_CACHE_NO_LINE;
+    dirty[i] = false;
+  }
+
+  for(uint32_t i = 0; i < SRAM_PIN_BLOCKS; i++)
+  {
+    pinned[i] = NULL;
+  }
+
+  ResetProfile();
+}
+
+uint8_t *SRAMCache::Miss(uint32_t index, uint32_t tag)
+{
+  misses++;
+
+  if(tags[index] != SRAM_CACHE_NO_LINE)
+  {
+    evictions++;
+
+    if(dirty[index])
+    {
+      blockTraffic[((tags[index] * SRAM_CACHE_LINE_SIZE) / SRAM_PIN_BLOCK_SIZE) & (SRAM_PIN_BLOCKS - 1)]++;
+      QueueLine(index);
+    }
+  }
+
+  blockTraffic[((tag * SRAM_CACHE_LINE_SIZE) / SRAM_PIN_BLOCK_SIZE) & (SRAM_PIN_BLOCKS - 1)]++;
+  FillLine(index, tag);
+  return lines[index];
+}
+
+void SRAMCache::FillLine(uint32_t index, uint32_t tag)
+{
+  if(TakeQueuedLine(index, tag)) //Still waiting to be written, the queue has the newest copy
+  {
+    return;
+  }
+
+  SPIRAMReadBurst(tag * SRAM_CACHE_LINE_SIZE, lines[index], SRAM_CACHE_LINE_SIZE);
+
+  tags[index] = tag;
+  dirty[index] = false;
+}
+
+void SRAMCache::WriteBackLine(uint32_t index)
+{
+  SPIRAMWriteBurst(tags[index] * SRAM_CACHE_LINE_SIZE, lines[index], SRAM_CACHE_LINE_SIZE);
+
+  dirty[index] = false;
+}
+
+void SRAMCache::QueueLine(uint32_t index)
+{
+  if(queueCount == SRAM_WRITE_QUEUE_LINES)
+  {
+    DrainQueue();
+  }
+
+  uint8_t *src = lines[index];
+  uint8_t *dst = queueLines[queueCount];
+  for(uint32_t i = 0; i < SRAM_CACHE_LINE_SIZE; i++)
+  {
+    dst[i] = src[i];
+  }
+
+  queueTags[queueCount] = tags[index];
+  queueCount++;
+
+  dirty[index] = false;
+}
+
+bool SRAMCache::TakeQueuedLine(uint32_t index, uint32_t tag)
+{
+  for(uint32_t q = 0; q < queueCount; q++)
+  {
+    if(queueTags[q] == tag)
+    {
+      uint8_t *src = queueLines[q];
+      uint8_t *dst = lines[index];
+      for(uint32_t i = 0; i < SRAM_CACHE_LINE_SIZE; i++)
+      {
+        dst[i] = src[i];
+      }
+
+      tags[index] = tag;
+      dirty[index] = true; //Never reached the SRAM
+
+      //Fill the gap with the last entry, order does not matter as tags are unique
+      queueCount--;
+      if(q != queueCount)
+      {
+        queueTags[q] = queueTags[queueCount];
+        src = queueLines[queueCount];
+        dst = queueLines[q];
+        for(uint32_t i = 0; i < SRAM_CACHE_LINE_SIZE; i++)
+        {
+          dst[i] = src[i];
+        }
+      }
+
+      queueHits++;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void SRAMCache::DrainQueue()
+{
+  for(uint32_t q = 0; q < queueCount; q++)
+  {
+    SPIRAMWriteBurst(queueTags[q] * SRAM_CACHE_LINE_SIZE, queueLines[q], SRAM_CACHE_LINE_SIZE);
+  }
+
+  queueCount = 0;
+  queueDrains++;
+}
+
+void SRAMCache::ReadBlock(uint32_t address, uint8_t *dst, uint32_t count)
+{
+  while(count > 0)
+  {
+    uint32_t offSet = address & SRAM_CACHE_LINE_MASK;
+    uint32_t length = SRAM_CACHE_LINE_SIZE - offSet;
+    if(length > count) length = count;
+
+    uint8_t *line = GetLine(address) + offSet;
+    for(uint32_t i = 0; i < length; i++)
+    {
+      dst[i] = line[i];
+    }
+
+    address += length;
+    dst += length;
+    count -= length;
+  }
+}
+
+void SRAMCache::Pin(uint32_t address, uint8_t *store)
+{
+  address &= ~(SRAM_PIN_BLOCK_SIZE - 1);
+
+  //Nothing may still be waiting to reach this block, then drop its lines
+  Flush();
+
+  for(uint32_t i = 0; i < SRAM_CACHE_LINES; i++)
+  {
+    if(tags[i] != SRAM_CACHE_NO_LINE && (tags[i] * SRAM_CACHE_LINE_SIZE) / SRAM_PIN_BLOCK_SIZE == address / SRAM_PIN_BLOCK_SIZE)
+    {
+      tags[i] = SRAM_CACHE_NO_LINE;
+    }
+  }
+
+  SPIRAMReadBurst(address, store, SRAM_PIN_BLOCK_SIZE);
+  pinned[(address / SRAM_PIN_BLOCK_SIZE) & (SRAM_PIN_BLOCKS - 1)] = store;
+}
+
+void SRAMCache::Unpin(uint32_t address)
+{
+  uint32_t block = (address / SRAM_PIN_BLOCK_SIZE) & (SRAM_PIN_BLOCKS - 1);
+
+  if(pinned[block] == NULL) return;
+
+  SPIRAMWriteBurst(address & ~(SRAM_PIN_BLOCK_SIZE - 1), pinned[block], SRAM_PIN_BLOCK_SIZE);
+  pinned[block] = NULL;
+}
+
+bool SRAMCache::IsPinned(uint32_t address)
+{
+  return pinned[(address / SRAM_PIN_BLOCK_SIZE) & (SRAM_PIN_BLOCKS - 1)] != NULL;
+}
+
+//Start a new profile window, called by the placement planner after each plan
+void SRAMCache::ResetProfile()
+{
+  for(uint32_t i = 0; i < SRAM_PIN_BLOCKS; i++)
+  {
+    blockTraffic[i] = 0;
+    blockAccesses[i] = 0;
+  }
+}
+
+void SRAMCache::Flush()
+{
+  if(queueCount != 0)
+  {
+    DrainQueue();
+  }
+
+  for(uint32_t i = 0; i < SRAM_CACHE_LINES; i++)
+  {
+    if(tags[i] != SRAM_CACHE_NO_LINE && dirty[i])
+    {
+      WriteBackLine(i);
+    }
+  }
+}
+
+void SRAMCache::Invalidate()
+{
+  Flush();
+
+  for(uint32_t i = 0; i < SRAM_CACHE_LINES; i++)
+  {
+    tags[i] = SRAM_CACHE_NO_LINE;
+  }
+}
+
+void SRAMCache::ResetCounters()
+{
+  hits = 0;
+  misses = 0;
+  evictions = 0;
+  queueHits = 0;
+  queueDrains = 0;
+  SRAMTurnarounds = 0;
+}
+
+void SRAMCache::PrintStats()
+{
+  uint32_t total = hits + misses;
+  float hitRate = total == 0 ? 0.0f : ((float)hits * 100.0f) / (float)total;
+
+  Serial.println("SRAM Cache Hits: " + String(hits, DEC) + " Misses: " + String(misses, DEC) + " Evictions: " + String(evictions, DEC) + " Hit Rate: " + String(hitRate) + "%");
+  Serial.println("SRAM Write Queue Hits: " + String(queueHits, DEC) + " Drains: " + String(queueDrains, DEC) + " Bus Turnarounds: " + String(SRAMTurnarounds, DEC));
+}
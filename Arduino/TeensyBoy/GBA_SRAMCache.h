@@ -0,0 +1,211 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef SRAMCache_h
+#define SRAMCache_h
+
+#include <inttypes.h>
+#include <stddef.h>
+
+//Both must be powers of 2
+#define SRAM_CACHE_LINE_SIZE 32 //Bytes per line
+#define SRAM_CACHE_LINES 128    //Lines in the cache (4KB)
+#define SRAM_PIN_BLOCK_SIZE 4096 //Granularity of SRAM blocks that can be moved to internal RAM
+#define SRAM_WRITE_QUEUE_LINES 8 //Evicted dirty lines held back so they are written to the SRAM together
+
+//#define SRAM_CACHE_STATS //Print hit/miss/eviction counters once a second
+
+#define SRAM_SIZE 0x80000 //19 address lines
+#define SRAM_PIN_BLOCKS (SRAM_SIZE / SRAM_PIN_BLOCK_SIZE)
+#define SRAM_CACHE_LINE_MASK (SRAM_CACHE_LINE_SIZE - 1)
+#define SRAM_CACHE_NO_LINE 0xFFFFFFFF
+
+//Direct mapped write-back cache in internal RAM sitting in front of the external SRAM.
+//Addresses are SRAM addresses (RAMRange + offset), not GBA addresses.
+//Whole blocks can also be pinned to internal RAM, they then bypass the cache and the bus entirely.
+class SRAMCache
+{
+  public:
+    //Variables
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t evictions = 0;
+    uint32_t queueHits = 0;
+    uint32_t queueDrains = 0;
+    uint32_t blockTraffic[SRAM_PIN_BLOCKS];  //Lines filled and written back per block, the placement profile
+    uint32_t blockAccesses[SRAM_PIN_BLOCKS]; //Reads and writes per block, pinned blocks included
+
+    //Methods
+    SRAMCache();
+    uint8_t Read8(uint32_t address);
+    uint16_t Read16(uint32_t address);
+    uint32_t Read32(uint32_t address);
+    void Write8(uint32_t address, uint8_t value);
+    void Write16(uint32_t address, uint16_t value);
+    void Write32(uint32_t address, uint32_t value);
+    void ReadBlock(uint32_t address, uint8_t *dst, uint32_t count);
+    void Pin(uint32_t address, uint8_t *store);
+    void Unpin(uint32_t address);
+    bool IsPinned(uint32_t address);
+    void ResetProfile();
+    void Flush();
+    void Invalidate();
+    void ResetCounters();
+    void PrintStats();
+
+  private:
+    uint8_t lines[SRAM_CACHE_LINES][SRAM_CACHE_LINE_SIZE];
+    uint32_t tags[SRAM_CACHE_LINES];
+    bool dirty[SRAM_CACHE_LINES];
+    uint8_t *pinned[SRAM_PIN_BLOCKS]; //Internal RAM holding the block, NULL = cached from the SRAM
+
+    //Write-combining queue, the bus only turns around once per drain instead of once per dirty miss
+    uint8_t queueLines[SRAM_WRITE_QUEUE_LINES][SRAM_CACHE_LINE_SIZE];
+    uint32_t queueTags[SRAM_WRITE_QUEUE_LINES];
+    uint32_t queueCount = 0;
+
+    uint8_t *GetLine(uint32_t address);
+    uint8_t *GetWriteLine(uint32_t address);
+    uint8_t *Miss(uint32_t index, uint32_t tag);
+    void FillLine(uint32_t index, uint32_t tag);
+    void WriteBackLine(uint32_t index);
+    void QueueLine(uint32_t index);
+    bool TakeQueuedLine(uint32_t index, uint32_t tag);
+    void DrainQueue();
+};
+
+extern SRAMCache sramCache;
+
+inline uint8_t *SRAMCache::GetLine(uint32_t address)
+{
+  uint32_t block = (address / SRAM_PIN_BLOCK_SIZE) & (SRAM_PIN_BLOCKS - 1);
+  uint8_t *store = pinned[block];
+  blockAccesses[block]++;
+
+  if(store != NULL)
+  {
+    return store + (address & (SRAM_PIN_BLOCK_SIZE - 1) & ~SRAM_CACHE_LINE_MASK);
+  }
+
+  uint32_t tag = address / SRAM_CACHE_LINE_SIZE;
+  uint32_t index = tag & (SRAM_CACHE_LINES - 1);
+
+  if(tags[index] == tag)
+  {
+    hits++;
+    return lines[index];
+  }
+
+  return Miss(index, tag);
+}
+
+inline uint8_t *SRAMCache::GetWriteLine(uint32_t address)
+{
+  uint32_t block = (address / SRAM_PIN_BLOCK_SIZE) & (SRAM_PIN_BLOCKS - 1);
+  uint8_t *store = pinned[block];
+
+  if(store != NULL)
+  {
+    blockAccesses[block]++;
+    return store + (address & (SRAM_PIN_BLOCK_SIZE - 1) & ~SRAM_CACHE_LINE_MASK);
+  }
+
+  uint8_t *line = GetLine(address);
+  dirty[(address / SRAM_CACHE_LINE_SIZE) & (SRAM_CACHE_LINES - 1)] = true;
+  return line;
+}
+
+inline uint8_t SRAMCache::Read8(uint32_t address)
+{
+  return GetLine(address)[address & SRAM_CACHE_LINE_MASK];
+}
+
+inline uint16_t SRAMCache::Read16(uint32_t address)
+{
+  uint32_t offSet = address & SRAM_CACHE_LINE_MASK;
+
+  if(offSet > SRAM_CACHE_LINE_SIZE - 2) //Straddles two lines
+  {
+    return (uint16_t)(Read8(address) | (Read8(address + 1) << 8));
+  }
+
+  uint8_t *line = GetLine(address) + offSet;
+  return (uint16_t)(line[0] | (line[1] << 8));
+}
+
+inline uint32_t SRAMCache::Read32(uint32_t address)
+{
+  uint32_t offSet = address & SRAM_CACHE_LINE_MASK;
+
+  if(offSet > SRAM_CACHE_LINE_SIZE - 4) //Straddles two lines
+  {
+    return (uint32_t)(Read8(address) | (Read8(address + 1) << 8) | (Read8(address + 2) << 16) | (Read8(address + 3) << 24));
+  }
+
+  uint8_t *line = GetLine(address) + offSet;
+  return (uint32_t)(line[0] | (line[1] << 8) | (line[2] << 16) | (line[3] << 24));
+}
+
+inline void SRAMCache::Write8(uint32_t address, uint8_t value)
+{
+  GetWriteLine(address)[address & SRAM_CACHE_LINE_MASK] = value;
+}
+
+inline void SRAMCache::Write16(uint32_t address, uint16_t value)
+{
+  uint32_t offSet = address & SRAM_CACHE_LINE_MASK;
+
+  if(offSet > SRAM_CACHE_LINE_SIZE - 2) //Straddles two lines
+  {
+    Write8(address, (uint8_t)(value & 0xFF));
+    Write8(address + 1, (uint8_t)(value >> 8));
+    return;
+  }
+
+  uint8_t *line = GetWriteLine(address) + offSet;
+  line[0] = (uint8_t)(value & 0xFF);
+  line[1] = (uint8_t)(value >> 8);
+}
+
+inline void SRAMCache::Write32(uint32_t address, uint32_t value)
+{
+  uint32_t offSet = address & SRAM_CACHE_LINE_MASK;
+
+  if(offSet > SRAM_CACHE_LINE_SIZE - 4) //Straddles two lines
+  {
+    Write8(address, (uint8_t)(value & 0xFF));
+    Write8(address + 1, (uint8_t)((value >> 8) & 0xFF));
+    Write8(address + 2, (uint8_t)((value >> 16) & 0xFF));
+    Write8(address + 3, (uint8_t)(value >> 24));
+    return;
+  }
+
+  uint8_t *line = GetWriteLine(address) + offSet;
+  line[0] = (uint8_t)(value & 0xFF);
+  line[1] = (uint8_t)((value >> 8) & 0xFF);
+  line[2] = (uint8_t)((value >> 16) & 0xFF);
+  line[3] = (uint8_t)(value >> 24);
+}
+
+#endif
@@ -0,0 +1,218 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include "GBA_Arm7.h"
+
+#ifdef SRAM_HOST_MODEL
+
+SRAMModel sramModel;
+SRAMModelModeRegister SRAMModelModes[64];
+
+static const char *SRAMModelRegionNames[SRAM_MODEL_REGIONS] = { "EWRAM", "VRAM", "Save", "EEPROM" };
+
+SRAMModel::SRAMModel()
+{
+  for(uint8_t i = 0; i < 64; i++)
+  {
+    SRAMModelModes[i].pin = i;
+  }
+
+  for(uint8_t i = 0; i < SRAM_PORT_COUNT; i++)
+  {
+    pins[i] = 0;
+  }
+
+  pins[SRAM_PORT_B] = (1U << SRAM_MODEL_WE_BIT); //WE idles high, as set up by the Processor
+
+  memset(memory, 0, sizeof(memory));
+  memset(&pending, 0, sizeof(pending));
+  ResetStats();
+}
+
+void SRAMModel::PortSet(uint8_t port, uint32_t bits)
+{
+  pending.portWrites++;
+
+  //WE rising edge latches the data lines
+  if(port == SRAM_PORT_B && (bits & (1U << SRAM_MODEL_WE_BIT)) != 0 && (pins[SRAM_PORT_B] & (1U << SRAM_MODEL_WE_BIT)) == 0)
+  {
+    memory[Address()] = Data();
+    Charge(true);
+  }
+
+  pins[port] |= bits;
+  readPending = true;
+}
+
+void SRAMModel::PortClear(uint8_t port, uint32_t bits)
+{
+  pending.portWrites++;
+  pins[port] &= ~bits;
+  readPending = true;
+}
+
+uint32_t SRAMModel::PortRead(uint8_t port)
+{
+  pending.pinReads++;
+
+  uint32_t value = pins[port];
+
+  //OE low with the data lines as inputs, the SRAM drives them
+  if(!dataOutput && (pins[SRAM_PORT_B] & (1U << SRAM_MODEL_OE_BIT)) == 0)
+  {
+    uint8_t data = memory[Address()];
+
+    for(uint8_t i = 0; i < 8; i++)
+    {
+      if(SRAMDataPins[i].port == port)
+      {
+        value &= ~(1U << SRAMDataPins[i].bit);
+        value |= (uint32_t)((data >> i) & 0x01) << SRAMDataPins[i].bit;
+      }
+    }
+
+    if(readPending)
+    {
+      readPending = false;
+      Charge(false);
+    }
+  }
+
+  return value;
+}
+
+void SRAMModel::PortMode(uint8_t pin, uint8_t output)
+{
+  pending.modeWrites++;
+
+  //DIO0 leads every direction change
+  if(pin == SRAM_MODEL_DIO0 && (output != 0) != dataOutput)
+  {
+    dataOutput = output != 0;
+    pending.turnarounds++;
+  }
+}
+
+void SRAMModel::AddressUpdate(bool full)
+{
+  if(full)
+  {
+    pending.fullAddress++;
+  }
+  else
+  {
+    pending.partialAddress++;
+  }
+}
+
+uint32_t SRAMModel::Cycles(const SRAMModelStats *s)
+{
+  return s->portWrites * SRAM_MODEL_PORT_CYCLES + s->modeWrites * SRAM_MODEL_MODE_CYCLES + s->pinReads * SRAM_MODEL_PIN_CYCLES +
+         s->fullAddress * SRAM_MODEL_FULL_CYCLES + s->partialAddress * SRAM_MODEL_PARTIAL_CYCLES;
+}
+
+//Once per frame from EnterVBlank
+void SRAMModel::Report()
+{
+  Serial.println("SRAM Model Frame " + String(frame++, DEC));
+
+  for(uint8_t i = 0; i < SRAM_MODEL_REGIONS; i++)
+  {
+    SRAMModelStats *s = &stats[i];
+    uint32_t accesses = s->reads + s->writes;
+
+    if(accesses == 0) continue;
+
+    uint32_t cycles = Cycles(s);
+
+    Serial.println("  " + String(SRAMModelRegionNames[i]) + ": R " + String(s->reads, DEC) + " W " + String(s->writes, DEC) +
+                   " Ports " + String(s->portWrites, DEC) + " Modes " + String(s->modeWrites, DEC) + " Turn " + String(s->turnarounds, DEC) +
+                   " Full " + String(s->fullAddress, DEC) + " Part " + String(s->partialAddress, DEC) +
+                   " Cycles " + String(cycles, DEC) + " (" + String(cycles / accesses, DEC) + "/access)");
+  }
+
+  ResetStats();
+}
+
+void SRAMModel::ResetStats()
+{
+  memset(stats, 0, sizeof(stats));
+}
+
+uint32_t SRAMModel::Address()
+{
+  uint32_t address = 0;
+
+  for(uint8_t i = 0; i < 19; i++)
+  {
+    address |= ((pins[SRAMAddressPins[i].port] >> SRAMAddressPins[i].bit) & 0x01) << i;
+  }
+
+  return address;
+}
+
+uint8_t SRAMModel::Data()
+{
+  uint8_t data = 0;
+
+  for(uint8_t i = 0; i < 8; i++)
+  {
+    data |= ((pins[SRAMDataPins[i].port] >> SRAMDataPins[i].bit) & 0x01) << i;
+  }
+
+  return data;
+}
+
+//An access completed, it pays for the bus work leading up to it
+void SRAMModel::Charge(bool write)
+{
+  uint32_t address = Address();
+  uint8_t region = address >= eeStart ? 3 : address >= sRamStart ? 2 : address >= vRamStart ? 1 : 0;
+
+  if(write)
+  {
+    pending.writes++;
+  }
+  else
+  {
+    pending.reads++;
+  }
+
+  Add(&stats[region], &pending);
+  memset(&pending, 0, sizeof(pending));
+}
+
+void SRAMModel::Add(SRAMModelStats *to, const SRAMModelStats *from)
+{
+  to->reads += from->reads;
+  to->writes += from->writes;
+  to->portWrites += from->portWrites;
+  to->modeWrites += from->modeWrites;
+  to->pinReads += from->pinReads;
+  to->turnarounds += from->turnarounds;
+  to->fullAddress += from->fullAddress;
+  to->partialAddress += from->partialAddress;
+}
+
+#endif
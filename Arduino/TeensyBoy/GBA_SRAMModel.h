@@ -0,0 +1,138 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef SRAMModel_h
+#define SRAMModel_h
+
+//Host stand-in for the external SRAM bus, enabled with SRAM_HOST_MODEL by host/Makefile.
+//The GPIO registers and portModeRegister used by the SRAM functions in GBA_Arm7.h are replaced
+//with counting registers backed by a modelled 512KB SRAM, so cache, burst and placement changes
+//can be measured on Linux with the same code that runs on the Teensy.
+
+#if defined(__arm__) || defined(TEENSYDUINO)
+#error "SRAM_HOST_MODEL is for the Linux build in host/, the modelled 512KB SRAM doesn't fit in the Teensy's RAM"
+#endif
+
+#include <inttypes.h>
+
+#define SRAM_MODEL_REGIONS 4 //EWRAM, VRAM, Save, EEPROM
+
+//Estimated Teensy 3.6 cycles (180MHz), calibrate against the DWT timings in TeensyBoy.ino
+#define SRAM_MODEL_PORT_CYCLES 2     //Store to a GPIO set/clear register
+#define SRAM_MODEL_MODE_CYCLES 4     //Store to a pin config register
+#define SRAM_MODEL_PIN_CYCLES 2      //Load from a GPIO input register
+#define SRAM_MODEL_FULL_CYCLES 14    //Table loads and ORs for all 19 address lines
+#define SRAM_MODEL_PARTIAL_CYCLES 5  //Table load for the low 8 address lines
+
+#define SRAM_MODEL_WE_BIT 18 //GPIOB
+#define SRAM_MODEL_OE_BIT 19 //GPIOB
+#define SRAM_MODEL_DIO0 2    //Teensy pin of DIO0, switched first on every direction change
+
+struct SRAMModelStats
+{
+  uint32_t reads;
+  uint32_t writes;
+  uint32_t portWrites;
+  uint32_t modeWrites;
+  uint32_t pinReads;
+  uint32_t turnarounds;
+  uint32_t fullAddress;
+  uint32_t partialAddress;
+};
+
+class SRAMModel
+{
+  public:
+    uint8_t memory[0x80000];
+    SRAMModelStats stats[SRAM_MODEL_REGIONS];
+
+    //Methods
+    SRAMModel();
+    void PortSet(uint8_t port, uint32_t bits);
+    void PortClear(uint8_t port, uint32_t bits);
+    uint32_t PortRead(uint8_t port);
+    void PortMode(uint8_t pin, uint8_t output);
+    void AddressUpdate(bool full);
+    uint32_t Cycles(const SRAMModelStats *s);
+    void Report();
+    void ResetStats();
+
+  private:
+    uint32_t pins[5];
+    bool dataOutput = false;
+    bool readPending = true;
+    uint32_t frame = 0;
+    SRAMModelStats pending; //Bus work since the last access, charged to that access's region
+
+    uint32_t Address();
+    uint8_t Data();
+    void Charge(bool write);
+    void Add(SRAMModelStats *to, const SRAMModelStats *from);
+};
+
+extern SRAMModel sramModel;
+
+//Register stand-ins, each store or load goes through the model
+struct SRAMModelSetRegister
+{
+  uint8_t port;
+  void operator=(uint32_t bits) const { sramModel.PortSet(port, bits); }
+};
+
+struct SRAMModelClearRegister
+{
+  uint8_t port;
+  void operator=(uint32_t bits) const { sramModel.PortClear(port, bits); }
+};
+
+struct SRAMModelInputRegister
+{
+  uint8_t port;
+  operator uint32_t() const { return sramModel.PortRead(port); }
+};
+
+struct SRAMModelModeRegister
+{
+  uint8_t pin;
+  void operator=(uint8_t output) { sramModel.PortMode(pin, output); }
+};
+
+extern SRAMModelModeRegister SRAMModelModes[64];
+
+#define GPIOA_PSOR (SRAMModelSetRegister{SRAM_PORT_A})
+#define GPIOB_PSOR (SRAMModelSetRegister{SRAM_PORT_B})
+#define GPIOC_PSOR (SRAMModelSetRegister{SRAM_PORT_C})
+#define GPIOD_PSOR (SRAMModelSetRegister{SRAM_PORT_D})
+#define GPIOE_PSOR (SRAMModelSetRegister{SRAM_PORT_E})
+#define GPIOA_PCOR (SRAMModelClearRegister{SRAM_PORT_A})
+#define GPIOB_PCOR (SRAMModelClearRegister{SRAM_PORT_B})
+#define GPIOC_PCOR (SRAMModelClearRegister{SRAM_PORT_C})
+#define GPIOD_PCOR (SRAMModelClearRegister{SRAM_PORT_D})
+#define GPIOE_PCOR (SRAMModelClearRegister{SRAM_PORT_E})
+#define GPIOA_PDIR (SRAMModelInputRegister{SRAM_PORT_A})
+#define GPIOC_PDIR (SRAMModelInputRegister{SRAM_PORT_C})
+#define GPIOD_PDIR (SRAMModelInputRegister{SRAM_PORT_D})
+#define portModeRegister(pin) (&SRAMModelModes[pin])
+
+#endif
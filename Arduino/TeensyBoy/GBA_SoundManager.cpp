@@ -38,8 +38,6 @@ Processor *parents;
 #define FIFO_B_L 0xA4
 #define FIFO_B_H 0xA6
 
-#define ioRegStart  0x00048000 //0x48000 - 0x484FF = 0x4FF
-
 AudioOutputAnalog dac; //on-chip DAC
 AudioPlayMemory   audioplayer;
 AudioConnection   c1(audioplayer, 0, dac, 0);
@@ -24,6 +24,7 @@
 
 #include "GBA_ThumbCore.h"
 #include "GBA_Arm7.h"
+#include "GBA_BiosHle.h"
 
 //CPU Mode Definitions
 const uint32_t USR = 0x10;
@@ -46,6 +47,103 @@ ThumbCore::ThumbCore(class Processor *par)
   parentt = par;
 }
 
+//Pick the handler for the top 10 bits of an instruction, any operand field
+//inside those bits becomes a template argument so it folds into the handler
+template <uint32_t op>
+constexpr ThumbHandler ThumbEntry()
+{
+  if (op < 0x020) return &ThumbCore::OpLslImm<op & 0x1F>;
+  if (op < 0x040) return &ThumbCore::OpLsrImm<op & 0x1F>;
+  if (op < 0x060) return &ThumbCore::OpAsrImm<op & 0x1F>;
+  if (op < 0x068) return &ThumbCore::OpAddRegReg<op & 0x7>;
+  if (op < 0x070) return &ThumbCore::OpSubRegReg<op & 0x7>;
+  if (op < 0x078) return &ThumbCore::OpAddRegImm<op & 0x7>;
+  if (op < 0x080) return &ThumbCore::OpSubRegImm<op & 0x7>;
+  if (op < 0x0A0) return &ThumbCore::OpMovImm<(op >> 2) & 0x7>;
+  if (op < 0x0C0) return &ThumbCore::OpCmpImm<(op >> 2) & 0x7>;
+  if (op < 0x0E0) return &ThumbCore::OpAddImm<(op >> 2) & 0x7>;
+  if (op < 0x100) return &ThumbCore::OpSubImm<(op >> 2) & 0x7>;
+  if (op < 0x110) return &ThumbCore::OpArith<op & 0xF>;
+  if (op < 0x114) return &ThumbCore::OpAddHi<op & 0x3>;
+  if (op < 0x118) return &ThumbCore::OpCmpHi<op & 0x3>;
+  if (op < 0x11C) return &ThumbCore::OpMovHi<op & 0x3>;
+  if (op < 0x120) return &ThumbCore::OpBx<op & 0x3>;
+  if (op < 0x140) return &ThumbCore::OpLdrPc<(op >> 2) & 0x7>;
+  if (op < 0x148) return &ThumbCore::OpStrReg<op & 0x7>;
+  if (op < 0x150) return &ThumbCore::OpStrhReg<op & 0x7>;
+  if (op < 0x158) return &ThumbCore::OpStrbReg<op & 0x7>;
+  if (op < 0x160) return &ThumbCore::OpLdrsbReg<op & 0x7>;
+  if (op < 0x168) return &ThumbCore::OpLdrReg<op & 0x7>;
+  if (op < 0x170) return &ThumbCore::OpLdrhReg<op & 0x7>;
+  if (op < 0x178) return &ThumbCore::OpLdrbReg<op & 0x7>;
+  if (op < 0x180) return &ThumbCore::OpLdrshReg<op & 0x7>;
+  if (op < 0x1A0) return &ThumbCore::OpStrImm<op & 0x1F>;
+  if (op < 0x1C0) return &ThumbCore::OpLdrImm<op & 0x1F>;
+  if (op < 0x1E0) return &ThumbCore::OpStrbImm<op & 0x1F>;
+  if (op < 0x200) return &ThumbCore::OpLdrbImm<op & 0x1F>;
+  if (op < 0x220) return &ThumbCore::OpStrhImm<op & 0x1F>;
+  if (op < 0x240) return &ThumbCore::OpLdrhImm<op & 0x1F>;
+  if (op < 0x260) return &ThumbCore::OpStrSp<(op >> 2) & 0x7>;
+  if (op < 0x280) return &ThumbCore::OpLdrSp<(op >> 2) & 0x7>;
+  if (op < 0x2A0) return &ThumbCore::OpAddPc<(op >> 2) & 0x7>;
+  if (op < 0x2C0) return &ThumbCore::OpAddSp<(op >> 2) & 0x7>;
+  if (op < 0x2C4) return &ThumbCore::OpSubSp<(op >> 1) & 0x1>;
+  if (op < 0x2D0) return &ThumbCore::OpUnd;
+  if (op < 0x2D4) return &ThumbCore::OpPush;
+  if (op < 0x2D8) return &ThumbCore::OpPushLr;
+  if (op < 0x2F0) return &ThumbCore::OpUnd;
+  if (op < 0x2F4) return &ThumbCore::OpPop;
+  if (op < 0x2F8) return &ThumbCore::OpPopPc;
+  if (op < 0x300) return &ThumbCore::OpUnd;
+  if (op < 0x320) return &ThumbCore::OpStmia<(op >> 2) & 0x7>;
+  if (op < 0x340) return &ThumbCore::OpLdmia<(op >> 2) & 0x7>;
+  if (op < 0x378) return &ThumbCore::OpBCond<(op >> 2) & 0xF>;
+  if (op < 0x37C) return &ThumbCore::OpUnd;
+  if (op < 0x380) return &ThumbCore::OpSwi;
+  if (op < 0x3A0) return &ThumbCore::OpB;
+  if (op < 0x3C0) return &ThumbCore::OpUnd;
+  if (op < 0x3E0) return &ThumbCore::OpBl1;
+  return &ThumbCore::OpBl2;
+}
+
+#define THUMB_ENTRY_4(n) ThumbEntry<(n)>(), ThumbEntry<(n) + 1>(), ThumbEntry<(n) + 2>(), ThumbEntry<(n) + 3>()
+#define THUMB_ENTRY_16(n) THUMB_ENTRY_4(n), THUMB_ENTRY_4((n) + 4), THUMB_ENTRY_4((n) + 8), THUMB_ENTRY_4((n) + 12)
+#define THUMB_ENTRY_64(n) THUMB_ENTRY_16(n), THUMB_ENTRY_16((n) + 16), THUMB_ENTRY_16((n) + 32), THUMB_ENTRY_16((n) + 48)
+#define THUMB_ENTRY_256(n) THUMB_ENTRY_64(n), THUMB_ENTRY_64((n) + 64), THUMB_ENTRY_64((n) + 128), THUMB_ENTRY_64((n) + 192)
+
+constexpr ThumbHandler ThumbHandlers[THUMB_HANDLERS] =
+{
+  THUMB_ENTRY_256(0x000),
+  THUMB_ENTRY_256(0x100),
+  THUMB_ENTRY_256(0x200),
+  THUMB_ENTRY_256(0x300)
+};
+
+#ifndef THUMB_TABLE_DISPATCH
+#define THUMB_CASE_4(n) case (n): (this->*ThumbEntry<(n)>())(); break; case (n) + 1: (this->*ThumbEntry<(n) + 1>())(); break; \
+                        case (n) + 2: (this->*ThumbEntry<(n) + 2>())(); break; case (n) + 3: (this->*ThumbEntry<(n) + 3>())(); break;
+#define THUMB_CASE_16(n) THUMB_CASE_4(n) THUMB_CASE_4((n) + 4) THUMB_CASE_4((n) + 8) THUMB_CASE_4((n) + 12)
+#define THUMB_CASE_64(n) THUMB_CASE_16(n) THUMB_CASE_16((n) + 16) THUMB_CASE_16((n) + 32) THUMB_CASE_16((n) + 48)
+#define THUMB_CASE_256(n) THUMB_CASE_64(n) THUMB_CASE_64((n) + 64) THUMB_CASE_64((n) + 128) THUMB_CASE_64((n) + 192)
+#endif
+
+// Run the handler for the top 10 bits of curInstruction. The switch has a direct call per case,
+// which the compiler can inline, THUMB_TABLE_DISPATCH makes an indirect call through the table
+inline void ThumbCore::Dispatch(uint32_t handler)
+{
+#ifndef THUMB_TABLE_DISPATCH
+  switch (handler)
+  {
+    THUMB_CASE_256(0x000)
+    THUMB_CASE_256(0x100)
+    THUMB_CASE_256(0x200)
+    THUMB_CASE_256(0x300)
+  }
+#else
+  (this->*ThumbHandlers[handler])();
+#endif
+}
+
 void ThumbCore::BeginExecution()
 {
   FlushQueue();
@@ -53,18 +151,71 @@ void ThumbCore::BeginExecution()
 
 void ThumbCore::Execute()
 {
+#ifdef THREADED_DISPATCH
+  ExecuteThreaded();
+  return;
+#endif
+
   UnpackFlags();
 
+  Block *block = NULL; //Block being recorded
+
   while (parentt->Cycles > 0)
   {
+    uint32_t address = parentt->registers[15] - 2;
+
+    // With the cache off this is the plain interpreter, nothing is looked up or recorded
+    if (block == NULL && blockCache.enabled)
+    {
+      Block *cached = blockCache.Find(address, BLOCK_THUMB);
+
+      if (cached != NULL && cached->ops[0].instruction == instructionQueue)
+      {
+        ExecuteBlock(cached);
+
+        if ((parentt->cpsr & parentt->T_MASK) != parentt->T_MASK)
+        {
+          if ((curInstruction >> 8) != 0xDF) 
+          {
+            parentt->ReloadQueue();
+          }
+          break;
+        }
+        continue;
+      }
+
+      block = blockCache.Begin(address, BLOCK_THUMB);
+      parentt->TrackCodeWrites();
+    }
+
     curInstruction = instructionQueue;
     instructionQueue = parentt->ReadU16(parentt->registers[15]);
     parentt->registers[15] += 2;
 
+    uint16_t handler = curInstruction >> 6;
+    uint32_t invalidations = blockCache.invalidations;
+
+    if (block != NULL)
+    {
+      block->ops[block->count].instruction = curInstruction;
+      block->ops[block->count].handler = handler;
+      block->ops[block->count].fuse = FUSE_NONE;
+#ifdef THUMB_FUSION
+      if (block->count > 0)
+      {
+        block->ops[block->count - 1].fuse = FusePair((uint16_t)block->ops[block->count - 1].instruction, curInstruction);
+      }
+#endif
+      block->count++;
+    }
+
     // Execute the instruction
-    NormalOps(curInstruction >> 8);
+    Dispatch(handler);
 
     parentt->Cycles -= parentt->GetWaitCycles();
+#ifdef BLOCK_CACHE_STATS
+    blockCache.executed++;
+#endif
 
     if ((parentt->cpsr & parentt->T_MASK) != parentt->T_MASK)
     {
@@ -74,29 +225,321 @@ void ThumbCore::Execute()
       }
       break;
     }
+
+    // Recording stops at a branch, a write to its own code, a full block or the end of the code page
+    if (block != NULL && (parentt->registers[15] != address + 4 || blockCache.invalidations != invalidations || block->count == BLOCK_MAX_OPS || ((address + 2) & (BLOCK_PAGE_SIZE - 1)) == 0))
+    {
+      block = NULL;
+    }
   }
   PackFlags();
 }
 
-void ThumbCore::OverflowCarryAdd(uint32_t a, uint32_t b, uint32_t r)
+// Run a recorded block, the fetches come from the block but still charge their wait states.
+// Carries on into the linked block at its end, returns as soon as the flow leaves a block
+// anywhere else or there's no block to link to.
+void ThumbCore::ExecuteBlock(Block *block)
 {
-  overFlow = ((a & b & ~r) | (~a & ~b & r)) >> 31;
-  carry = ((a & b) | (a & ~r) | (b & ~r)) >> 31;
+  uint32_t invalidations = blockCache.invalidations;
+
+  while (true)
+  {
+    for (uint32_t i = 0; i < block->count; i++)
+    {
+      uint32_t address = parentt->registers[15];
+
+      curInstruction = (uint16_t)block->ops[i].instruction;
+      BlockFetch(block, i + 1);
+
+#ifdef THUMB_FUSION
+      if (block->ops[i].fuse != FUSE_NONE)
+      {
+        // The checks below are for whichever half ran last
+        if (ExecuteFused(block, i))
+        {
+          i++;
+          address += 2;
+        }
+      }
+      else
+#endif
+      {
+        Dispatch(block->ops[i].handler);
+
+        parentt->Cycles -= parentt->GetWaitCycles();
+      }
+#ifdef BLOCK_CACHE_STATS
+      blockCache.executed++;
+#endif
+
+      if ((parentt->cpsr & parentt->T_MASK) != parentt->T_MASK || blockCache.invalidations != invalidations || parentt->Cycles <= 0 || (parentt->registers[15] != address + 2 && i + 1 < block->count))
+      {
+        return;
+      }
+    }
+
+#ifdef BLOCK_LINKING
+    block = blockCache.Link(block, parentt->registers[15] - 2, BLOCK_THUMB);
+
+    if (block == NULL || block->ops[0].instruction != instructionQueue)
+    {
+      return;
+    }
+#else
+    return;
+#endif
+  }
+}
+
+// Queue op next of the block, or read it once the block runs out, and charge the fetch
+inline void ThumbCore::BlockFetch(Block *block, uint32_t next)
+{
+  uint32_t address = parentt->registers[15];
+
+  if (next < block->count)
+  {
+    instructionQueue = (uint16_t)block->ops[next].instruction;
+    parentt->AddWaitCycles(address, WAIT_16, 2);
+    parentt->CountAccess(address, ACCESS_16, ACCESS_READ);
+  }
+  else
+  {
+    instructionQueue = parentt->ReadU16(address);
+  }
+  parentt->registers[15] += 2;
 }
 
-void ThumbCore::OverflowCarrySub(uint32_t a, uint32_t b, uint32_t r)
+// Which FUSE_* pair first and second make
+uint8_t ThumbCore::FusePair(uint16_t first, uint16_t second)
 {
-  overFlow = ((a & ~b & ~r) | (~a & b & r)) >> 31;
-  carry = ((a & ~b) | (a & ~r) | (~b & ~r)) >> 31;
+  if ((first & 0xF800) == 0xF000 && (second & 0xF800) == 0xF800)
+  {
+    return FUSE_BL;
+  }
+
+  if (((first & 0xF800) == 0x2800 || (first & 0xFFC0) == 0x4280) && (second & 0xF000) == 0xD000 && (second & 0x0E00) != 0x0E00)
+  {
+    return FUSE_CMP_BCC;
+  }
+
+  if ((first & 0xF800) == 0x4800 && (second & 0xFFC7) == 0x4700 && ((second >> 3) & 0x7) == ((first >> 8) & 0x7))
+  {
+    return FUSE_LDR_BX;
+  }
+
+  if ((first & 0xF800) == 0x2000 && (second & 0xF800) == 0x0000 && ((second >> 3) & 0x7) == ((first >> 8) & 0x7))
+  {
+    return FUSE_MOV_LSL;
+  }
+
+  return FUSE_NONE;
 }
 
+// Run the pair starting at op i as one op, with the same results, fetches and cycles as running
+// them one at a time. The first halves never branch or write memory, so the cycle count is the
+// only thing to check between them. False when the slice ran out after the first half.
+bool ThumbCore::ExecuteFused(Block *block, uint32_t i)
+{
+  uint8_t fuse = block->ops[i].fuse;
+  uint16_t first = curInstruction;
+  uint32_t *registers = parentt->registers;
+
+  switch (fuse)
+  {
+    case FUSE_BL:
+    {
+      uint32_t offSet = (uint32_t)(first & 0x7FF);
+      if ((offSet & (1 << 10)) != 0)
+      {
+        offSet |= 0xFFFFF800;
+      }
+      registers[14] = registers[15] + (offSet << 12);
+      break;
+    }
+    case FUSE_CMP_BCC:
+    {
+      uint32_t a, b;
+      if ((first & 0xF800) == 0x2800)
+      {
+        a = registers[(first >> 8) & 0x7];
+        b = (uint32_t)(first & 0xFF);
+      }
+      else
+      {
+        a = registers[first & 0x7];
+        b = registers[(first >> 3) & 0x7];
+      }
+      flags.SetSub(a, b, a - b);
+      break;
+    }
+    case FUSE_LDR_BX:
+      registers[(first >> 8) & 0x7] = parentt->ReadU32((registers[15] & ~2U) + (uint32_t)((first & 0xFF) * 4));
+      parentt->Cycles--;
+      break;
+    case FUSE_MOV_LSL:
+      registers[(first >> 8) & 0x7] = (uint32_t)(first & 0xFF);
+      flags.SetNZ(registers[(first >> 8) & 0x7]);
+      break;
+  }
+
+  parentt->Cycles -= parentt->GetWaitCycles();
+
+  if (parentt->Cycles <= 0)
+  {
+    return false;
+  }
+
+#ifdef BLOCK_CACHE_STATS
+  blockCache.executed++;
+#endif
+  blockCache.fused++;
+
+  curInstruction = (uint16_t)block->ops[i + 1].instruction;
+  BlockFetch(block, i + 2);
+  uint16_t second = curInstruction;
+
+  switch (fuse)
+  {
+    case FUSE_BL:
+    {
+      uint32_t tmp = registers[15];
+      registers[15] = registers[14] + (uint32_t)((second & 0x7FF) << 1);
+      registers[14] = (tmp - 2U) | 1;
+      FlushQueue();
+      break;
+    }
+    case FUSE_CMP_BCC:
+      if (flags.Passes((second >> 8) & 0xF))
+      {
+        uint32_t offSet = (uint32_t)(second & 0xFF);
+        if ((offSet & (1 << 7)) != 0)
+        {
+          offSet |= 0xFFFFFF00;
+        }
+
+        registers[15] += offSet << 1;
+
+        if ((int32_t)(offSet << 1) < 0 && (int32_t)(offSet << 1) >= -IDLE_LOOP_BYTES)
+        {
+          parentt->IdleBranch(flags.Pack(parentt->cpsr));
+        }
+
+        FlushQueue();
+      }
+      break;
+    case FUSE_LDR_BX:
+    {
+      // Flags are untouched, so there's no need to pack and unpack them like OpBx
+      uint32_t target = registers[(second >> 3) & 0x7];
+      parentt->cpsr = (parentt->cpsr & ~parentt->T_MASK) | ((target & 1) << parentt->T_BIT);
+      registers[15] = target & ~1U;
+
+      if ((parentt->cpsr & parentt->T_MASK) == parentt->T_MASK)
+      {
+        FlushQueue();
+      }
+      break;
+    }
+    case FUSE_MOV_LSL:
+    {
+      uint32_t immed = (second >> 6) & 0x1F;
+      uint32_t value = registers[(second >> 3) & 0x7];
+
+      if (immed != 0)
+      {
+        flags.SetCarry((value >> (32 - immed)) & 0x1);
+        value <<= immed;
+      }
+      registers[second & 0x7] = value;
+      flags.SetNZ(value);
+      break;
+    }
+  }
+
+  parentt->Cycles -= parentt->GetWaitCycles();
+  return true;
+}
+
+#ifdef THREADED_DISPATCH
+//One label per handler table entry, named by its index in hex
+#define THUMB_OP(n) op_##n: (this->*ThumbHandlers[0x##n])(); if (!ThreadedStep()) goto done; goto *labels[curInstruction >> 6];
+#define THUMB_OPS_16(n) THUMB_OP(n##0) THUMB_OP(n##1) THUMB_OP(n##2) THUMB_OP(n##3) THUMB_OP(n##4) THUMB_OP(n##5) THUMB_OP(n##6) THUMB_OP(n##7) \
+                        THUMB_OP(n##8) THUMB_OP(n##9) THUMB_OP(n##A) THUMB_OP(n##B) THUMB_OP(n##C) THUMB_OP(n##D) THUMB_OP(n##E) THUMB_OP(n##F)
+#define THUMB_OPS_256(n) THUMB_OPS_16(n##0) THUMB_OPS_16(n##1) THUMB_OPS_16(n##2) THUMB_OPS_16(n##3) THUMB_OPS_16(n##4) THUMB_OPS_16(n##5) THUMB_OPS_16(n##6) THUMB_OPS_16(n##7) \
+                         THUMB_OPS_16(n##8) THUMB_OPS_16(n##9) THUMB_OPS_16(n##A) THUMB_OPS_16(n##B) THUMB_OPS_16(n##C) THUMB_OPS_16(n##D) THUMB_OPS_16(n##E) THUMB_OPS_16(n##F)
+
+#define THUMB_LABEL(n) &&op_##n,
+#define THUMB_LABELS_16(n) THUMB_LABEL(n##0) THUMB_LABEL(n##1) THUMB_LABEL(n##2) THUMB_LABEL(n##3) THUMB_LABEL(n##4) THUMB_LABEL(n##5) THUMB_LABEL(n##6) THUMB_LABEL(n##7) \
+                           THUMB_LABEL(n##8) THUMB_LABEL(n##9) THUMB_LABEL(n##A) THUMB_LABEL(n##B) THUMB_LABEL(n##C) THUMB_LABEL(n##D) THUMB_LABEL(n##E) THUMB_LABEL(n##F)
+#define THUMB_LABELS_256(n) THUMB_LABELS_16(n##0) THUMB_LABELS_16(n##1) THUMB_LABELS_16(n##2) THUMB_LABELS_16(n##3) THUMB_LABELS_16(n##4) THUMB_LABELS_16(n##5) THUMB_LABELS_16(n##6) THUMB_LABELS_16(n##7) \
+                            THUMB_LABELS_16(n##8) THUMB_LABELS_16(n##9) THUMB_LABELS_16(n##A) THUMB_LABELS_16(n##B) THUMB_LABELS_16(n##C) THUMB_LABELS_16(n##D) THUMB_LABELS_16(n##E) THUMB_LABELS_16(n##F)
+
+// Direct threaded interpreter. Every handler site charges the wait states, fetches the next
+// instruction and jumps straight to its handler, so each site has its own indirect jump for
+// the branch predictor instead of all of them sharing the one in Execute.
+// Runs straight from memory, the block cache isn't used.
+void ThumbCore::ExecuteThreaded()
+{
+  static void *const labels[THUMB_HANDLERS] =
+  {
+    THUMB_LABELS_256(0)
+    THUMB_LABELS_256(1)
+    THUMB_LABELS_256(2)
+    THUMB_LABELS_256(3)
+  };
+
+  UnpackFlags();
+
+  if (parentt->Cycles > 0)
+  {
+    curInstruction = instructionQueue;
+    instructionQueue = parentt->ReadU16(parentt->registers[15]);
+    parentt->registers[15] += 2;
+    goto *labels[curInstruction >> 6];
+  }
+  goto done;
+
+  THUMB_OPS_256(0)
+  THUMB_OPS_256(1)
+  THUMB_OPS_256(2)
+  THUMB_OPS_256(3)
+
+done:
+  if ((parentt->cpsr & parentt->T_MASK) != parentt->T_MASK && (curInstruction >> 8) != 0xDF)
+  {
+    parentt->ReloadQueue();
+  }
+  PackFlags();
+}
+
+// Charge the wait states of the instruction just run and fetch the next one,
+// false ends the slice when the cycles run out or the core leaves Thumb state
+bool ThumbCore::ThreadedStep()
+{
+  parentt->Cycles -= parentt->GetWaitCycles();
+#ifdef BLOCK_CACHE_STATS
+  blockCache.executed++;
+#endif
+
+  if (parentt->Cycles <= 0 || (parentt->cpsr & parentt->T_MASK) != parentt->T_MASK)
+  {
+    return false;
+  }
+
+  curInstruction = instructionQueue;
+  instructionQueue = parentt->ReadU16(parentt->registers[15]);
+  parentt->registers[15] += 2;
+  return true;
+}
+#endif
+
+template <uint32_t immed>
 void ThumbCore::OpLslImm()
 {
   // 0x00 - 0x07
   // lsl rd, rm, #immed
   int32_t rd = curInstruction & 0x7;
   int32_t rm = (curInstruction >> 3) & 0x7;
-  int32_t immed = (curInstruction >> 6) & 0x1F;
 
   if (immed == 0)
   {
@@ -104,48 +547,46 @@ void ThumbCore::OpLslImm()
   } 
   else
   {
-    carry = (parentt->registers[rm] >> (32 - immed)) & 0x1;
+    flags.SetCarry((parentt->registers[rm] >> (32 - immed)) & 0x1);
     parentt->registers[rd] = parentt->registers[rm] << immed;
   }
 
-    negative = parentt->registers[rd] >> 31;
-    zero = parentt->registers[rd] == 0 ? 1U : 0U;
+    flags.SetNZ(parentt->registers[rd]);
 }
 
+template <uint32_t immed>
 void ThumbCore::OpLsrImm()
 {
   // 0x08 - 0x0F
   // lsr rd, rm, #immed
   int32_t rd = curInstruction & 0x7;
   int32_t rm = (curInstruction >> 3) & 0x7;
-  int32_t immed = (curInstruction >> 6) & 0x1F;
 
   if (immed == 0)
   {
-    carry = parentt->registers[rm] >> 31;
+    flags.SetCarry(parentt->registers[rm] >> 31);
     parentt->registers[rd] = 0;
   }
   else
   {
-    carry = (parentt->registers[rm] >> (immed - 1)) & 0x1;
+    flags.SetCarry((parentt->registers[rm] >> (immed - 1)) & 0x1);
     parentt->registers[rd] = parentt->registers[rm] >> immed;
   }
 
-  negative = parentt->registers[rd] >> 31;
-  zero = parentt->registers[rd] == 0 ? 1U : 0U;
+  flags.SetNZ(parentt->registers[rd]);
 }
 
+template <uint32_t immed>
 void ThumbCore::OpAsrImm()
 {
   // asr rd, rm, #immed
   int32_t rd = curInstruction & 0x7;
   int32_t rm = (curInstruction >> 3) & 0x7;
-  int32_t immed = (curInstruction >> 6) & 0x1F;
   
   if (immed == 0)
   {
-    carry = parentt->registers[rm] >> 31;
-    if (carry == 1)
+    flags.SetCarry(parentt->registers[rm] >> 31);
+    if (flags.carry == 1)
     {
       parentt->registers[rd] = 0xFFFFFFFF;
     }
@@ -156,131 +597,112 @@ void ThumbCore::OpAsrImm()
   }
   else
   {
-    carry = (parentt->registers[rm] >> (immed - 1)) & 0x1;
+    flags.SetCarry((parentt->registers[rm] >> (immed - 1)) & 0x1);
     parentt->registers[rd] = (uint32_t)(((int32_t)parentt->registers[rm]) >> immed);
   }
   
-  negative = parentt->registers[rd] >> 31;
-  zero = parentt->registers[rd] == 0 ? 1U : 0U;
+  flags.SetNZ(parentt->registers[rd]);
 }
 
+template <uint32_t rm>
 void ThumbCore::OpAddRegReg()
 {
   // add rd, rn, rm
   int32_t rd = curInstruction & 0x7;
   int32_t rn = (curInstruction >> 3) & 0x7;
-  int32_t rm = (curInstruction >> 6) & 0x7;
   
   uint32_t orn = parentt->registers[rn];
   uint32_t orm = parentt->registers[rm];
   
   parentt->registers[rd] = orn + orm;
   
-  OverflowCarryAdd(orn, orm, parentt->registers[rd]);
-  negative = parentt->registers[rd] >> 31;
-  zero = parentt->registers[rd] == 0 ? 1U : 0U;
+  flags.SetAdd(orn, orm, parentt->registers[rd]);
 }
 
+template <uint32_t rm>
 void ThumbCore::OpSubRegReg()
 {
   // sub rd, rn, rm
   int32_t rd = curInstruction & 0x7;
   int32_t rn = (curInstruction >> 3) & 0x7;
-  int32_t rm = (curInstruction >> 6) & 0x7;
   
   uint32_t orn = parentt->registers[rn];
   uint32_t orm = parentt->registers[rm];
   
   parentt->registers[rd] = orn - orm;
   
-  OverflowCarrySub(orn, orm, parentt->registers[rd]);
-  negative = parentt->registers[rd] >> 31;
-  zero = parentt->registers[rd] == 0 ? 1U : 0U;
+  flags.SetSub(orn, orm, parentt->registers[rd]);
 }
 
+template <uint32_t immed>
 void ThumbCore::OpAddRegImm()
 {
   // add rd, rn, #immed
   int32_t rd = curInstruction & 0x7;
   int32_t rn = (curInstruction >> 3) & 0x7;
-  uint32_t immed = (uint32_t)((curInstruction >> 6) & 0x7);
   
   uint32_t orn = parentt->registers[rn];
   
   parentt->registers[rd] = orn + immed;
   
-  OverflowCarryAdd(orn, immed, parentt->registers[rd]);
-  negative = parentt->registers[rd] >> 31;
-  zero = parentt->registers[rd] == 0 ? 1U : 0U;
+  flags.SetAdd(orn, immed, parentt->registers[rd]);
 }
 
+template <uint32_t immed>
 void ThumbCore::OpSubRegImm()
 {
   // sub rd, rn, #immed
   int32_t rd = curInstruction & 0x7;
   int32_t rn = (curInstruction >> 3) & 0x7;
-  uint32_t immed = (uint32_t)((curInstruction >> 6) & 0x7);
   
   uint32_t orn = parentt->registers[rn];
   
   parentt->registers[rd] = orn - immed;
   
-  OverflowCarrySub(orn, immed, parentt->registers[rd]);
-  negative = parentt->registers[rd] >> 31;
-  zero = parentt->registers[rd] == 0 ? 1U : 0U;
+  flags.SetSub(orn, immed, parentt->registers[rd]);
 }
 
+template <uint32_t rd>
 void ThumbCore::OpMovImm()
 {
   // mov rd, #immed
-  int32_t rd = (curInstruction >> 8) & 0x7;
-  
   parentt->registers[rd] = (uint32_t)(curInstruction & 0xFF);
   
-  negative = 0;
-  zero = parentt->registers[rd] == 0 ? 1U : 0U;
+  flags.SetNZ(parentt->registers[rd]);
 }
 
+template <uint32_t rn>
 void ThumbCore::OpCmpImm()
 {
   // cmp rn, #immed
-  int32_t rn = (curInstruction >> 8) & 0x7;
-  
   uint32_t alu = parentt->registers[rn] - (uint32_t)(curInstruction & 0xFF);
   
-  OverflowCarrySub(parentt->registers[rn], (uint32_t)(curInstruction & 0xFF), alu);
-  negative = alu >> 31;
-  zero = alu == 0 ? 1U : 0U;
+  flags.SetSub(parentt->registers[rn], (uint32_t)(curInstruction & 0xFF), alu);
 }
 
+template <uint32_t rd>
 void ThumbCore::OpAddImm()
 {
   // add rd, #immed
-  int32_t rd = (curInstruction >> 8) & 0x7;
-  
   uint32_t ord = parentt->registers[rd];
   
   parentt->registers[rd] += (uint32_t)(curInstruction & 0xFF);
   
-  OverflowCarryAdd(ord, (uint32_t)(curInstruction & 0xFF), parentt->registers[rd]);
-  negative = parentt->registers[rd] >> 31;
-  zero = parentt->registers[rd] == 0 ? 1U : 0U;
+  flags.SetAdd(ord, (uint32_t)(curInstruction & 0xFF), parentt->registers[rd]);
 }
 
+template <uint32_t rd>
 void ThumbCore::OpSubImm()
 {
   // sub rd, #immed
-  int32_t rd = (curInstruction >> 8) & 0x7;
-  
   uint32_t ord = parentt->registers[rd];
   
   parentt->registers[rd] -= (uint32_t)(curInstruction & 0xFF);
   
-  OverflowCarrySub(ord, (uint32_t)(curInstruction & 0xFF), parentt->registers[rd]);
-  negative = parentt->registers[rd] >> 31;
-  zero = parentt->registers[rd] == 0 ? 1U : 0U;
+  flags.SetSub(ord, (uint32_t)(curInstruction & 0xFF), parentt->registers[rd]);
 }
 
+template <uint32_t op>
 void ThumbCore::OpArith()
 {
   int32_t rd = curInstruction & 0x7;
@@ -290,16 +712,14 @@ void ThumbCore::OpArith()
   uint32_t alu;
   int32_t shiftAmt;
 
-  switch ((curInstruction >> 6) & 0xF)
+  switch (op)
   {
     case OP_ADC:
       {
         orig = parentt->registers[rd];
-        parentt->registers[rd] += rn + carry;
+        parentt->registers[rd] += rn + flags.Carry();
   
-        negative = parentt->registers[rd] >> 31;
-        zero = parentt->registers[rd] == 0 ? 1U : 0U;
-        OverflowCarryAdd(orig, rn, parentt->registers[rd]);
+        flags.SetAdd(orig, rn, parentt->registers[rd]);
       }
       break;
 
@@ -307,8 +727,7 @@ void ThumbCore::OpArith()
       {
         parentt->registers[rd] &= rn;
   
-        negative = parentt->registers[rd] >> 31;
-        zero = parentt->registers[rd] == 0 ? 1U : 0U;
+        flags.SetNZ(parentt->registers[rd]);
       }
       break;
 
@@ -321,13 +740,13 @@ void ThumbCore::OpArith()
         }
         else if (shiftAmt < 32)
         {
-          carry = (parentt->registers[rd] >> (shiftAmt - 1)) & 0x1;
+          flags.SetCarry((parentt->registers[rd] >> (shiftAmt - 1)) & 0x1);
           parentt->registers[rd] = (uint32_t)(((int32_t)parentt->registers[rd]) >> shiftAmt);
         }
         else
         {
-          carry = (parentt->registers[rd] >> 31) & 1;
-          if (carry == 1)
+          flags.SetCarry((parentt->registers[rd] >> 31) & 1);
+          if (flags.carry == 1)
           {
             parentt->registers[rd] = 0xFFFFFFFF;
           }
@@ -337,8 +756,7 @@ void ThumbCore::OpArith()
           }
         }
   
-        negative = parentt->registers[rd] >> 31;
-        zero = parentt->registers[rd] == 0 ? 1U : 0U;
+        flags.SetNZ(parentt->registers[rd]);
       }
       break;
 
@@ -346,8 +764,7 @@ void ThumbCore::OpArith()
       {
         parentt->registers[rd] &= ~rn;
   
-        negative = parentt->registers[rd] >> 31;
-        zero = parentt->registers[rd] == 0 ? 1U : 0U;
+        flags.SetNZ(parentt->registers[rd]);
       }
       break;
 
@@ -355,9 +772,7 @@ void ThumbCore::OpArith()
       {
         alu = parentt->registers[rd] + rn;
   
-        negative = alu >> 31;
-        zero = alu == 0 ? 1U : 0U;
-        OverflowCarryAdd(parentt->registers[rd], rn, alu);
+        flags.SetAdd(parentt->registers[rd], rn, alu);
       }
       break;
 
@@ -365,9 +780,7 @@ void ThumbCore::OpArith()
       {
         alu = parentt->registers[rd] - rn;
   
-        negative = alu >> 31;
-        zero = alu == 0 ? 1U : 0U;
-        OverflowCarrySub(parentt->registers[rd], rn, alu);
+        flags.SetSub(parentt->registers[rd], rn, alu);
       }
       break;
 
@@ -375,8 +788,7 @@ void ThumbCore::OpArith()
       {
         parentt->registers[rd] ^= rn;
   
-        negative = parentt->registers[rd] >> 31;
-        zero = parentt->registers[rd] == 0 ? 1U : 0U;
+        flags.SetNZ(parentt->registers[rd]);
       }
       break;
 
@@ -389,22 +801,21 @@ void ThumbCore::OpArith()
         }
         else if (shiftAmt < 32)
         {
-          carry = (parentt->registers[rd] >> (32 - shiftAmt)) & 0x1;
+          flags.SetCarry((parentt->registers[rd] >> (32 - shiftAmt)) & 0x1);
           parentt->registers[rd] <<= shiftAmt;
         }
         else if (shiftAmt == 32)
         {
-          carry = parentt->registers[rd] & 0x1;
+          flags.SetCarry(parentt->registers[rd] & 0x1);
           parentt->registers[rd] = 0;
         }
         else
         {
-          carry = 0;
+          flags.SetCarry(0);
           parentt->registers[rd] = 0;
         }
   
-        negative = parentt->registers[rd] >> 31;
-        zero = parentt->registers[rd] == 0 ? 1U : 0U;
+        flags.SetNZ(parentt->registers[rd]);
       }
       break;
 
@@ -417,22 +828,21 @@ void ThumbCore::OpArith()
         }
         else if (shiftAmt < 32)
         {
-          carry = (parentt->registers[rd] >> (shiftAmt - 1)) & 0x1;
+          flags.SetCarry((parentt->registers[rd] >> (shiftAmt - 1)) & 0x1);
           parentt->registers[rd] >>= shiftAmt;
         }
         else if (shiftAmt == 32)
         {
-          carry = (parentt->registers[rd] >> 31) & 0x1;
+          flags.SetCarry((parentt->registers[rd] >> 31) & 0x1);
           parentt->registers[rd] = 0;
         }
         else
         {
-          carry = 0;
+          flags.SetCarry(0);
           parentt->registers[rd] = 0;
         }
   
-        negative = parentt->registers[rd] >> 31;
-        zero = parentt->registers[rd] == 0 ? 1U : 0U;
+        flags.SetNZ(parentt->registers[rd]);
       }
       break;
 
@@ -457,8 +867,7 @@ void ThumbCore::OpArith()
   
         parentt->registers[rd] *= rn;
   
-        negative = parentt->registers[rd] >> 31;
-        zero = parentt->registers[rd] == 0 ? 1U : 0U;
+        flags.SetNZ(parentt->registers[rd]);
       }
       break;
 
@@ -466,8 +875,7 @@ void ThumbCore::OpArith()
       {
         parentt->registers[rd] = ~rn;
 
-        negative = parentt->registers[rd] >> 31;
-        zero = parentt->registers[rd] == 0 ? 1U : 0U;
+        flags.SetNZ(parentt->registers[rd]);
       }
       break;
 
@@ -475,9 +883,7 @@ void ThumbCore::OpArith()
       {
         parentt->registers[rd] = 0 - rn;
 
-        OverflowCarrySub(0, rn, parentt->registers[rd]);
-        negative = parentt->registers[rd] >> 31;
-        zero = parentt->registers[rd] == 0 ? 1U : 0U;
+        flags.SetSub(0, rn, parentt->registers[rd]);
       }
       break;
 
@@ -485,8 +891,7 @@ void ThumbCore::OpArith()
       {
         parentt->registers[rd] |= rn;
 
-        negative = parentt->registers[rd] >> 31;
-        zero = parentt->registers[rd] == 0 ? 1U : 0U;
+        flags.SetNZ(parentt->registers[rd]);
       }
       break;
 
@@ -499,28 +904,25 @@ void ThumbCore::OpArith()
         }
         else if ((shiftAmt & 0x1F) == 0)
         {
-          carry = parentt->registers[rd] >> 31;
+          flags.SetCarry(parentt->registers[rd] >> 31);
         }
         else
         {
           shiftAmt &= 0x1F;
-          carry = (parentt->registers[rd] >> (shiftAmt - 1)) & 0x1;
+          flags.SetCarry((parentt->registers[rd] >> (shiftAmt - 1)) & 0x1);
           parentt->registers[rd] = (parentt->registers[rd] >> shiftAmt) | (parentt->registers[rd] << (32 - shiftAmt));
          }
 
-          negative = parentt->registers[rd] >> 31;
-          zero = parentt->registers[rd] == 0 ? 1U : 0U;
+          flags.SetNZ(parentt->registers[rd]);
       }
       break;
 
     case OP_SBC:
       {
         orig = parentt->registers[rd];
-        parentt->registers[rd] = (parentt->registers[rd] - rn) - (1U - carry);
+        parentt->registers[rd] = (parentt->registers[rd] - rn) - (1U - flags.Carry());
 
-        negative = parentt->registers[rd] >> 31;
-        zero = parentt->registers[rd] == 0 ? 1U : 0U;
-        OverflowCarrySub(orig, rn, parentt->registers[rd]);
+        flags.SetSub(orig, rn, parentt->registers[rd]);
       }
       break;
 
@@ -528,17 +930,17 @@ void ThumbCore::OpArith()
       {
         alu = parentt->registers[rd] & rn;
 
-        negative = alu >> 31;
-        zero = alu == 0 ? 1U : 0U;
+        flags.SetNZ(alu);
       }
       break;
     }
 }
 
+template <uint32_t h>
 void ThumbCore::OpAddHi()
 {
-  int32_t rd = ((curInstruction & (1 << 7)) >> 4) | (curInstruction & 0x7);
-  int32_t rm = (curInstruction >> 3) & 0xF;
+  int32_t rd = ((h & 2) << 2) | (curInstruction & 0x7);
+  int32_t rm = ((h & 1) << 3) | ((curInstruction >> 3) & 0x7);
 
   parentt->registers[rd] += parentt->registers[rm];
 
@@ -549,22 +951,22 @@ void ThumbCore::OpAddHi()
   }
 }
 
+template <uint32_t h>
 void ThumbCore::OpCmpHi()
 {
-    int32_t rd = ((curInstruction & (1 << 7)) >> 4) | (curInstruction & 0x7);
-    int32_t rm = (curInstruction >> 3) & 0xF;
+    int32_t rd = ((h & 2) << 2) | (curInstruction & 0x7);
+    int32_t rm = ((h & 1) << 3) | ((curInstruction >> 3) & 0x7);
 
     uint32_t alu = parentt->registers[rd] - parentt->registers[rm];
 
-    negative = alu >> 31;
-    zero = alu == 0 ? 1U : 0U;
-    OverflowCarrySub(parentt->registers[rd], parentt->registers[rm], alu);
+    flags.SetSub(parentt->registers[rd], parentt->registers[rm], alu);
 }
 
+template <uint32_t h>
 void ThumbCore::OpMovHi()
 {
-    int32_t rd = ((curInstruction & (1 << 7)) >> 4) | (curInstruction & 0x7);
-    int32_t rm = (curInstruction >> 3) & 0xF;
+    int32_t rd = ((h & 2) << 2) | (curInstruction & 0x7);
+    int32_t rm = ((h & 1) << 3) | ((curInstruction >> 3) & 0x7);
 
     parentt->registers[rd] = parentt->registers[rm];
 
@@ -575,9 +977,10 @@ void ThumbCore::OpMovHi()
     }
 }
 
+template <uint32_t h>
 void ThumbCore::OpBx()
 {
-    int32_t rm = (curInstruction >> 3) & 0xf;
+    int32_t rm = ((h & 1) << 3) | ((curInstruction >> 3) & 0x7);
 
     PackFlags();
 
@@ -597,33 +1000,36 @@ void ThumbCore::OpBx()
     FlushQueue();
 }
 
+template <uint32_t rd>
 void ThumbCore::OpLdrPc()
 {
-    int32_t rd = (curInstruction >> 8) & 0x7;
-
     parentt->registers[rd] = parentt->ReadU32((parentt->registers[15] & ~2U) + (uint32_t)((curInstruction & 0xFF) * 4));
 
     parentt->Cycles--;
 }
 
+template <uint32_t rm>
 void ThumbCore::OpStrReg()
 {
-    parentt->WriteU32(parentt->registers[(curInstruction >> 3) & 0x7] + parentt->registers[(curInstruction >> 6) & 0x7], parentt->registers[curInstruction & 0x7]);
+    parentt->WriteU32(parentt->registers[(curInstruction >> 3) & 0x7] + parentt->registers[rm], parentt->registers[curInstruction & 0x7]);
 }
 
+template <uint32_t rm>
 void ThumbCore::OpStrhReg()
 {
-    parentt->WriteU16(parentt->registers[(curInstruction >> 3) & 0x7] + parentt->registers[(curInstruction >> 6) & 0x7],(uint16_t)(parentt->registers[curInstruction & 0x7] & 0xFFFF));
+    parentt->WriteU16(parentt->registers[(curInstruction >> 3) & 0x7] + parentt->registers[rm],(uint16_t)(parentt->registers[curInstruction & 0x7] & 0xFFFF));
 }
 
+template <uint32_t rm>
 void ThumbCore::OpStrbReg()
 {
-    parentt->WriteU8(parentt->registers[(curInstruction >> 3) & 0x7] + parentt->registers[(curInstruction >> 6) & 0x7],(uint8_t)(parentt->registers[curInstruction & 0x7] & 0xFF));
+    parentt->WriteU8(parentt->registers[(curInstruction >> 3) & 0x7] + parentt->registers[rm],(uint8_t)(parentt->registers[curInstruction & 0x7] & 0xFF));
 }
 
+template <uint32_t rm>
 void ThumbCore::OpLdrsbReg()
 {
-    parentt->registers[curInstruction & 0x7] = parentt->ReadU8(parentt->registers[(curInstruction >> 3) & 0x7] + parentt->registers[(curInstruction >> 6) & 0x7]);
+    parentt->registers[curInstruction & 0x7] = parentt->ReadU8(parentt->registers[(curInstruction >> 3) & 0x7] + parentt->registers[rm]);
 
     if ((parentt->registers[curInstruction & 0x7] & (1 << 7)) != 0)
     {
@@ -633,30 +1039,34 @@ void ThumbCore::OpLdrsbReg()
     parentt->Cycles--;
 }
 
+template <uint32_t rm>
 void ThumbCore::OpLdrReg()
 {
-    parentt->registers[curInstruction & 0x7] = parentt->ReadU32(parentt->registers[(curInstruction >> 3) & 0x7] + parentt->registers[(curInstruction >> 6) & 0x7]);
+    parentt->registers[curInstruction & 0x7] = parentt->ReadU32(parentt->registers[(curInstruction >> 3) & 0x7] + parentt->registers[rm]);
 
     parentt->Cycles--;
 }
 
+template <uint32_t rm>
 void ThumbCore::OpLdrhReg()
 {
-    parentt->registers[curInstruction & 0x7] = parentt->ReadU16(parentt->registers[(curInstruction >> 3) & 0x7] + parentt->registers[(curInstruction >> 6) & 0x7]);
+    parentt->registers[curInstruction & 0x7] = parentt->ReadU16(parentt->registers[(curInstruction >> 3) & 0x7] + parentt->registers[rm]);
 
     parentt->Cycles--;
 }
 
+template <uint32_t rm>
 void ThumbCore::OpLdrbReg()
 {
-    parentt->registers[curInstruction & 0x7] = parentt->ReadU8(parentt->registers[(curInstruction >> 3) & 0x7] + parentt->registers[(curInstruction >> 6) & 0x7]);
+    parentt->registers[curInstruction & 0x7] = parentt->ReadU8(parentt->registers[(curInstruction >> 3) & 0x7] + parentt->registers[rm]);
 
     parentt->Cycles--;
 }
 
+template <uint32_t rm>
 void ThumbCore::OpLdrshReg()
 {
-    parentt->registers[curInstruction & 0x7] = parentt->ReadU16(parentt->registers[(curInstruction >> 3) & 0x7] + parentt->registers[(curInstruction >> 6) & 0x7]);
+    parentt->registers[curInstruction & 0x7] = parentt->ReadU16(parentt->registers[(curInstruction >> 3) & 0x7] + parentt->registers[rm]);
 
     if ((parentt->registers[curInstruction & 0x7] & (1 << 15)) != 0)
     {
@@ -666,65 +1076,76 @@ void ThumbCore::OpLdrshReg()
     parentt->Cycles--;
 }
 
+template <uint32_t immed>
 void ThumbCore::OpStrImm()
 {
-    parentt->WriteU32(parentt->registers[(curInstruction >> 3) & 0x7] + (uint32_t)(((curInstruction >> 6) & 0x1F) * 4), parentt->registers[curInstruction & 0x7]);
+    parentt->WriteU32(parentt->registers[(curInstruction >> 3) & 0x7] + immed * 4, parentt->registers[curInstruction & 0x7]);
 }
 
+template <uint32_t immed>
 void ThumbCore::OpLdrImm()
 {
-    parentt->registers[curInstruction & 0x7] = parentt->ReadU32(parentt->registers[(curInstruction >> 3) & 0x7] + (uint32_t)(((curInstruction >> 6) & 0x1F) * 4));
+    parentt->registers[curInstruction & 0x7] = parentt->ReadU32(parentt->registers[(curInstruction >> 3) & 0x7] + immed * 4);
 
     parentt->Cycles--;
 }
 
+template <uint32_t immed>
 void ThumbCore::OpStrbImm()
 {
-    parentt->WriteU8(parentt->registers[(curInstruction >> 3) & 0x7] + (uint32_t)((curInstruction >> 6) & 0x1F),(uint8_t)(parentt->registers[curInstruction & 0x7] & 0xFF));
+    parentt->WriteU8(parentt->registers[(curInstruction >> 3) & 0x7] + immed,(uint8_t)(parentt->registers[curInstruction & 0x7] & 0xFF));
 }
 
+template <uint32_t immed>
 void ThumbCore::OpLdrbImm()
 {
-    parentt->registers[curInstruction & 0x7] = parentt->ReadU8(parentt->registers[(curInstruction >> 3) & 0x7] + (uint32_t)((curInstruction >> 6) & 0x1F));
+    parentt->registers[curInstruction & 0x7] = parentt->ReadU8(parentt->registers[(curInstruction >> 3) & 0x7] + immed);
 
     parentt->Cycles--;
 }
 
+template <uint32_t immed>
 void ThumbCore::OpStrhImm()
 {
-    parentt->WriteU16(parentt->registers[(curInstruction >> 3) & 0x7] + (uint32_t)(((curInstruction >> 6) & 0x1F) * 2), (uint16_t)(parentt->registers[curInstruction & 0x7] & 0xFFFF));
+    parentt->WriteU16(parentt->registers[(curInstruction >> 3) & 0x7] + immed * 2, (uint16_t)(parentt->registers[curInstruction & 0x7] & 0xFFFF));
 }
 
+template <uint32_t immed>
 void ThumbCore::OpLdrhImm()
 {
-    parentt->registers[curInstruction & 0x7] = parentt->ReadU16(parentt->registers[(curInstruction >> 3) & 0x7] + (uint32_t)(((curInstruction >> 6) & 0x1F) * 2));
+    parentt->registers[curInstruction & 0x7] = parentt->ReadU16(parentt->registers[(curInstruction >> 3) & 0x7] + immed * 2);
 
     parentt->Cycles--;
 }
 
+template <uint32_t rd>
 void ThumbCore::OpStrSp()
 {
-    parentt->WriteU32(parentt->registers[13] + (uint32_t)((curInstruction & 0xFF) * 4), parentt->registers[(curInstruction >> 8) & 0x7]);
+    parentt->WriteU32(parentt->registers[13] + (uint32_t)((curInstruction & 0xFF) * 4), parentt->registers[rd]);
 }
 
+template <uint32_t rd>
 void ThumbCore::OpLdrSp()
 {
-    parentt->registers[(curInstruction >> 8) & 0x7] = parentt->ReadU32(parentt->registers[13] + (uint32_t)((curInstruction & 0xFF) * 4));
+    parentt->registers[rd] = parentt->ReadU32(parentt->registers[13] + (uint32_t)((curInstruction & 0xFF) * 4));
 }
 
+template <uint32_t rd>
 void ThumbCore::OpAddPc()
 {
-    parentt->registers[(curInstruction >> 8) & 0x7] = (parentt->registers[15] & ~2U) + (uint32_t)((curInstruction & 0xFF) * 4);
+    parentt->registers[rd] = (parentt->registers[15] & ~2U) + (uint32_t)((curInstruction & 0xFF) * 4);
 }
 
+template <uint32_t rd>
 void ThumbCore::OpAddSp()
 {
-    parentt->registers[(curInstruction >> 8) & 0x7] = parentt->registers[13] + (uint32_t)((curInstruction & 0xFF) * 4);
+    parentt->registers[rd] = parentt->registers[13] + (uint32_t)((curInstruction & 0xFF) * 4);
 }
 
+template <uint32_t sub>
 void ThumbCore::OpSubSp()
 {
-    if ((curInstruction & (1 << 7)) != 0)
+    if (sub != 0)
     {
       parentt->registers[13] -= (uint32_t)((curInstruction & 0x7F) * 4);
     }   
@@ -796,10 +1217,9 @@ void ThumbCore::OpPopPc()
     parentt->Cycles--;
 }
 
+template <uint32_t rn>
 void ThumbCore::OpStmia()
 {
-    int32_t rn = (curInstruction >> 8) & 0x7;
-
     for (int i = 0; i < 8; i++)
     {
         if (((curInstruction >> i) & 1) != 0)
@@ -810,10 +1230,9 @@ void ThumbCore::OpStmia()
     }
 }
 
+template <uint32_t rn>
 void ThumbCore::OpLdmia()
 {
-    int32_t rn = (curInstruction >> 8) & 0x7;
-
     uint32_t address = parentt->registers[rn];
 
     for (int i = 0; i < 8; i++)
@@ -831,29 +1250,10 @@ void ThumbCore::OpLdmia()
     }
 }
 
+template <uint32_t condition>
 void ThumbCore::OpBCond()
 {
-    uint32_t cond = 0;
-    switch ((curInstruction >> 8) & 0xF)
-    {
-        case COND_AL: cond = 1; break;
-        case COND_EQ: cond = zero; break;
-        case COND_NE: cond = 1 - zero; break;
-        case COND_CS: cond = carry; break;
-        case COND_CC: cond = 1 - carry; break;
-        case COND_MI: cond = negative; break;
-        case COND_PL: cond = 1 - negative; break;
-        case COND_VS: cond = overFlow; break;
-        case COND_VC: cond = 1 - overFlow; break;
-        case COND_HI: cond = carry & (1 - zero); break;
-        case COND_LS: cond = (1 - carry) | zero; break;
-        case COND_GE: cond = (1 - negative) ^ overFlow; break;
-        case COND_LT: cond = negative ^ overFlow; break;
-        case COND_GT: cond = (1 - zero) & (negative ^ (1 - overFlow)); break;
-        case COND_LE: cond = (negative ^ overFlow) | zero; break;
-    }
-
-    if (cond == 1)
+    if (flags.Passes(condition))
     {
         uint32_t offSet = (uint32_t)(curInstruction & 0xFF);
         
@@ -864,12 +1264,24 @@ void ThumbCore::OpBCond()
 
         parentt->registers[15] += offSet << 1;
 
+        if ((int32_t)(offSet << 1) < 0 && (int32_t)(offSet << 1) >= -IDLE_LOOP_BYTES)
+        {
+          parentt->IdleBranch(flags.Pack(parentt->cpsr));
+        }
+
         FlushQueue();
     }
 }
 
 void ThumbCore::OpSwi()
 {
+#ifdef BIOS_HLE
+    if (biosHle.Call(curInstruction & 0xFF))
+    {
+        return;
+    }
+#endif
+
     parentt->registers[15] -= 4U;
     parentt->EnterException(SVC, 0x8, false, false);
 }
@@ -884,6 +1296,11 @@ void ThumbCore::OpB()
 
     parentt->registers[15] += offSet << 1;
 
+    if ((int32_t)(offSet << 1) < 0 && (int32_t)(offSet << 1) >= -IDLE_LOOP_BYTES)
+    {
+      parentt->IdleBranch(flags.Pack(parentt->cpsr));
+    }
+
     FlushQueue();
 }
 
@@ -914,19 +1331,12 @@ void ThumbCore::OpUnd()
 
 void ThumbCore::PackFlags()
 {
-    parentt->cpsr &= 0x0FFFFFFF;
-    parentt->cpsr |= negative << parentt->N_BIT;
-    parentt->cpsr |= zero << parentt->Z_BIT;
-    parentt->cpsr |= carry << parentt->C_BIT;
-    parentt->cpsr |= overFlow << parentt->V_BIT;
+    parentt->cpsr = flags.Pack(parentt->cpsr);
 }
 
 void ThumbCore::UnpackFlags()
 {
-    negative = (parentt->cpsr >> parentt->N_BIT) & 1;
-    zero = (parentt->cpsr >> parentt->Z_BIT) & 1;
-    carry = (parentt->cpsr >> parentt->C_BIT) & 1;
-    overFlow = (parentt->cpsr >> parentt->V_BIT) & 1;
+    flags.Unpack(parentt->cpsr);
 }
 
 void ThumbCore::FlushQueue()
@@ -934,377 +1344,3 @@ void ThumbCore::FlushQueue()
     instructionQueue = parentt->ReadU16(parentt->registers[15]);
     parentt->registers[15] += 2;
 }
-
-void ThumbCore::NormalOps(uint8_t op)
-{
-  switch (op)
-  {
-    case 0:   //OpLslImm
-    case 1:   //OpLslImm
-    case 2:   //OpLslImm
-    case 3:   //OpLslImm
-    case 4:   //OpLslImm
-    case 5:   //OpLslImm
-    case 6:   //OpLslImm
-    case 7:   //OpLslImm
-      OpLslImm();
-      break;
-    case 8:   //OpLsrImm
-    case 9:   //OpLsrImm
-    case 10:  //OpLsrImm
-    case 11:  //OpLsrImm
-    case 12:  //OpLsrImm
-    case 13:  //OpLsrImm
-    case 14:  //OpLsrImm
-    case 15:  //OpLsrImm
-      OpLsrImm();
-      break;
-    case 16:  //OpAsrImm
-    case 17:  //OpAsrImm
-    case 18:  //OpAsrImm
-    case 19:  //OpAsrImm
-    case 20:  //OpAsrImm
-    case 21:  //OpAsrImm
-    case 22:  //OpAsrImm
-    case 23:  //OpAsrImm
-      OpAsrImm();
-      break;
-    case 24:  //OpAddRegReg
-    case 25:  //OpAddRegReg
-      OpAddRegReg();
-      break;
-    case 26:  //OpSubRegReg
-    case 27:  //OpSubRegReg
-      OpSubRegReg();
-      break;
-    case 28:  //OpAddRegImm
-    case 29:  //OpAddRegImm
-      OpAddRegImm();
-      break;
-    case 30:  //OpSubRegImm
-    case 31:  //OpSubRegImm
-      OpSubRegImm();
-      break;
-    case 32:  //OpMovImm
-    case 33:  //OpMovImm
-    case 34:  //OpMovImm
-    case 35:  //OpMovImm
-    case 36:  //OpMovImm
-    case 37:  //OpMovImm
-    case 38:  //OpMovImm
-    case 39:  //OpMovImm
-      OpMovImm();
-      break;
-    case 40:  //OpCmpImm
-    case 41:  //OpCmpImm
-    case 42:  //OpCmpImm
-    case 43:  //OpCmpImm
-    case 44:  //OpCmpImm
-    case 45:  //OpCmpImm
-    case 46:  //OpCmpImm
-    case 47:  //OpCmpImm
-      OpCmpImm();
-      break;
-    case 48:  //OpAddImm
-    case 49:  //OpAddImm
-    case 50:  //OpAddImm
-    case 51:  //OpAddImm
-    case 52:  //OpAddImm
-    case 53:  //OpAddImm
-    case 54:  //OpAddImm
-    case 55:  //OpAddImm
-      OpAddImm();
-      break;
-    case 56:  //OpSubImm
-    case 57:  //OpSubImm
-    case 58:  //OpSubImm
-    case 59:  //OpSubImm
-    case 60:  //OpSubImm
-    case 61:  //OpSubImm
-    case 62:  //OpSubImm
-    case 63:  //OpSubImm
-      OpSubImm();
-      break;
-    case 64:  //OpArith
-    case 65:  //OpArith
-    case 66:  //OpArith
-    case 67:  //OpArith
-      OpArith();
-      break;
-    case 68:  //OpAddHi
-      OpAddHi();
-      break;
-    case 69:  //OpCmpHi
-      OpCmpHi();
-      break;
-    case 70:  //OpMovHi
-      OpMovHi();
-      break;
-    case 71:  //OpBx
-      OpBx();
-      break;
-    case 72:  //OpLdrPc
-    case 73:  //OpLdrPc
-    case 74:  //OpLdrPc
-    case 75:  //OpLdrPc
-    case 76:  //OpLdrPc
-    case 77:  //OpLdrPc
-    case 78:  //OpLdrPc
-    case 79:  //OpLdrPc
-      OpLdrPc();
-      break;
-    case 80:  //OpStrReg
-    case 81:  //OpStrReg
-      OpStrReg();
-      break;
-    case 82:  //OpStrhReg
-    case 83:  //OpStrhReg
-      OpStrhReg();
-      break;
-    case 84:  //OpStrbReg
-    case 85:  //OpStrbReg
-      OpStrbReg();
-      break;
-    case 86:  //OpLdrsbReg
-    case 87:  //OpLdrsbReg
-      OpLdrsbReg();
-      break;
-    case 88:  //OpLdrReg
-    case 89:  //OpLdrReg
-      OpLdrReg();
-      break;
-    case 90:  //OpLdrhReg
-    case 91:  //OpLdrhReg
-      OpLdrhReg();
-      break;
-    case 92:  //OpLdrbReg
-    case 93:  //OpLdrbReg
-      OpLdrbReg();
-      break;
-    case 94:  //OpLdrshReg
-    case 95:  //OpLdrshReg
-      OpLdrshReg();
-      break;
-    case 96:  //OpStrImm
-    case 97:  //OpStrImm
-    case 98:  //OpStrImm
-    case 99:  //OpStrImm
-    case 100: //OpStrImm
-    case 101: //OpStrImm
-    case 102: //OpStrImm
-    case 103: //OpStrImm
-      OpStrImm();
-      break;
-    case 104: //OpLdrImm
-    case 105: //OpLdrImm
-    case 106: //OpLdrImm
-    case 107: //OpLdrImm
-    case 108: //OpLdrImm
-    case 109: //OpLdrImm
-    case 110: //OpLdrImm
-    case 111: //OpLdrImm
-      OpLdrImm();
-      break;
-    case 112: //OpStrbImm
-    case 113: //OpStrbImm
-    case 114: //OpStrbImm
-    case 115: //OpStrbImm
-    case 116: //OpStrbImm
-    case 117: //OpStrbImm
-    case 118: //OpStrbImm
-    case 119: //OpStrbImm
-      OpStrbImm();
-      break;
-    case 120: //OpLdrbImm
-    case 121: //OpLdrbImm
-    case 122: //OpLdrbImm
-    case 123: //OpLdrbImm
-    case 124: //OpLdrbImm
-    case 125: //OpLdrbImm
-    case 126: //OpLdrbImm
-    case 127: //OpLdrbImm
-      OpLdrbImm();
-      break;
-    case 128: //OpStrhImm
-    case 129: //OpStrhImm
-    case 130: //OpStrhImm
-    case 131: //OpStrhImm
-    case 132: //OpStrhImm
-    case 133: //OpStrhImm
-    case 134: //OpStrhImm
-    case 135: //OpStrhImm
-      OpStrhImm();
-      break;
-    case 136: //OpLdrhImm
-    case 137: //OpLdrhImm
-    case 138: //OpLdrhImm
-    case 139: //OpLdrhImm
-    case 140: //OpLdrhImm
-    case 141: //OpLdrhImm
-    case 142: //OpLdrhImm
-    case 143: //OpLdrhImm
-      OpLdrhImm();
-      break;
-    case 144: //OpStrSp
-    case 145: //OpStrSp
-    case 146: //OpStrSp
-    case 147: //OpStrSp
-    case 148: //OpStrSp
-    case 149: //OpStrSp
-    case 150: //OpStrSp
-    case 151: //OpStrSp
-      OpStrSp();
-      break;
-    case 152: //OpLdrSp
-    case 153: //OpLdrSp
-    case 154: //OpLdrSp
-    case 155: //OpLdrSp
-    case 156: //OpLdrSp
-    case 157: //OpLdrSp
-    case 158: //OpLdrSp
-    case 159: //OpLdrSp
-      OpLdrSp();
-      break;
-    case 160: //OpAddPc
-    case 161: //OpAddPc
-    case 162: //OpAddPc
-    case 163: //OpAddPc
-    case 164: //OpAddPc
-    case 165: //OpAddPc
-    case 166: //OpAddPc
-    case 167: //OpAddPc
-      OpAddPc();
-      break;
-    case 168: //OpAddSp
-    case 169: //OpAddSp
-    case 170: //OpAddSp
-    case 171: //OpAddSp
-    case 172: //OpAddSp
-    case 173: //OpAddSp
-    case 174: //OpAddSp
-    case 175: //OpAddSp
-      OpAddSp();
-      break;
-    case 176: //OpSubSp
-      OpSubSp();
-      break;
-    case 177: //OpUnd
-    case 178: //OpUnd
-    case 179: //OpUnd
-      OpUnd();
-      break;
-    case 180: //OpPush
-      OpPush();
-      break;
-    case 181: //OpPushLr
-      OpPushLr();
-      break;
-    case 182: //OpUnd
-    case 183: //OpUnd
-    case 184: //OpUnd
-    case 185: //OpUnd
-    case 186: //OpUnd
-    case 187: //OpUnd
-      OpUnd();
-      break;
-    case 188: //OpPop
-      OpPop();
-      break;
-    case 189: //OpPopPc
-      OpPopPc();
-      break;
-    case 190: //OpUnd
-    case 191: //OpUnd
-      OpUnd();
-      break;
-    case 192: //OpStmia
-    case 193: //OpStmia
-    case 194: //OpStmia
-    case 195: //OpStmia
-    case 196: //OpStmia
-    case 197: //OpStmia
-    case 198: //OpStmia
-    case 199: //OpStmia
-      OpStmia();
-      break;
-    case 200: //OpLdmia
-    case 201: //OpLdmia
-    case 202: //OpLdmia
-    case 203: //OpLdmia
-    case 204: //OpLdmia
-    case 205: //OpLdmia
-    case 206: //OpLdmia
-    case 207: //OpLdmia
-      OpLdmia();
-      break;
-    case 208: //OpBCond
-    case 209: //OpBCond
-    case 210: //OpBCond
-    case 211: //OpBCond
-    case 212: //OpBCond
-    case 213: //OpBCond
-    case 214: //OpBCond
-    case 215: //OpBCond
-    case 216: //OpBCond
-    case 217: //OpBCond
-    case 218: //OpBCond
-    case 219: //OpBCond
-    case 220: //OpBCond
-    case 221: //OpBCond
-      OpBCond();
-      break;
-    case 222: //OpUnd
-      OpUnd();
-      break;
-    case 223: //OpSwi
-      OpSwi();
-      break;
-    case 224: //OpB
-    case 225: //OpB
-    case 226: //OpB
-    case 227: //OpB
-    case 228: //OpB
-    case 229: //OpB
-    case 230: //OpB
-    case 231: //OpB
-      OpB();
-      break;
-    case 232: //OpUnd
-    case 233: //OpUnd
-    case 234: //OpUnd
-    case 235: //OpUnd
-    case 236: //OpUnd
-    case 237: //OpUnd
-    case 238: //OpUnd
-    case 239: //OpUnd
-      OpUnd();
-      break;
-    case 240: //OpBl1
-    case 241: //OpBl1
-    case 242: //OpBl1
-    case 243: //OpBl1
-    case 244: //OpBl1
-    case 245: //OpBl1
-    case 246: //OpBl1
-    case 247: //OpBl1
-      OpBl1();
-      break;
-    case 248: //OpBl2
-    case 249: //OpBl2
-    case 250: //OpBl2
-    case 251: //OpBl2
-    case 252: //OpBl2
-    case 253: //OpBl2
-    case 254: //OpBl2
-    case 255: //OpBl2
-      OpBl2();
-      break;
-  }
-}
-
-
-
-
-
-
-
@@ -26,6 +26,7 @@
 #define ThumbCore_h
 
 #include <inttypes.h>
+#include "GBA_Flags.h"
 
 #define COND_EQ 0   // Z set
 #define COND_NE 1   // Z clear
@@ -61,67 +62,85 @@
 #define OP_BIC 0xE
 #define OP_MVN 0xF
 
+//Thumb handlers are indexed by the top 10 instruction bits
+#define THUMB_HANDLERS 1024
+
+//#define THUMB_TABLE_DISPATCH //Call the handler through the table of member pointers instead of a 1024 case switch
+
+#define THUMB_FUSION //Run the common instruction pairs below as one op when they come from a block
+
+//Instruction pairs the block recorder marks for fusion
+#define FUSE_NONE 0
+#define FUSE_BL 1      //BL prefix and suffix
+#define FUSE_CMP_BCC 2 //CMP immediate or low register, then a conditional branch
+#define FUSE_LDR_BX 3  //LDR rd, [pc, #] then BX rd
+#define FUSE_MOV_LSL 4 //MOV rd, # then LSL by an immediate from rd
+
+//#define THREADED_DISPATCH //Run Thumb code through the direct threaded loop (GCC labels as values) instead of the block cache
+
 class ThumbCore
 {
   public:
     //Variables
     uint16_t instructionQueue = 0;
     uint16_t curInstruction = 0;
-    uint32_t zero;
-    uint32_t carry;
-    uint32_t negative;
-    uint32_t overFlow;
+    LazyFlags flags;
     
     //Methods
     ThumbCore();
     ThumbCore(class Processor *par);
     void BeginExecution();
     void Execute();
-    void OverflowCarryAdd(uint32_t a, uint32_t b, uint32_t r);
-    void OverflowCarrySub(uint32_t a, uint32_t b, uint32_t r);
-    void OpLslImm();
-    void OpLsrImm();
-    void OpAsrImm();
-    void OpAddRegReg();
-    void OpSubRegReg();
-    void OpAddRegImm();
-    void OpSubRegImm();
-    void OpMovImm();
-    void OpCmpImm();
-    void OpAddImm();
-    void OpSubImm();
-    void OpArith();
-    void OpAddHi();
-    void OpCmpHi();
-    void OpMovHi();
-    void OpBx();
-    void OpLdrPc();
-    void OpStrReg();
-    void OpStrhReg();
-    void OpStrbReg();
-    void OpLdrsbReg();
-    void OpLdrReg();
-    void OpLdrhReg();
-    void OpLdrbReg();
-    void OpLdrshReg();
-    void OpStrImm();
-    void OpLdrImm();
-    void OpStrbImm();
-    void OpLdrbImm();
-    void OpStrhImm();
-    void OpLdrhImm();
-    void OpStrSp();
-    void OpLdrSp();
-    void OpAddPc();
-    void OpAddSp();
-    void OpSubSp();
+    void Dispatch(uint32_t handler);
+    void ExecuteBlock(struct Block *block);
+    void BlockFetch(struct Block *block, uint32_t next);
+    uint8_t FusePair(uint16_t first, uint16_t second);
+    bool ExecuteFused(struct Block *block, uint32_t i);
+    void ExecuteThreaded();
+    bool ThreadedStep();
+    template <uint32_t immed> void OpLslImm();
+    template <uint32_t immed> void OpLsrImm();
+    template <uint32_t immed> void OpAsrImm();
+    template <uint32_t rm> void OpAddRegReg();
+    template <uint32_t rm> void OpSubRegReg();
+    template <uint32_t immed> void OpAddRegImm();
+    template <uint32_t immed> void OpSubRegImm();
+    template <uint32_t rd> void OpMovImm();
+    template <uint32_t rn> void OpCmpImm();
+    template <uint32_t rd> void OpAddImm();
+    template <uint32_t rd> void OpSubImm();
+    template <uint32_t op> void OpArith();
+    template <uint32_t h> void OpAddHi();
+    template <uint32_t h> void OpCmpHi();
+    template <uint32_t h> void OpMovHi();
+    template <uint32_t h> void OpBx();
+    template <uint32_t rd> void OpLdrPc();
+    template <uint32_t rm> void OpStrReg();
+    template <uint32_t rm> void OpStrhReg();
+    template <uint32_t rm> void OpStrbReg();
+    template <uint32_t rm> void OpLdrsbReg();
+    template <uint32_t rm> void OpLdrReg();
+    template <uint32_t rm> void OpLdrhReg();
+    template <uint32_t rm> void OpLdrbReg();
+    template <uint32_t rm> void OpLdrshReg();
+    template <uint32_t immed> void OpStrImm();
+    template <uint32_t immed> void OpLdrImm();
+    template <uint32_t immed> void OpStrbImm();
+    template <uint32_t immed> void OpLdrbImm();
+    template <uint32_t immed> void OpStrhImm();
+    template <uint32_t immed> void OpLdrhImm();
+    template <uint32_t rd> void OpStrSp();
+    template <uint32_t rd> void OpLdrSp();
+    template <uint32_t rd> void OpAddPc();
+    template <uint32_t rd> void OpAddSp();
+    template <uint32_t sub> void OpSubSp();
     void OpPush();
     void OpPushLr();
     void OpPop();
     void OpPopPc();
-    void OpStmia();
-    void OpLdmia();
-    void OpBCond();
+    template <uint32_t rn> void OpStmia();
+    template <uint32_t rn> void OpLdmia();
+    template <uint32_t condition> void OpBCond();
     void OpSwi();
     void OpB();
     void OpBl1();
@@ -130,9 +149,10 @@ class ThumbCore
     void PackFlags();
     void UnpackFlags();
     void FlushQueue();
-    void NormalOps(uint8_t op);
 };
 
+typedef void (ThumbCore::*ThumbHandler)();
+
 #endif
 
 
@@ -53,6 +53,9 @@ void setup()
   unsigned long ReadTimeSeq = 0.0;
   unsigned long AddressTime = 0.0;
   unsigned long AddressTimeSeq = 0.0;
+  unsigned long ReadTimeBurst = 0.0;
+  unsigned long WriteTimeBurst = 0.0;
+  uint8_t BurstBuffer[32];
   unsigned long Timer = 0;
 
   for(int i = 0; i < 30; i++)
@@ -87,6 +90,16 @@ void setup()
     Timer = ARM_DWT_CYCCNT - Timer;
     AddressTimeSeq += Timer;
 
+    Timer = ARM_DWT_CYCCNT;
+    SPIRAMWriteBurst((i * 64), BurstBuffer, sizeof(BurstBuffer));
+    Timer = ARM_DWT_CYCCNT - Timer;
+    WriteTimeBurst += Timer;
+
+    Timer = ARM_DWT_CYCCNT;
+    SPIRAMReadBurst((i * 64), BurstBuffer, sizeof(BurstBuffer));
+    Timer = ARM_DWT_CYCCNT - Timer;
+    ReadTimeBurst += Timer;
+
     SPIRAMRead(0);
   }
 
@@ -100,6 +113,9 @@ void setup()
 
   Serial.println("Memory Address Time: " + String(((float)AddressTime / 30.0f) * timemulti) + "us");
   Serial.println("Memory Address Time Seq: " + String(((float)AddressTimeSeq / 30.0f) * timemulti) + "us");
+
+  Serial.println("Memory Read Time Burst (per byte): " + String(((float)ReadTimeBurst / (30.0f * sizeof(BurstBuffer))) * timemulti) + "us");
+  Serial.println("Memory Write Time Burst (per byte): " + String(((float)WriteTimeBurst / (30.0f * sizeof(BurstBuffer))) * timemulti) + "us");
   
   while(true)
   {
@@ -0,0 +1,70 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+//Linux driver for the host build, runs a ROM for a number of frames with nothing pressed.
+//Each frame EnterVBlank prints the SRAM model report, see GBA_SRAMModel.h.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <SD.h>
+#include "GBA.h"
+
+bool HostSaveScreen(const char *path);
+
+GBA GBAEmulator;
+
+int main(int argc, char **argv)
+{
+  if(argc < 2)
+  {
+    fprintf(stderr, "usage: %s rom.gba [frames] [screen.ppm]\n", argv[0]);
+    return 1;
+  }
+
+  File rom = SD.open(argv[1], FILE_READ);
+
+  if(!rom)
+  {
+    fprintf(stderr, "can't open %s\n", argv[1]);
+    return 1;
+  }
+
+  uint32_t frames = argc > 2 ? strtoul(argv[2], NULL, 0) : 60;
+
+  GBAEmulator.Initilise(&rom);
+
+  for(uint32_t i = 0; i < frames; i++)
+  {
+    GBAEmulator.Update();
+  }
+
+  if(argc > 3 && !HostSaveScreen(argv[3]))
+  {
+    fprintf(stderr, "can't write %s\n", argv[3]);
+    return 1;
+  }
+
+  Serial.flush();
+  return 0;
+}
@@ -0,0 +1,114 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef HostArduino_h
+#define HostArduino_h
+
+//Linux stand-in for the parts of the Teensy core the emulator uses, see host/Makefile.
+//Pins read back as released buttons, Serial prints to stdout and the clocks are the host's.
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+#define DMAMEM
+#define FASTRUN
+
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define LOW 0
+#define HIGH 1
+
+#define BIN 2
+#define OCT 8
+#define DEC 10
+#define HEX 16
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+uint8_t digitalRead(uint8_t pin);
+#define digitalReadFast(pin) digitalRead(pin)
+void delay(uint32_t ms);
+uint32_t millis();
+uint32_t micros();
+
+//Host time in 180MHz Teensy cycles
+uint32_t HostCycles();
+#define ARM_DWT_CYCCNT HostCycles()
+
+class String
+{
+  public:
+    String() {}
+    String(const char *value) : text(value) {}
+    String(char value) : text(1, value) {}
+    String(int value, uint8_t base = DEC) : text(Format((int64_t)value, base)) {}
+    String(unsigned int value, uint8_t base = DEC) : text(Format((uint64_t)value, base)) {}
+    String(long value, uint8_t base = DEC) : text(Format((int64_t)value, base)) {}
+    String(unsigned long value, uint8_t base = DEC) : text(Format((uint64_t)value, base)) {}
+    String(float value, uint8_t decimals = 2) : String((double)value, decimals) {}
+    String(double value, uint8_t decimals = 2);
+
+    String operator+(const String &other) const { String s; s.text = text + other.text; return s; }
+    String &operator+=(const String &other) { text += other.text; return *this; }
+    friend String operator+(const char *left, const String &right) { return String(left) + right; }
+    const char *c_str() const { return text.c_str(); }
+    unsigned int length() const { return text.length(); }
+
+  private:
+    std::string text;
+
+    static std::string Format(uint64_t value, uint8_t base);
+    static std::string Format(int64_t value, uint8_t base);
+};
+
+class Print
+{
+  public:
+    virtual size_t write(uint8_t c) = 0;
+    virtual ~Print() {}
+};
+
+class HostSerial
+{
+  public:
+    void begin(uint32_t baud) {}
+    void print(const String &value);
+    void println(const String &value = String());
+    void printf(const char *format, ...);
+    void flush();
+
+    bool mute = false; //Drops everything printed, for benchmarks
+};
+
+extern HostSerial Serial;
+
+#endif
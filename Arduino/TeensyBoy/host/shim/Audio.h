@@ -0,0 +1,52 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef HostAudio_h
+#define HostAudio_h
+
+//Linux stand-in for the Teensy Audio library, samples are dropped
+
+#include "Arduino.h"
+
+class AudioStream {};
+
+class AudioOutputAnalog : public AudioStream {};
+
+class AudioPlayMemory : public AudioStream
+{
+  public:
+    void play(const unsigned int *data) {}
+    void stop() {}
+    bool isPlaying() { return false; }
+};
+
+class AudioConnection
+{
+  public:
+    AudioConnection(AudioStream &source, uint8_t sourceOutput, AudioStream &destination, uint8_t destinationInput) {}
+};
+
+inline void AudioMemory(uint16_t blocks) {}
+
+#endif
@@ -0,0 +1,201 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <chrono>
+#include <thread>
+#include "Arduino.h"
+#include "SD.h"
+#include "ILI9341_t3DMA.h"
+
+HostSerial Serial;
+SDClass SD;
+
+static const auto HostStart = std::chrono::steady_clock::now();
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+}
+
+//Buttons are active low, nothing is ever pressed
+uint8_t digitalRead(uint8_t pin)
+{
+  return HIGH;
+}
+
+void delay(uint32_t ms)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+uint32_t millis()
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - HostStart).count();
+}
+
+uint32_t micros()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - HostStart).count();
+}
+
+uint32_t HostCycles()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - HostStart).count() * 180 / 1000;
+}
+
+String::String(double value, uint8_t decimals)
+{
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+  text = buffer;
+}
+
+std::string String::Format(uint64_t value, uint8_t base)
+{
+  const char *digits = "0123456789ABCDEF";
+  std::string s;
+
+  do
+  {
+    s.insert(s.begin(), digits[value % base]);
+    value /= base;
+  } while(value != 0);
+
+  return s;
+}
+
+std::string String::Format(int64_t value, uint8_t base)
+{
+  //Like the Teensy core, only decimal gets a sign
+  if(base == DEC && value < 0)
+  {
+    return "-" + Format((uint64_t)-value, base);
+  }
+
+  return Format((uint64_t)(base == DEC ? value : (uint32_t)value), base);
+}
+
+void HostSerial::print(const String &value)
+{
+  if(mute) return;
+  fputs(value.c_str(), stdout);
+}
+
+void HostSerial::println(const String &value)
+{
+  if(mute) return;
+  fputs(value.c_str(), stdout);
+  fputc('\n', stdout);
+}
+
+void HostSerial::printf(const char *format, ...)
+{
+  if(mute) return;
+
+  va_list args;
+  va_start(args, format);
+  vprintf(format, args);
+  va_end(args);
+}
+
+void HostSerial::flush()
+{
+  fflush(stdout);
+}
+
+uint32_t File::size()
+{
+  if(handle == NULL) return 0;
+
+  long current = ftell(handle);
+  fseek(handle, 0, SEEK_END);
+  long end = ftell(handle);
+  fseek(handle, current, SEEK_SET);
+  return end;
+}
+
+//The members of ILI9341_t3DMA the emulator draws with, against a plain framebuffer
+uint16_t screen[ILI9341_TFTHEIGHT][ILI9341_TFTWIDTH];
+uint32_t *screen32 = (uint32_t*)&screen[0][0];
+
+void ILI9341_t3DMA::begin(void)
+{
+}
+
+void ILI9341_t3DMA::refreshOnce(void)
+{
+}
+
+void ILI9341_t3DMA::dfillScreen(uint16_t color)
+{
+  for(uint32_t i = 0; i < ILI9341_TFTHEIGHT * ILI9341_TFTWIDTH; i++)
+  {
+    (&screen[0][0])[i] = color;
+  }
+}
+
+void ILI9341_t3DMA::ddrawPixel(int16_t x, int16_t y, uint16_t color)
+{
+  if((x < 0) || (x >= _width) || (y < 0) || (y >= _height)) return;
+  screen[y][x] = color;
+}
+
+uint16_t ILI9341_t3DMA::dgetPixel(int16_t x, int16_t y)
+{
+  if((x < 0) || (x >= _width) || (y < 0) || (y >= _height)) return 0;
+  return screen[y][x];
+}
+
+size_t ILI9341_t3DMA::write(uint8_t c)
+{
+  return 1;
+}
+
+//Binary PPM of the framebuffer, for checking what a ROM drew
+bool HostSaveScreen(const char *path)
+{
+  FILE *f = fopen(path, "wb");
+
+  if(f == NULL) return false;
+
+  fprintf(f, "P6\n%d %d\n255\n", ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT);
+
+  for(uint32_t y = 0; y < ILI9341_TFTHEIGHT; y++)
+  {
+    for(uint32_t x = 0; x < ILI9341_TFTWIDTH; x++)
+    {
+      uint16_t c = screen[y][x];
+      uint8_t rgb[3] = { (uint8_t)((c >> 8) & 0xF8), (uint8_t)((c >> 3) & 0xFC), (uint8_t)((c << 3) & 0xF8) };
+      fwrite(rgb, 1, 3, f);
+    }
+  }
+
+  fclose(f);
+  return true;
+}
@@ -0,0 +1,63 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+#ifndef HostSD_h
+#define HostSD_h
+
+//Linux stand-in for the Teensy SD library, paths are opened relative to the working directory
+
+#include <stdio.h>
+#include "Arduino.h"
+
+#define FILE_READ 0
+#define BUILTIN_SDCARD 254
+
+class File
+{
+  public:
+    File(FILE *handle = NULL) : handle(handle) {}
+
+    bool seek(uint32_t position) { return handle != NULL && fseek(handle, position, SEEK_SET) == 0; }
+    uint32_t position() { return handle != NULL ? ftell(handle) : 0; }
+    int read() { return handle != NULL ? fgetc(handle) : -1; }
+    int read(void *buffer, uint32_t length) { return handle != NULL ? fread(buffer, 1, length, handle) : -1; }
+    uint32_t size();
+    int available() { return size() - position(); }
+    void close() { if(handle != NULL) fclose(handle); handle = NULL; }
+    operator bool() const { return handle != NULL; }
+
+  private:
+    FILE *handle;
+};
+
+class SDClass
+{
+  public:
+    bool begin(uint8_t pin) { return true; }
+    File open(const char *path, uint8_t mode = FILE_READ) { return File(fopen(path, "rb")); }
+};
+
+extern SDClass SD;
+
+#endif
@@ -0,0 +1,323 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+//Checks the native BIOS calls against fixed vectors: LZ77, RL and Huffman streams built by hand
+//with their plain data, CpuSet and CpuFastSet copies and fills, BitUnPack and Div. Halt and an
+//IntrWait that halts have to end the slice without charging the call on top.
+
+#include <stdio.h>
+#include <string.h>
+#include "GBA_Arm7.h"
+#include "GBA_ArmCore.h"
+#include "GBA_ThumbCore.h"
+#include "GBA_SoundManager.h"
+#include "GBA_BiosHle.h"
+
+extern ArmCore armCore;
+extern ThumbCore thumbCore;
+extern SoundManager sound;
+
+static Processor p;
+static uint32_t failures = 0;
+
+#define SOURCE 0x03001000
+#define DEST 0x03002000
+#define VRAM_DEST 0x06000000
+#define CODE 0x03000000
+#define SLICE 1000
+
+//"ABC", then 9 bytes from 3 back, "D", "xy", 18 bytes from 1 back, 5 from 20 back, "!?"
+static const uint8_t Lz77[] =
+{
+  0x10, 0x28, 0x00, 0x00, 0x11, 0x41, 0x42, 0x43, 0x60, 0x02, 0x44, 0x78, 0x79, 0xF0, 0x00, 0x80,
+  0x20, 0x13, 0x21, 0x3F
+};
+
+static const uint8_t Lz77Plain[] =
+{
+  0x41, 0x42, 0x43, 0x41, 0x42, 0x43, 0x41, 0x42, 0x43, 0x41, 0x42, 0x43, 0x44, 0x78, 0x79, 0x79,
+  0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
+  0x79, 0x78, 0x79, 0x79, 0x79, 0x79, 0x21, 0x3F
+};
+
+//5 "A"s, "xyz", 130 "B"s, "0123456789"
+static const uint8_t Rl[] =
+{
+  0x30, 0x94, 0x00, 0x00, 0x82, 0x41, 0x02, 0x78, 0x79, 0x7A, 0xFF, 0x42, 0x09, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x00
+};
+
+//a is 0, b 10 and c 11
+static const uint8_t Huff8[] =
+{
+  0x28, 0x10, 0x00, 0x00, 0x03, 0x80, 0x61, 0xC0, 0x62, 0x63, 0x00, 0x00, 0x00, 0x58, 0x67, 0x4D
+};
+
+static const uint8_t Huff4[] =
+{
+  0x24, 0x08, 0x00, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x02, 0x03, 0x00, 0x00, 0xC0, 0x73, 0x9D, 0x59
+};
+
+static void Check(const char *name, bool ok)
+{
+  if(!ok)
+  {
+    printf("BiosHleTest: %s FAILED\n", name);
+    failures++;
+  }
+}
+
+static void Load(uint32_t address, const uint8_t *data, uint32_t length)
+{
+  for(uint32_t i = 0; i < length; i++)
+  {
+    p.WriteU8(address + i, data[i]);
+  }
+}
+
+//Clears 200h bytes at the destination to EEh, so writes past the end show up
+static void Clear(uint32_t address)
+{
+  for(uint32_t i = 0; i < 0x200; i += 2)
+  {
+    p.WriteU16(address + i, 0xEEEE);
+  }
+}
+
+static bool Matches(uint32_t address, const uint8_t *expected, uint32_t length)
+{
+  for(uint32_t i = 0; i < length; i++)
+  {
+    if(p.ReadU8(address + i) != expected[i])
+    {
+      return false;
+    }
+  }
+
+  return p.ReadU8(address + length) == 0xEE;
+}
+
+static void Call(uint32_t swi, uint32_t r0, uint32_t r1, uint32_t r2)
+{
+  p.registers[0] = r0;
+  p.registers[1] = r1;
+  p.registers[2] = r2;
+  p.Cycles = SLICE;
+  biosHle.Call(swi);
+}
+
+static void Decompress()
+{
+  Load(SOURCE, Lz77, sizeof(Lz77));
+  Clear(DEST);
+  Call(0x11, SOURCE, DEST, 0);
+  Check("LZ77UnCompWram", Matches(DEST, Lz77Plain, sizeof(Lz77Plain)));
+  Clear(VRAM_DEST);
+  Call(0x12, SOURCE, VRAM_DEST, 0);
+  Check("LZ77UnCompVram", Matches(VRAM_DEST, Lz77Plain, sizeof(Lz77Plain)));
+
+  uint8_t plain[148];
+  memset(plain, 'A', 5);
+  memcpy(&plain[5], "xyz", 3);
+  memset(&plain[8], 'B', 130);
+  memcpy(&plain[138], "0123456789", 10);
+
+  Load(SOURCE, Rl, sizeof(Rl));
+  Clear(DEST);
+  Call(0x14, SOURCE, DEST, 0);
+  Check("RLUnCompWram", Matches(DEST, plain, sizeof(plain)));
+  Clear(VRAM_DEST);
+  Call(0x15, SOURCE, VRAM_DEST, 0);
+  Check("RLUnCompVram", Matches(VRAM_DEST, plain, sizeof(plain)));
+
+  Load(SOURCE, Huff8, sizeof(Huff8));
+  Clear(DEST);
+  Call(0x13, SOURCE, DEST, 0);
+  Check("HuffUnComp 8 bit", Matches(DEST, (const uint8_t *)"abacabcaacbbcaaa", 16));
+
+  //Units fill each byte from the low nibble up
+  static const uint8_t nibbles[] = { 0x21, 0x13, 0x31, 0x11, 0x23, 0x32, 0x12, 0x33 };
+  Load(SOURCE, Huff4, sizeof(Huff4));
+  Clear(DEST);
+  Call(0x13, SOURCE, DEST, 0);
+  Check("HuffUnComp 4 bit", Matches(DEST, nibbles, sizeof(nibbles)));
+}
+
+static void Copies()
+{
+  static const uint8_t words[] =
+  {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F
+  };
+  uint8_t fill[64];
+
+  Load(SOURCE, words, sizeof(words));
+
+  //5 halfwords, then 3 words
+  Clear(DEST);
+  Call(0x0B, SOURCE, DEST, 5);
+  Check("CpuSet 16 bit copy", Matches(DEST, words, 10));
+  Clear(DEST);
+  Call(0x0B, SOURCE, DEST, 3 | (1 << 26));
+  Check("CpuSet 32 bit copy", Matches(DEST, words, 12));
+
+  for(uint32_t i = 0; i < sizeof(fill); i++)
+  {
+    fill[i] = words[i & 1];
+  }
+
+  Clear(DEST);
+  Call(0x0B, SOURCE, DEST, 5 | (1 << 24));
+  Check("CpuSet 16 bit fill", Matches(DEST, fill, 10));
+
+  for(uint32_t i = 0; i < sizeof(fill); i++)
+  {
+    fill[i] = words[i & 3];
+  }
+
+  Clear(DEST);
+  Call(0x0B, SOURCE, DEST, 3 | (1 << 24) | (1 << 26));
+  Check("CpuSet 32 bit fill", Matches(DEST, fill, 12));
+
+  //Counts round up to a multiple of 8 words
+  Clear(DEST);
+  Call(0x0C, SOURCE, DEST, 9);
+  Check("CpuFastSet copy", Matches(DEST, words, 64));
+  Clear(DEST);
+  Call(0x0C, SOURCE, DEST, 3 | (1 << 24));
+  Check("CpuFastSet fill", Matches(DEST, fill, 32));
+}
+
+static void BitUnPack()
+{
+  //u16 length, u8 source bits, u8 destination bits, u32 offset
+  static const uint8_t info[] =
+  {
+    0x02, 0x00, 0x01, 0x04, 0x01, 0x00, 0x00, 0x00, //1 to 4 bits, +1 to non zero units
+    0x02, 0x00, 0x01, 0x04, 0x01, 0x00, 0x00, 0x80, //1 to 4 bits, +1 to every unit
+    0x02, 0x00, 0x02, 0x08, 0x10, 0x00, 0x00, 0x00  //2 to 8 bits, +10h to non zero units
+  };
+  static const uint8_t source[] = { 0xA5, 0x0F, 0xE4, 0x1B };
+  static const uint8_t oneToFour[] = { 0x02, 0x02, 0x20, 0x20, 0x22, 0x22, 0x00, 0x00 };
+  static const uint8_t oneToFourZero[] = { 0x12, 0x12, 0x21, 0x21, 0x22, 0x22, 0x11, 0x11 };
+  static const uint8_t twoToEight[] = { 0x00, 0x11, 0x12, 0x13, 0x13, 0x12, 0x11, 0x00 };
+
+  Load(SOURCE, source, sizeof(source));
+  Load(SOURCE + 0x100, info, sizeof(info));
+
+  Clear(DEST);
+  Call(0x10, SOURCE, DEST, SOURCE + 0x100);
+  Check("BitUnPack 1 to 4 bits", Matches(DEST, oneToFour, sizeof(oneToFour)));
+  Clear(DEST);
+  Call(0x10, SOURCE, DEST, SOURCE + 0x108);
+  Check("BitUnPack offset on zero", Matches(DEST, oneToFourZero, sizeof(oneToFourZero)));
+  Clear(DEST);
+  Call(0x10, SOURCE + 2, DEST, SOURCE + 0x110);
+  Check("BitUnPack 2 to 8 bits", Matches(DEST, twoToEight, sizeof(twoToEight)));
+}
+
+//numerator, denominator, r0 quotient, r1 remainder, r3 absolute quotient
+static const uint32_t DivVectors[][5] =
+{
+  {7, 2, 3, 1, 3},
+  {0xFFFFFFF9, 2, 0xFFFFFFFD, 0xFFFFFFFF, 3},
+  {7, 0xFFFFFFFE, 0xFFFFFFFD, 1, 3},
+  {0xFFFFFFF9, 0xFFFFFFFE, 3, 0xFFFFFFFF, 3},
+  {0x80000000, 0xFFFFFFFF, 0x80000000, 0, 0x80000000},
+  {100, 100, 1, 0, 1},
+  {3, 7, 0, 3, 0}
+};
+
+static void Div()
+{
+  bool div = true;
+  bool divArm = true;
+
+  for(uint32_t i = 0; i < sizeof(DivVectors) / sizeof(DivVectors[0]); i++)
+  {
+    const uint32_t *v = DivVectors[i];
+
+    Call(0x06, v[0], v[1], 0);
+    div = div && p.registers[0] == v[2] && p.registers[1] == v[3] && p.registers[3] == v[4];
+
+    //DivArm takes the operands the other way round
+    Call(0x07, v[1], v[0], 0);
+    divArm = divArm && p.registers[0] == v[2] && p.registers[1] == v[3] && p.registers[3] == v[4];
+  }
+
+  Check("Div", div);
+  Check("DivArm", divArm);
+}
+
+static void Halts()
+{
+  p.registers[15] = CODE + 8;
+
+  Call(0x02, 0, 0, 0);
+  Check("Halt halts", p.cpuHalted);
+  Check("Halt leaves no cycle debt", p.Cycles == 0);
+  p.cpuHalted = false;
+
+  //Nothing flagged yet, so IntrWait halts and runs again after the interrupt
+  p.WriteU16(BIOS_IRQ_FLAGS, 0);
+  Call(0x04, 1, 1, 0);
+  Check("IntrWait halts", p.cpuHalted);
+  Check("IntrWait halting leaves no cycle debt", p.Cycles == 0);
+  Check("IntrWait runs again", armCore.instructionQueue == 0xEF000004 && p.registers[15] == CODE + 4);
+  p.cpuHalted = false;
+
+  p.WriteU16(BIOS_IRQ_FLAGS, 1);
+  Call(0x04, 1, 1, 0);
+  Check("IntrWait returns", !p.cpuHalted && p.ReadU16(BIOS_IRQ_FLAGS) == 0);
+  Check("IntrWait returning is charged", p.Cycles == SLICE - BIOS_CALL_CYCLES);
+}
+
+int main()
+{
+  armCore = ArmCore(&p);
+  thumbCore = ThumbCore(&p);
+  sound.StartSM(44100, &p);
+  p.BuildPageTable();
+  p.Reset(true);
+  biosHle.Begin(&p);
+
+  p.WriteU32(CODE, 0xEF000004);      //swi 04h
+  p.WriteU32(CODE + 4, 0xEAFFFFFD);  //b CODE
+
+  Decompress();
+  Copies();
+  BitUnPack();
+  Div();
+  Halts();
+
+  if(failures == 0)
+  {
+    printf("BiosHleTest: ok\n");
+  }
+
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,162 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+//Emulated MIPS of the plain interpreter and of the block cache (linked when BLOCK_LINKING is set),
+//on the same ROM and frame count. Each engine boots the ROM in its own process, so neither run
+//starts from state the other left behind. Built with BLOCK_CACHE_STATS so the cores count
+//instructions. Without a ROM it makes one that runs the ThumbBench mix from cartridge ROM.
+//
+//   EngineBench [rom.gba] [frames]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <chrono>
+#include <SD.h>
+#include "GBA.h"
+
+GBA GBAEmulator;
+
+//Built with THREADED_DISPATCH, Thumb code runs threaded in both runs and only ARM code uses the cache
+#ifdef THREADED_DISPATCH
+#define BENCH_NAME "EngineBench (threaded)"
+#else
+#define BENCH_NAME "EngineBench"
+#endif
+
+static const uint32_t Boot[] = { 0xE28F0001, 0xE12FFF10 }; //add r0, pc, #1; bx r0
+
+static const uint16_t Mix[] =
+{
+  0x2003, 0x0600, 0x2101, 0x0309, 0x1840, 0x2700,
+  0x6801, 0x6842, 0x188B, 0x00DC, 0x404C, 0x4014, 0x431C, 0x6084,
+  0x8845, 0x7305, 0x46A0, 0x4444, 0xB41E, 0xF000, 0xF808, 0xBC1E,
+  0x1E4E, 0x42B6, 0xD1EC, 0x6003, 0x6046, 0x3701, 0xE7E8,
+  0x0849, 0x3201, 0x4770
+};
+
+static File MixRom()
+{
+  static uint8_t rom[0x10000];
+
+  uint32_t entry = 0xEA000000 | ((0xC0 - 8) / 4); //b 0xC0
+  memcpy(&rom[0x00], &entry, 4);
+  memcpy(&rom[0xAC], "EBNC", 4);
+  rom[0xB2] = 0x96;
+  memcpy(&rom[0xC0], Boot, sizeof(Boot));
+  memcpy(&rom[0xC8], Mix, sizeof(Mix));
+
+  FILE *file = tmpfile();
+  fwrite(rom, 1, sizeof(rom), file);
+  return File(file);
+}
+
+//Boots the ROM and runs it, returns emulated MIPS
+static double Run(File *rom, uint32_t frames, bool blocks, uint64_t *instructions)
+{
+  blockCache.enabled = blocks;
+  GBAEmulator.Initilise(rom);
+  *instructions = 0;
+
+  double seconds = 0;
+
+  for(uint32_t i = 0; i < frames; i++)
+  {
+    blockCache.executed = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    GBAEmulator.Update();
+    seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    *instructions += blockCache.executed;
+  }
+
+  return (double)*instructions / seconds / 1000000.0;
+}
+
+struct EngineResult
+{
+  uint64_t instructions;
+  double mips;
+};
+
+//Runs one engine in a child process, false when the ROM can't be opened
+static bool RunForked(int argc, char **argv, uint32_t frames, bool blocks, EngineResult *result)
+{
+  int fds[2];
+
+  if(pipe(fds) != 0)
+  {
+    return false;
+  }
+
+  fflush(stdout);
+  pid_t pid = fork();
+
+  if(pid == 0)
+  {
+    File rom = argc > 1 ? SD.open(argv[1], FILE_READ) : MixRom();
+    EngineResult child = {};
+
+    if(rom)
+    {
+      Serial.mute = true;
+      child.mips = Run(&rom, frames, blocks, &child.instructions);
+    }
+
+    _exit(write(fds[1], &child, sizeof(child)) == sizeof(child) && rom ? 0 : 1);
+  }
+
+  close(fds[1]);
+  bool ok = pid > 0 && read(fds[0], result, sizeof(*result)) == sizeof(*result);
+  close(fds[0]);
+
+  int status = 1;
+
+  if(pid > 0)
+  {
+    waitpid(pid, &status, 0);
+  }
+
+  return ok && status == 0;
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t frames = argc > 2 ? strtoul(argv[2], NULL, 0) : 300;
+  EngineResult interpreted;
+  EngineResult cached;
+
+  if(!RunForked(argc, argv, frames, false, &interpreted) || !RunForked(argc, argv, frames, true, &cached))
+  {
+    fprintf(stderr, "can't run %s\n", argc > 1 ? argv[1] : "the built-in Thumb mix");
+    return 1;
+  }
+
+  printf(BENCH_NAME ": %s, %u frames\n", argc > 1 ? argv[1] : "built-in Thumb mix", frames);
+  printf("  Interpreter: %llu instructions, %.1f MIPS\n", (unsigned long long)interpreted.instructions, interpreted.mips);
+  printf("  Block cache: %llu instructions, %.1f MIPS (%.2fx)\n", (unsigned long long)cached.instructions, cached.mips, cached.mips / interpreted.mips);
+  return 0;
+}
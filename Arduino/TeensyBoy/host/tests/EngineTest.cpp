@@ -0,0 +1,1026 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+//Differential test of the execution engines. Random ARM and Thumb programs run from IWRAM once
+//through the plain interpreter (blockCache.enabled off) and once through the block cache, in
+//short slices of random length so blocks get cut anywhere. Registers, CPSR, Cycles and the
+//queued instruction have to match after every slice, and memory at the end. Some programs
+//store into their own code, which has to drop the blocks recorded from it.
+//Fixed vectors check results and flags of the ARM ops the decoder gets wrong most easily,
+//MSR/MRS round trips through the lazy flags and every condition against every NZCV.
+//The Thumb programs are seeded with the four FUSE_* pairs, and a fixed loop of them is run with
+//every slice length up to 48 so slices also end between the two halves of each pair.
+//Every page but IWRAM reads a fixed pattern and writes to a scratch buffer, so stray loads and
+//stores stay deterministic, can't start a DMA or halt the CPU, and code the programs stray into
+//outside IWRAM can't change under the block cache.
+//
+//   EngineTest [runs file]
+
+#include <stdio.h>
+#include <string.h>
+#include "GBA_Arm7.h"
+#include "GBA_ArmCore.h"
+#include "GBA_ThumbCore.h"
+#include "GBA_SoundManager.h"
+#include "GBA_BiosHle.h"
+
+extern ArmCore armCore;
+extern ThumbCore thumbCore;
+extern SoundManager sound;
+
+static Processor p;
+static Processor initial;
+static uint32_t failures = 0;
+
+#define PROGRAMS 500       //Of each kind
+#define SLICES 160         //Per program
+#define SLICE_CYCLES 128   //Longest slice
+#define THUMB_OPS 600      //Program length in instructions
+#define ARM_OPS 800
+#define CODE 0x03000000
+
+//A misaligned fetch at the end of a page reads up to 3 bytes past it
+static uint8_t fill[0x8000 + 4];    //B . in ARM state
+static uint8_t scratch[0x8000 + 4];
+static uint8_t program[0x8000];
+
+struct EngineState
+{
+  uint32_t registers[16];
+  uint32_t cpsr;
+  int32_t cycles;
+  uint32_t queue;
+};
+
+struct EngineRun
+{
+  EngineState slices[SLICES];
+  uint8_t iwram[0x8000];
+  uint8_t scratch[0x8000];
+};
+
+static EngineRun runs[2];
+static uint32_t sliceCycles[SLICES];
+static uint32_t initialRegisters[16];
+static uint32_t initialCpsr;
+
+static uint32_t seed = 1;
+static FILE *runsFile = NULL;
+
+static uint32_t Random()
+{
+  seed = seed * 1103515245U + 12345U;
+  uint32_t high = seed >> 16;
+  seed = seed * 1103515245U + 12345U;
+  return (high << 16) | (seed >> 16);
+}
+
+static void Check(const char *name, bool ok)
+{
+  if(!ok)
+  {
+    printf("EngineTest: %s FAILED\n", name);
+    failures++;
+  }
+}
+
+//mov r5, #3; lsl r5, r5, #8; add r5, #odd; mov r6, #3; lsl r6, r6, #24; add r6, #y; strh r5, [r6, #z]
+//stores 03xxh, an LSL by 12 to 15, over one of the first 160 instructions. As the high half of
+//an LDR/BX literal it keeps the target in IWRAM, as the low half it keeps it odd (Thumb).
+static uint32_t ThumbSelfModify(uint16_t *code, uint32_t n)
+{
+  code[n++] = 0x2503;
+  code[n++] = 0x022D;
+  code[n++] = 0x3500 | (Random() & 0xFF) | 1;
+  code[n++] = 0x2603;
+  code[n++] = 0x0636;
+  code[n++] = 0x3600 | (Random() & 0xFF);
+  code[n++] = 0x8035 | ((Random() & 0x1F) << 6);
+  return n;
+}
+
+//mov r5, #E1000000h; orr r5, r5, #A00000h; orr r5, r5, #x; mov r6, #3000000h; add r6, r6, #y; str r5, [r6, #z]
+//stores a MOV r0, rm with a shift over one of the first 512 instructions
+static uint32_t ArmSelfModify(uint32_t *code, uint32_t n)
+{
+  code[n++] = 0xE3A054E1;
+  code[n++] = 0xE385560A;
+  code[n++] = 0xE3855000 | (Random() & 0x7F);
+  code[n++] = 0xE3A06403;
+  code[n++] = 0xE2866F00 | (Random() & 0xFF);
+  code[n++] = 0xE5865000 | (Random() & 0x3FC);
+  return n;
+}
+
+//One of the FUSE_* pairs with random operands
+static uint32_t ThumbPair(uint16_t *code, uint32_t n)
+{
+  uint32_t rd = Random() & 7;
+
+  switch(Random() % 5)
+  {
+    case 0: //cmp rd, #; bcc
+    {
+      int8_t offSet = (int8_t)((Random() % 40) - 10);
+      if(offSet < 0 && n < 60) offSet = -offSet;
+      code[n++] = 0x2800 | (rd << 8) | (Random() & 0xFF);
+      code[n++] = 0xD000 | ((Random() % 14) << 8) | (uint8_t)offSet;
+      break;
+    }
+    case 1: //cmp rd, rm; bcc
+      code[n++] = 0x4280 | rd | ((Random() & 7) << 3);
+      code[n++] = 0xD000 | ((Random() % 14) << 8) | (Random() % 30);
+      break;
+    case 2: //mov rd, #; lsl rx, rd, #
+      code[n++] = 0x2000 | (rd << 8) | (Random() & 0xFF);
+      code[n++] = ((Random() & 0x1F) << 6) | (rd << 3) | (Random() & 7);
+      break;
+    case 3: //bl forward
+      code[n++] = 0xF000;
+      code[n++] = 0xF800 | (Random() % 20);
+      break;
+    case 4: //ldr rd, [pc]; bx rd to the Thumb code after the literal
+    {
+      if(n & 1) code[n++] = 0x46C0;
+      code[n++] = 0x4800 | (rd << 8);
+      code[n++] = 0x4700 | (rd << 3);
+      uint32_t target = CODE + 2 * (n + 2) + 1;
+      code[n++] = (uint16_t)target;
+      code[n++] = (uint16_t)(target >> 16);
+      break;
+    }
+  }
+
+  return n;
+}
+
+//Random Thumb code without SWIs, BX, loads from PC, PC writes or branches out of IWRAM,
+//ends with a branch back to the start
+static void ThumbProgram()
+{
+  uint16_t *code = (uint16_t *)program;
+  uint32_t n = 0;
+
+  while(n < THUMB_OPS)
+  {
+    if(Random() % 24 == 0)
+    {
+      n = ThumbSelfModify(code, n);
+      continue;
+    }
+
+    if(Random() % 4 == 0)
+    {
+      n = ThumbPair(code, n);
+      continue;
+    }
+
+    uint16_t i = (uint16_t)Random();
+    uint32_t top = i >> 8;
+
+    if(top >= 0xE0 && top < 0xE8)
+    {
+      i = 0xE000 | (Random() & 0x3F);
+    }
+    else if(top >= 0xD0 && top < 0xE0)
+    {
+      if(top >= 0xDE) continue;
+      int8_t offSet = (int8_t)(Random() & 0xFF) % 48;
+      if(offSet < 0 && n < 60) offSet = -offSet;
+      i = (i & 0xFF00) | (uint8_t)offSet;
+    }
+    else if(top >= 0xE8 || top == 0x47 || top == 0xBD || (top >= 0x48 && top < 0x50)) continue;
+    else if((top == 0x44 || top == 0x46) && (i & 0x87) == 0x87) continue;
+    else if((top >= 0xB1 && top <= 0xB3) || (top >= 0xB6 && top <= 0xBB) || top >= 0xBE) continue;
+
+    code[n++] = i;
+  }
+
+  code[n] = 0xE000 | ((uint32_t)-(int32_t)(n + 2) & 0x7FF);
+}
+
+//Random ARM data processing, multiply, load/store, block transfer and branch instructions without
+//PSR transfers, BX or PC writes, ends with a branch back to the start
+static void ArmProgram()
+{
+  uint32_t *code = (uint32_t *)program;
+  uint32_t n = 0;
+
+  while(n < ARM_OPS)
+  {
+    if(Random() % 24 == 0)
+    {
+      n = ArmSelfModify(code, n);
+      continue;
+    }
+
+    uint32_t i = Random();
+    uint32_t type = (i >> 25) & 7;
+
+    if(type >= 6) continue;
+    if((i >> 28) == 15) i = (i & 0x0FFFFFFF) | 0xE0000000;
+    if(((i >> 12) & 0xF) == 15) i &= ~0x1000U;
+    if(((i >> 16) & 0xF) == 15) i &= ~0x10000U;
+    if(type == 4) i &= ~0x8000U;
+
+    if(type == 5)
+    {
+      int32_t offSet = (int32_t)(Random() % 64) - 24;
+      if(n < 30 && offSet < 0) offSet = -offSet;
+      i = (i & 0xFE000000) | ((uint32_t)offSet & 0xFFFFFF);
+    }
+
+    //MRS, MSR and BX
+    if(type <= 1 && ((i >> 23) & 3) == 2 && ((i >> 20) & 1) == 0 && !(type == 0 && (i & 0x90) == 0x90)) continue;
+
+    code[n++] = i;
+  }
+
+  code[n] = 0xEA000000 | ((uint32_t)-(int32_t)(n + 2) & 0xFFFFFF);
+}
+
+//A loop of all four pairs, Second lists the address of each pair's second half
+static const uint16_t PairLoop[] =
+{
+  0x2000,         //00 mov r0, #0
+  0x3001,         //02 add r0, #1
+  0x2403, 0x0625, //04 mov r4, #3; lsl r5, r4, #24
+  0xF000, 0xF807, //08 bl 1A
+  0x4B04, 0x4718, //0C ldr r3, [pc, #10h]; bx r3
+  0x4288, 0xD3F6, //10 cmp r0, r1; bcc 02
+  0x2880, 0xD1F4, //14 cmp r0, #80h; bne 02
+  0xE7F2,         //18 b 00
+  0x3101,         //1A add r1, #1
+  0x4770,         //1C bx lr
+  0x46C0,         //1E nop
+  0x0011, 0x0300  //20 .word 3000011h
+};
+
+static const uint32_t PairSecond[FUSE_MOV_LSL + 1] = { 0, 0x0A, 0x12, 0x0E, 0x06 };
+static const uint32_t PairSecondCmpImm = 0x16;
+
+//One to three instructions followed by B ., with r0 and r1 set to rn, r2 to rm
+//and r3 to rs. r0 and NZCV are checked after the last slice. Expected values are worked out
+//from the ARM7TDMI manual, not by running either core.
+struct EngineVector
+{
+  uint32_t code[3];
+  uint32_t rn;
+  uint32_t rm;
+  uint32_t rs;
+  uint8_t nzcv;
+  uint32_t result;
+  uint8_t nzcvResult;
+};
+
+//Carry in to ADC, SBC and RSC, shifts by #0 (LSR and ASR #32, ROR is RRX), shifts by register
+//by 0, 32 and more, and rotated immediates
+static const EngineVector ArmVectors[] =
+{
+  {{0xE0B10002}, 0x00000000, 0x00000000, 0x00000000, 0x5, 0x00000000, 0x4}, //adcs r0, r1, r2
+  {{0xE0B10002}, 0x00000000, 0x00000000, 0x00000000, 0x7, 0x00000001, 0x0}, //adcs r0, r1, r2
+  {{0xE0B10002}, 0xFFFFFFFF, 0x00000000, 0x00000000, 0x8, 0xFFFFFFFF, 0x8}, //adcs r0, r1, r2
+  {{0xE0B10002}, 0xFFFFFFFF, 0x00000000, 0x00000000, 0xA, 0x00000000, 0x6}, //adcs r0, r1, r2
+  {{0xE0B10002}, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x5, 0xFFFFFFFE, 0xA}, //adcs r0, r1, r2
+  {{0xE0B10002}, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x7, 0xFFFFFFFF, 0xA}, //adcs r0, r1, r2
+  {{0xE0B10002}, 0x7FFFFFFF, 0x00000000, 0x00000000, 0x8, 0x7FFFFFFF, 0x0}, //adcs r0, r1, r2
+  {{0xE0B10002}, 0x7FFFFFFF, 0x00000000, 0x00000000, 0xA, 0x80000000, 0x9}, //adcs r0, r1, r2
+  {{0xE0B10002}, 0x80000000, 0x00000000, 0x00000000, 0x5, 0x80000000, 0x8}, //adcs r0, r1, r2
+  {{0xE0B10002}, 0x80000000, 0x00000000, 0x00000000, 0x7, 0x80000001, 0x8}, //adcs r0, r1, r2
+  {{0xE0B10002}, 0x80000000, 0x80000000, 0x00000000, 0x5, 0x00000000, 0x7}, //adcs r0, r1, r2
+  {{0xE0B10002}, 0x80000000, 0x80000000, 0x00000000, 0x7, 0x00000001, 0x3}, //adcs r0, r1, r2
+  {{0xE0B10002}, 0x00000005, 0x00000005, 0x00000000, 0x5, 0x0000000A, 0x0}, //adcs r0, r1, r2
+  {{0xE0B10002}, 0x00000005, 0x00000005, 0x00000000, 0x7, 0x0000000B, 0x0}, //adcs r0, r1, r2
+  {{0xE0B10002}, 0x00000000, 0x00000001, 0x00000000, 0x8, 0x00000001, 0x0}, //adcs r0, r1, r2
+  {{0xE0B10002}, 0x00000000, 0x00000001, 0x00000000, 0xA, 0x00000002, 0x0}, //adcs r0, r1, r2
+  {{0xE0A10002}, 0xFFFFFFFF, 0x00000001, 0x00000000, 0x2, 0x00000001, 0x2}, //adc r0, r1, r2
+  {{0xE0D10002}, 0x00000000, 0x00000000, 0x00000000, 0x5, 0xFFFFFFFF, 0x8}, //sbcs r0, r1, r2
+  {{0xE0D10002}, 0x00000000, 0x00000000, 0x00000000, 0x7, 0x00000000, 0x6}, //sbcs r0, r1, r2
+  {{0xE0D10002}, 0xFFFFFFFF, 0x00000000, 0x00000000, 0x8, 0xFFFFFFFE, 0xA}, //sbcs r0, r1, r2
+  {{0xE0D10002}, 0xFFFFFFFF, 0x00000000, 0x00000000, 0xA, 0xFFFFFFFF, 0xA}, //sbcs r0, r1, r2
+  {{0xE0D10002}, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x5, 0xFFFFFFFF, 0x8}, //sbcs r0, r1, r2
+  {{0xE0D10002}, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x7, 0x00000000, 0x6}, //sbcs r0, r1, r2
+  {{0xE0D10002}, 0x7FFFFFFF, 0x00000000, 0x00000000, 0x8, 0x7FFFFFFE, 0x2}, //sbcs r0, r1, r2
+  {{0xE0D10002}, 0x7FFFFFFF, 0x00000000, 0x00000000, 0xA, 0x7FFFFFFF, 0x2}, //sbcs r0, r1, r2
+  {{0xE0D10002}, 0x80000000, 0x00000000, 0x00000000, 0x5, 0x7FFFFFFF, 0x3}, //sbcs r0, r1, r2
+  {{0xE0D10002}, 0x80000000, 0x00000000, 0x00000000, 0x7, 0x80000000, 0xA}, //sbcs r0, r1, r2
+  {{0xE0D10002}, 0x80000000, 0x80000000, 0x00000000, 0x5, 0xFFFFFFFF, 0x8}, //sbcs r0, r1, r2
+  {{0xE0D10002}, 0x80000000, 0x80000000, 0x00000000, 0x7, 0x00000000, 0x6}, //sbcs r0, r1, r2
+  {{0xE0D10002}, 0x00000005, 0x00000005, 0x00000000, 0x5, 0xFFFFFFFF, 0x8}, //sbcs r0, r1, r2
+  {{0xE0D10002}, 0x00000005, 0x00000005, 0x00000000, 0x7, 0x00000000, 0x6}, //sbcs r0, r1, r2
+  {{0xE0D10002}, 0x00000000, 0x00000001, 0x00000000, 0x8, 0xFFFFFFFE, 0x8}, //sbcs r0, r1, r2
+  {{0xE0D10002}, 0x00000000, 0x00000001, 0x00000000, 0xA, 0xFFFFFFFF, 0x8}, //sbcs r0, r1, r2
+  {{0xE0C10002}, 0xFFFFFFFF, 0x00000001, 0x00000000, 0x2, 0xFFFFFFFE, 0x2}, //sbc r0, r1, r2
+  {{0xE0F10002}, 0x00000000, 0x00000000, 0x00000000, 0x5, 0xFFFFFFFF, 0x8}, //rscs r0, r1, r2
+  {{0xE0F10002}, 0x00000000, 0x00000000, 0x00000000, 0x7, 0x00000000, 0x6}, //rscs r0, r1, r2
+  {{0xE0F10002}, 0xFFFFFFFF, 0x00000000, 0x00000000, 0x8, 0x00000000, 0x4}, //rscs r0, r1, r2
+  {{0xE0F10002}, 0xFFFFFFFF, 0x00000000, 0x00000000, 0xA, 0x00000001, 0x0}, //rscs r0, r1, r2
+  {{0xE0F10002}, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x5, 0xFFFFFFFF, 0x8}, //rscs r0, r1, r2
+  {{0xE0F10002}, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x7, 0x00000000, 0x6}, //rscs r0, r1, r2
+  {{0xE0F10002}, 0x7FFFFFFF, 0x00000000, 0x00000000, 0x8, 0x80000000, 0x8}, //rscs r0, r1, r2
+  {{0xE0F10002}, 0x7FFFFFFF, 0x00000000, 0x00000000, 0xA, 0x80000001, 0x8}, //rscs r0, r1, r2
+  {{0xE0F10002}, 0x80000000, 0x00000000, 0x00000000, 0x5, 0x7FFFFFFF, 0x0}, //rscs r0, r1, r2
+  {{0xE0F10002}, 0x80000000, 0x00000000, 0x00000000, 0x7, 0x80000000, 0x9}, //rscs r0, r1, r2
+  {{0xE0F10002}, 0x80000000, 0x80000000, 0x00000000, 0x5, 0xFFFFFFFF, 0x8}, //rscs r0, r1, r2
+  {{0xE0F10002}, 0x80000000, 0x80000000, 0x00000000, 0x7, 0x00000000, 0x6}, //rscs r0, r1, r2
+  {{0xE0F10002}, 0x00000005, 0x00000005, 0x00000000, 0x5, 0xFFFFFFFF, 0x8}, //rscs r0, r1, r2
+  {{0xE0F10002}, 0x00000005, 0x00000005, 0x00000000, 0x7, 0x00000000, 0x6}, //rscs r0, r1, r2
+  {{0xE0F10002}, 0x00000000, 0x00000001, 0x00000000, 0x8, 0x00000000, 0x6}, //rscs r0, r1, r2
+  {{0xE0F10002}, 0x00000000, 0x00000001, 0x00000000, 0xA, 0x00000001, 0x2}, //rscs r0, r1, r2
+  {{0xE0E10002}, 0xFFFFFFFF, 0x00000001, 0x00000000, 0x2, 0x00000002, 0x2}, //rsc r0, r1, r2
+  {{0xE1B00002}, 0x00000000, 0x80000001, 0x00000000, 0x1, 0x80000001, 0x9}, //movs r0, r2, lsl #0
+  {{0xE1B00002}, 0x00000000, 0x80000001, 0x00000000, 0x3, 0x80000001, 0xB}, //movs r0, r2, lsl #0
+  {{0xE1B00002}, 0x00000000, 0x7FFFFFFE, 0x00000000, 0x1, 0x7FFFFFFE, 0x1}, //movs r0, r2, lsl #0
+  {{0xE1B00002}, 0x00000000, 0x7FFFFFFE, 0x00000000, 0x3, 0x7FFFFFFE, 0x3}, //movs r0, r2, lsl #0
+  {{0xE1B00002}, 0x00000000, 0x00000000, 0x00000000, 0x1, 0x00000000, 0x5}, //movs r0, r2, lsl #0
+  {{0xE1B00002}, 0x00000000, 0x00000000, 0x00000000, 0x3, 0x00000000, 0x7}, //movs r0, r2, lsl #0
+  {{0xE1B00082}, 0x00000000, 0xC0000003, 0x00000000, 0x0, 0x80000006, 0xA}, //movs r0, r2, lsl #1
+  {{0xE1B00F82}, 0x00000000, 0xC0000003, 0x00000000, 0x0, 0x80000000, 0xA}, //movs r0, r2, lsl #31
+  {{0xE1B00022}, 0x00000000, 0x80000001, 0x00000000, 0x1, 0x00000000, 0x7}, //movs r0, r2, lsr #0
+  {{0xE1B00022}, 0x00000000, 0x80000001, 0x00000000, 0x3, 0x00000000, 0x7}, //movs r0, r2, lsr #0
+  {{0xE1B00022}, 0x00000000, 0x7FFFFFFE, 0x00000000, 0x1, 0x00000000, 0x5}, //movs r0, r2, lsr #0
+  {{0xE1B00022}, 0x00000000, 0x7FFFFFFE, 0x00000000, 0x3, 0x00000000, 0x5}, //movs r0, r2, lsr #0
+  {{0xE1B00022}, 0x00000000, 0x00000000, 0x00000000, 0x1, 0x00000000, 0x5}, //movs r0, r2, lsr #0
+  {{0xE1B00022}, 0x00000000, 0x00000000, 0x00000000, 0x3, 0x00000000, 0x5}, //movs r0, r2, lsr #0
+  {{0xE1B000A2}, 0x00000000, 0xC0000003, 0x00000000, 0x0, 0x60000001, 0x2}, //movs r0, r2, lsr #1
+  {{0xE1B00FA2}, 0x00000000, 0xC0000003, 0x00000000, 0x0, 0x00000001, 0x2}, //movs r0, r2, lsr #31
+  {{0xE1B00042}, 0x00000000, 0x80000001, 0x00000000, 0x1, 0xFFFFFFFF, 0xB}, //movs r0, r2, asr #0
+  {{0xE1B00042}, 0x00000000, 0x80000001, 0x00000000, 0x3, 0xFFFFFFFF, 0xB}, //movs r0, r2, asr #0
+  {{0xE1B00042}, 0x00000000, 0x7FFFFFFE, 0x00000000, 0x1, 0x00000000, 0x5}, //movs r0, r2, asr #0
+  {{0xE1B00042}, 0x00000000, 0x7FFFFFFE, 0x00000000, 0x3, 0x00000000, 0x5}, //movs r0, r2, asr #0
+  {{0xE1B00042}, 0x00000000, 0x00000000, 0x00000000, 0x1, 0x00000000, 0x5}, //movs r0, r2, asr #0
+  {{0xE1B00042}, 0x00000000, 0x00000000, 0x00000000, 0x3, 0x00000000, 0x5}, //movs r0, r2, asr #0
+  {{0xE1B000C2}, 0x00000000, 0xC0000003, 0x00000000, 0x0, 0xE0000001, 0xA}, //movs r0, r2, asr #1
+  {{0xE1B00FC2}, 0x00000000, 0xC0000003, 0x00000000, 0x0, 0xFFFFFFFF, 0xA}, //movs r0, r2, asr #31
+  {{0xE1B00062}, 0x00000000, 0x80000001, 0x00000000, 0x1, 0x40000000, 0x3}, //movs r0, r2, ror #0
+  {{0xE1B00062}, 0x00000000, 0x80000001, 0x00000000, 0x3, 0xC0000000, 0xB}, //movs r0, r2, ror #0
+  {{0xE1B00062}, 0x00000000, 0x7FFFFFFE, 0x00000000, 0x1, 0x3FFFFFFF, 0x1}, //movs r0, r2, ror #0
+  {{0xE1B00062}, 0x00000000, 0x7FFFFFFE, 0x00000000, 0x3, 0xBFFFFFFF, 0x9}, //movs r0, r2, ror #0
+  {{0xE1B00062}, 0x00000000, 0x00000000, 0x00000000, 0x1, 0x00000000, 0x5}, //movs r0, r2, ror #0
+  {{0xE1B00062}, 0x00000000, 0x00000000, 0x00000000, 0x3, 0x80000000, 0x9}, //movs r0, r2, ror #0
+  {{0xE1B000E2}, 0x00000000, 0xC0000003, 0x00000000, 0x0, 0xE0000001, 0xA}, //movs r0, r2, ror #1
+  {{0xE1B00FE2}, 0x00000000, 0xC0000003, 0x00000000, 0x0, 0x80000007, 0xA}, //movs r0, r2, ror #31
+  {{0xE1B00312}, 0x00000000, 0x80000001, 0x00000000, 0x0, 0x80000001, 0x8}, //movs r0, r2, lsl r3
+  {{0xE1B00312}, 0x00000000, 0x40000002, 0x00000000, 0x0, 0x40000002, 0x0}, //movs r0, r2, lsl r3
+  {{0xE1B00312}, 0x00000000, 0x80000001, 0x00000001, 0x2, 0x00000002, 0x2}, //movs r0, r2, lsl r3
+  {{0xE1B00312}, 0x00000000, 0x40000002, 0x00000001, 0x2, 0x80000004, 0x8}, //movs r0, r2, lsl r3
+  {{0xE1B00312}, 0x00000000, 0x80000001, 0x0000001F, 0x2, 0x80000000, 0x8}, //movs r0, r2, lsl r3
+  {{0xE1B00312}, 0x00000000, 0x40000002, 0x0000001F, 0x2, 0x00000000, 0x6}, //movs r0, r2, lsl r3
+  {{0xE1B00312}, 0x00000000, 0x80000001, 0x00000020, 0x0, 0x00000000, 0x6}, //movs r0, r2, lsl r3
+  {{0xE1B00312}, 0x00000000, 0x40000002, 0x00000020, 0x0, 0x00000000, 0x4}, //movs r0, r2, lsl r3
+  {{0xE1B00312}, 0x00000000, 0x80000001, 0x00000021, 0x2, 0x00000000, 0x4}, //movs r0, r2, lsl r3
+  {{0xE1B00312}, 0x00000000, 0x40000002, 0x00000021, 0x2, 0x00000000, 0x4}, //movs r0, r2, lsl r3
+  {{0xE1B00312}, 0x00000000, 0x80000001, 0x00000040, 0x0, 0x00000000, 0x4}, //movs r0, r2, lsl r3
+  {{0xE1B00312}, 0x00000000, 0x40000002, 0x00000040, 0x0, 0x00000000, 0x4}, //movs r0, r2, lsl r3
+  {{0xE1B00312}, 0x00000000, 0x80000001, 0x00000100, 0x0, 0x80000001, 0x8}, //movs r0, r2, lsl r3
+  {{0xE1B00312}, 0x00000000, 0x40000002, 0x00000100, 0x0, 0x40000002, 0x0}, //movs r0, r2, lsl r3
+  {{0xE1B00312}, 0x00000000, 0x80000001, 0x000001FF, 0x2, 0x00000000, 0x4}, //movs r0, r2, lsl r3
+  {{0xE1B00312}, 0x00000000, 0x40000002, 0x000001FF, 0x2, 0x00000000, 0x4}, //movs r0, r2, lsl r3
+  {{0xE1B00332}, 0x00000000, 0x80000001, 0x00000000, 0x0, 0x80000001, 0x8}, //movs r0, r2, lsr r3
+  {{0xE1B00332}, 0x00000000, 0x40000002, 0x00000000, 0x0, 0x40000002, 0x0}, //movs r0, r2, lsr r3
+  {{0xE1B00332}, 0x00000000, 0x80000001, 0x00000001, 0x2, 0x40000000, 0x2}, //movs r0, r2, lsr r3
+  {{0xE1B00332}, 0x00000000, 0x40000002, 0x00000001, 0x2, 0x20000001, 0x0}, //movs r0, r2, lsr r3
+  {{0xE1B00332}, 0x00000000, 0x80000001, 0x0000001F, 0x2, 0x00000001, 0x0}, //movs r0, r2, lsr r3
+  {{0xE1B00332}, 0x00000000, 0x40000002, 0x0000001F, 0x2, 0x00000000, 0x6}, //movs r0, r2, lsr r3
+  {{0xE1B00332}, 0x00000000, 0x80000001, 0x00000020, 0x0, 0x00000000, 0x6}, //movs r0, r2, lsr r3
+  {{0xE1B00332}, 0x00000000, 0x40000002, 0x00000020, 0x0, 0x00000000, 0x4}, //movs r0, r2, lsr r3
+  {{0xE1B00332}, 0x00000000, 0x80000001, 0x00000021, 0x2, 0x00000000, 0x4}, //movs r0, r2, lsr r3
+  {{0xE1B00332}, 0x00000000, 0x40000002, 0x00000021, 0x2, 0x00000000, 0x4}, //movs r0, r2, lsr r3
+  {{0xE1B00332}, 0x00000000, 0x80000001, 0x00000040, 0x0, 0x00000000, 0x4}, //movs r0, r2, lsr r3
+  {{0xE1B00332}, 0x00000000, 0x40000002, 0x00000040, 0x0, 0x00000000, 0x4}, //movs r0, r2, lsr r3
+  {{0xE1B00332}, 0x00000000, 0x80000001, 0x00000100, 0x0, 0x80000001, 0x8}, //movs r0, r2, lsr r3
+  {{0xE1B00332}, 0x00000000, 0x40000002, 0x00000100, 0x0, 0x40000002, 0x0}, //movs r0, r2, lsr r3
+  {{0xE1B00332}, 0x00000000, 0x80000001, 0x000001FF, 0x2, 0x00000000, 0x4}, //movs r0, r2, lsr r3
+  {{0xE1B00332}, 0x00000000, 0x40000002, 0x000001FF, 0x2, 0x00000000, 0x4}, //movs r0, r2, lsr r3
+  {{0xE1B00352}, 0x00000000, 0x80000001, 0x00000000, 0x0, 0x80000001, 0x8}, //movs r0, r2, asr r3
+  {{0xE1B00352}, 0x00000000, 0x40000002, 0x00000000, 0x0, 0x40000002, 0x0}, //movs r0, r2, asr r3
+  {{0xE1B00352}, 0x00000000, 0x80000001, 0x00000001, 0x2, 0xC0000000, 0xA}, //movs r0, r2, asr r3
+  {{0xE1B00352}, 0x00000000, 0x40000002, 0x00000001, 0x2, 0x20000001, 0x0}, //movs r0, r2, asr r3
+  {{0xE1B00352}, 0x00000000, 0x80000001, 0x0000001F, 0x2, 0xFFFFFFFF, 0x8}, //movs r0, r2, asr r3
+  {{0xE1B00352}, 0x00000000, 0x40000002, 0x0000001F, 0x2, 0x00000000, 0x6}, //movs r0, r2, asr r3
+  {{0xE1B00352}, 0x00000000, 0x80000001, 0x00000020, 0x0, 0xFFFFFFFF, 0xA}, //movs r0, r2, asr r3
+  {{0xE1B00352}, 0x00000000, 0x40000002, 0x00000020, 0x0, 0x00000000, 0x4}, //movs r0, r2, asr r3
+  {{0xE1B00352}, 0x00000000, 0x80000001, 0x00000021, 0x2, 0xFFFFFFFF, 0xA}, //movs r0, r2, asr r3
+  {{0xE1B00352}, 0x00000000, 0x40000002, 0x00000021, 0x2, 0x00000000, 0x4}, //movs r0, r2, asr r3
+  {{0xE1B00352}, 0x00000000, 0x80000001, 0x00000040, 0x0, 0xFFFFFFFF, 0xA}, //movs r0, r2, asr r3
+  {{0xE1B00352}, 0x00000000, 0x40000002, 0x00000040, 0x0, 0x00000000, 0x4}, //movs r0, r2, asr r3
+  {{0xE1B00352}, 0x00000000, 0x80000001, 0x00000100, 0x0, 0x80000001, 0x8}, //movs r0, r2, asr r3
+  {{0xE1B00352}, 0x00000000, 0x40000002, 0x00000100, 0x0, 0x40000002, 0x0}, //movs r0, r2, asr r3
+  {{0xE1B00352}, 0x00000000, 0x80000001, 0x000001FF, 0x2, 0xFFFFFFFF, 0xA}, //movs r0, r2, asr r3
+  {{0xE1B00352}, 0x00000000, 0x40000002, 0x000001FF, 0x2, 0x00000000, 0x4}, //movs r0, r2, asr r3
+  {{0xE1B00372}, 0x00000000, 0x80000001, 0x00000000, 0x0, 0x80000001, 0x8}, //movs r0, r2, ror r3
+  {{0xE1B00372}, 0x00000000, 0x40000002, 0x00000000, 0x0, 0x40000002, 0x0}, //movs r0, r2, ror r3
+  {{0xE1B00372}, 0x00000000, 0x80000001, 0x00000001, 0x2, 0xC0000000, 0xA}, //movs r0, r2, ror r3
+  {{0xE1B00372}, 0x00000000, 0x40000002, 0x00000001, 0x2, 0x20000001, 0x0}, //movs r0, r2, ror r3
+  {{0xE1B00372}, 0x00000000, 0x80000001, 0x0000001F, 0x2, 0x00000003, 0x0}, //movs r0, r2, ror r3
+  {{0xE1B00372}, 0x00000000, 0x40000002, 0x0000001F, 0x2, 0x80000004, 0xA}, //movs r0, r2, ror r3
+  {{0xE1B00372}, 0x00000000, 0x80000001, 0x00000020, 0x0, 0x80000001, 0xA}, //movs r0, r2, ror r3
+  {{0xE1B00372}, 0x00000000, 0x40000002, 0x00000020, 0x0, 0x40000002, 0x0}, //movs r0, r2, ror r3
+  {{0xE1B00372}, 0x00000000, 0x80000001, 0x00000021, 0x2, 0xC0000000, 0xA}, //movs r0, r2, ror r3
+  {{0xE1B00372}, 0x00000000, 0x40000002, 0x00000021, 0x2, 0x20000001, 0x0}, //movs r0, r2, ror r3
+  {{0xE1B00372}, 0x00000000, 0x80000001, 0x00000040, 0x0, 0x80000001, 0xA}, //movs r0, r2, ror r3
+  {{0xE1B00372}, 0x00000000, 0x40000002, 0x00000040, 0x0, 0x40000002, 0x0}, //movs r0, r2, ror r3
+  {{0xE1B00372}, 0x00000000, 0x80000001, 0x00000100, 0x0, 0x80000001, 0x8}, //movs r0, r2, ror r3
+  {{0xE1B00372}, 0x00000000, 0x40000002, 0x00000100, 0x0, 0x40000002, 0x0}, //movs r0, r2, ror r3
+  {{0xE1B00372}, 0x00000000, 0x80000001, 0x000001FF, 0x2, 0x00000003, 0x0}, //movs r0, r2, ror r3
+  {{0xE1B00372}, 0x00000000, 0x40000002, 0x000001FF, 0x2, 0x80000004, 0xA}, //movs r0, r2, ror r3
+  {{0xE0310332}, 0x00000001, 0x80000001, 0x00000020, 0x1, 0x00000001, 0x3}, //eors r0, r1, r2, lsr r3
+  {{0xE0910312}, 0x80000000, 0x80000001, 0x00000021, 0x0, 0x80000000, 0x8}, //adds r0, r1, r2, lsl r3
+  {{0xE3B00102}, 0x00000000, 0x00000000, 0x00000000, 0x0, 0x80000000, 0xA}, //movs r0, #80000000h
+  {{0xE3B000FF}, 0x00000000, 0x00000000, 0x00000000, 0x2, 0x000000FF, 0x2}, //movs r0, #FFh
+  {{0xE3B00000}, 0x00000000, 0x00000000, 0x00000000, 0x3, 0x00000000, 0x7}, //movs r0, #0
+};
+
+//MSR and MRS round trips, MRS after flags left pending by ADDS and CMP, and MSR over pending
+//flags supplying the carry into ADC
+static const EngineVector ArmFlagVectors[] =
+{
+  {{0xE128F001, 0xE10F0000}, 0x00000000, 0x00000000, 0x00000000, 0xF, 0x0000001F, 0x0}, //msr cpsr_f, r1; mrs r0, cpsr
+  {{0xE128F001, 0xE10F0000}, 0xF0000000, 0x00000000, 0x00000000, 0x0, 0xF000001F, 0xF}, //msr cpsr_f, r1; mrs r0, cpsr
+  {{0xE128F001, 0xE10F0000}, 0xA5A5A5A5, 0x00000000, 0x00000000, 0x0, 0xA000001F, 0xA}, //msr cpsr_f, r1; mrs r0, cpsr
+  {{0xE128F001, 0xE10F0000}, 0x5FFFFFFF, 0x00000000, 0x00000000, 0x0, 0x5000001F, 0x5}, //msr cpsr_f, r1; mrs r0, cpsr
+  {{0xE128F001, 0xE10F0000}, 0xFFFFFFFF, 0x00000000, 0x00000000, 0x0, 0xF000001F, 0xF}, //msr cpsr_f, r1; mrs r0, cpsr
+  {{0xE328F205, 0xE10F0000}, 0x00000000, 0x00000000, 0x00000000, 0xA, 0x5000001F, 0x5}, //msr cpsr_f, #50000000h; mrs r0, cpsr
+  {{0xE328F20A, 0xE10F0000}, 0x00000000, 0x00000000, 0x00000000, 0x5, 0xA000001F, 0xA}, //msr cpsr_f, #A0000000h; mrs r0, cpsr
+  {{0xE328F20F, 0xE10F0000}, 0x00000000, 0x00000000, 0x00000000, 0x0, 0xF000001F, 0xF}, //msr cpsr_f, #F0000000h; mrs r0, cpsr
+  {{0xE328F000, 0xE10F0000}, 0x00000000, 0x00000000, 0x00000000, 0xF, 0x0000001F, 0x0}, //msr cpsr_f, #0h; mrs r0, cpsr
+  {{0xE0915002, 0xE10F0000}, 0x7FFFFFFF, 0x00000001, 0x00000000, 0x0, 0x9000001F, 0x9}, //adds r5, r1, r2; mrs r0, cpsr
+  {{0xE1510002, 0xE10F0000}, 0x7FFFFFFF, 0x00000001, 0x00000000, 0xF, 0x2000001F, 0x2}, //cmp r1, r2; mrs r0, cpsr
+  {{0xE0915002, 0xE10F0000}, 0xFFFFFFFF, 0x00000001, 0x00000000, 0x0, 0x6000001F, 0x6}, //adds r5, r1, r2; mrs r0, cpsr
+  {{0xE1510002, 0xE10F0000}, 0xFFFFFFFF, 0x00000001, 0x00000000, 0xF, 0xA000001F, 0xA}, //cmp r1, r2; mrs r0, cpsr
+  {{0xE0915002, 0xE10F0000}, 0x00000000, 0x00000000, 0x00000000, 0x0, 0x4000001F, 0x4}, //adds r5, r1, r2; mrs r0, cpsr
+  {{0xE1510002, 0xE10F0000}, 0x00000000, 0x00000000, 0x00000000, 0xF, 0x6000001F, 0x6}, //cmp r1, r2; mrs r0, cpsr
+  {{0xE0915002, 0xE10F0000}, 0x80000000, 0x80000000, 0x00000000, 0x0, 0x7000001F, 0x7}, //adds r5, r1, r2; mrs r0, cpsr
+  {{0xE1510002, 0xE10F0000}, 0x80000000, 0x80000000, 0x00000000, 0xF, 0x6000001F, 0x6}, //cmp r1, r2; mrs r0, cpsr
+  {{0xE1510002, 0xE128F001, 0xE0B20003}, 0x20000000, 0x00000005, 0xFFFFFFFF, 0x0, 0x00000005, 0x2}, //cmp r1, r2; msr cpsr_f, r1; adcs r0, r2, r3
+  {{0xE1510002, 0xE128F001, 0xE0B20003}, 0x00000000, 0x00000005, 0xFFFFFFFF, 0x0, 0x00000004, 0x2}, //cmp r1, r2; msr cpsr_f, r1; adcs r0, r2, r3
+  {{0xE1510002, 0xE0B20001}, 0x00000001, 0x00000002, 0x00000000, 0x0, 0x00000003, 0x0}, //cmp r1, r2; adcs r0, r2, r1
+  {{0xE1510002, 0xE0D20001}, 0x00000001, 0x00000002, 0x00000000, 0x0, 0x00000000, 0x6}, //cmp r1, r2; sbcs r0, r2, r1
+  {{0xE1510002, 0xE0B20001}, 0x00000002, 0x00000001, 0x00000000, 0x0, 0x00000004, 0x0}, //cmp r1, r2; adcs r0, r2, r1
+  {{0xE1510002, 0xE0D20001}, 0x00000002, 0x00000001, 0x00000000, 0x0, 0xFFFFFFFF, 0x8}, //cmp r1, r2; sbcs r0, r2, r1
+  {{0xE1510002, 0xE0B20001}, 0x80000000, 0x00000001, 0x00000000, 0x0, 0x80000002, 0x8}, //cmp r1, r2; adcs r0, r2, r1
+  {{0xE1510002, 0xE0D20001}, 0x80000000, 0x00000001, 0x00000000, 0x0, 0x80000001, 0x9}, //cmp r1, r2; sbcs r0, r2, r1
+};
+
+//The same carry in and shift cases for Thumb, where rd is also the first operand
+static const EngineVector ThumbVectors[] =
+{
+  {{0x4150}, 0x00000000, 0x00000000, 0x00000000, 0x1, 0x00000000, 0x4}, //adc r0, r2
+  {{0x4190}, 0x00000000, 0x00000000, 0x00000000, 0x1, 0xFFFFFFFF, 0x8}, //sbc r0, r2
+  {{0x4150}, 0x00000000, 0x00000000, 0x00000000, 0x3, 0x00000001, 0x0}, //adc r0, r2
+  {{0x4190}, 0x00000000, 0x00000000, 0x00000000, 0x3, 0x00000000, 0x6}, //sbc r0, r2
+  {{0x4150}, 0xFFFFFFFF, 0x00000000, 0x00000000, 0x1, 0xFFFFFFFF, 0x8}, //adc r0, r2
+  {{0x4190}, 0xFFFFFFFF, 0x00000000, 0x00000000, 0x1, 0xFFFFFFFE, 0xA}, //sbc r0, r2
+  {{0x4150}, 0xFFFFFFFF, 0x00000000, 0x00000000, 0x3, 0x00000000, 0x6}, //adc r0, r2
+  {{0x4190}, 0xFFFFFFFF, 0x00000000, 0x00000000, 0x3, 0xFFFFFFFF, 0xA}, //sbc r0, r2
+  {{0x4150}, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x1, 0xFFFFFFFE, 0xA}, //adc r0, r2
+  {{0x4190}, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x1, 0xFFFFFFFF, 0x8}, //sbc r0, r2
+  {{0x4150}, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x3, 0xFFFFFFFF, 0xA}, //adc r0, r2
+  {{0x4190}, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x3, 0x00000000, 0x6}, //sbc r0, r2
+  {{0x4150}, 0x7FFFFFFF, 0x00000000, 0x00000000, 0x1, 0x7FFFFFFF, 0x0}, //adc r0, r2
+  {{0x4190}, 0x7FFFFFFF, 0x00000000, 0x00000000, 0x1, 0x7FFFFFFE, 0x2}, //sbc r0, r2
+  {{0x4150}, 0x7FFFFFFF, 0x00000000, 0x00000000, 0x3, 0x80000000, 0x9}, //adc r0, r2
+  {{0x4190}, 0x7FFFFFFF, 0x00000000, 0x00000000, 0x3, 0x7FFFFFFF, 0x2}, //sbc r0, r2
+  {{0x4150}, 0x80000000, 0x00000000, 0x00000000, 0x1, 0x80000000, 0x8}, //adc r0, r2
+  {{0x4190}, 0x80000000, 0x00000000, 0x00000000, 0x1, 0x7FFFFFFF, 0x3}, //sbc r0, r2
+  {{0x4150}, 0x80000000, 0x00000000, 0x00000000, 0x3, 0x80000001, 0x8}, //adc r0, r2
+  {{0x4190}, 0x80000000, 0x00000000, 0x00000000, 0x3, 0x80000000, 0xA}, //sbc r0, r2
+  {{0x4150}, 0x80000000, 0x80000000, 0x00000000, 0x1, 0x00000000, 0x7}, //adc r0, r2
+  {{0x4190}, 0x80000000, 0x80000000, 0x00000000, 0x1, 0xFFFFFFFF, 0x8}, //sbc r0, r2
+  {{0x4150}, 0x80000000, 0x80000000, 0x00000000, 0x3, 0x00000001, 0x3}, //adc r0, r2
+  {{0x4190}, 0x80000000, 0x80000000, 0x00000000, 0x3, 0x00000000, 0x6}, //sbc r0, r2
+  {{0x4150}, 0x00000005, 0x00000005, 0x00000000, 0x1, 0x0000000A, 0x0}, //adc r0, r2
+  {{0x4190}, 0x00000005, 0x00000005, 0x00000000, 0x1, 0xFFFFFFFF, 0x8}, //sbc r0, r2
+  {{0x4150}, 0x00000005, 0x00000005, 0x00000000, 0x3, 0x0000000B, 0x0}, //adc r0, r2
+  {{0x4190}, 0x00000005, 0x00000005, 0x00000000, 0x3, 0x00000000, 0x6}, //sbc r0, r2
+  {{0x4150}, 0x00000000, 0x00000001, 0x00000000, 0x1, 0x00000001, 0x0}, //adc r0, r2
+  {{0x4190}, 0x00000000, 0x00000001, 0x00000000, 0x1, 0xFFFFFFFE, 0x8}, //sbc r0, r2
+  {{0x4150}, 0x00000000, 0x00000001, 0x00000000, 0x3, 0x00000002, 0x0}, //adc r0, r2
+  {{0x4190}, 0x00000000, 0x00000001, 0x00000000, 0x3, 0xFFFFFFFF, 0x8}, //sbc r0, r2
+  {{0x4250}, 0x00000000, 0x00000000, 0x00000000, 0x0, 0x00000000, 0x6}, //neg r0, r2
+  {{0x4250}, 0x00000000, 0x00000001, 0x00000000, 0x0, 0xFFFFFFFF, 0x8}, //neg r0, r2
+  {{0x4250}, 0x00000000, 0x80000000, 0x00000000, 0x0, 0x80000000, 0x9}, //neg r0, r2
+  {{0x4250}, 0x00000000, 0xFFFFFFFF, 0x00000000, 0x0, 0x00000001, 0x0}, //neg r0, r2
+  {{0x4098}, 0x80000001, 0x00000000, 0x00000000, 0x1, 0x80000001, 0x9}, //lsl r0, r3
+  {{0x4098}, 0x40000002, 0x00000000, 0x00000000, 0x1, 0x40000002, 0x1}, //lsl r0, r3
+  {{0x4098}, 0x80000001, 0x00000000, 0x00000001, 0x3, 0x00000002, 0x3}, //lsl r0, r3
+  {{0x4098}, 0x40000002, 0x00000000, 0x00000001, 0x3, 0x80000004, 0x9}, //lsl r0, r3
+  {{0x4098}, 0x80000001, 0x00000000, 0x0000001F, 0x3, 0x80000000, 0x9}, //lsl r0, r3
+  {{0x4098}, 0x40000002, 0x00000000, 0x0000001F, 0x3, 0x00000000, 0x7}, //lsl r0, r3
+  {{0x4098}, 0x80000001, 0x00000000, 0x00000020, 0x1, 0x00000000, 0x7}, //lsl r0, r3
+  {{0x4098}, 0x40000002, 0x00000000, 0x00000020, 0x1, 0x00000000, 0x5}, //lsl r0, r3
+  {{0x4098}, 0x80000001, 0x00000000, 0x00000021, 0x3, 0x00000000, 0x5}, //lsl r0, r3
+  {{0x4098}, 0x40000002, 0x00000000, 0x00000021, 0x3, 0x00000000, 0x5}, //lsl r0, r3
+  {{0x4098}, 0x80000001, 0x00000000, 0x00000100, 0x1, 0x80000001, 0x9}, //lsl r0, r3
+  {{0x4098}, 0x40000002, 0x00000000, 0x00000100, 0x1, 0x40000002, 0x1}, //lsl r0, r3
+  {{0x40D8}, 0x80000001, 0x00000000, 0x00000000, 0x1, 0x80000001, 0x9}, //lsr r0, r3
+  {{0x40D8}, 0x40000002, 0x00000000, 0x00000000, 0x1, 0x40000002, 0x1}, //lsr r0, r3
+  {{0x40D8}, 0x80000001, 0x00000000, 0x00000001, 0x3, 0x40000000, 0x3}, //lsr r0, r3
+  {{0x40D8}, 0x40000002, 0x00000000, 0x00000001, 0x3, 0x20000001, 0x1}, //lsr r0, r3
+  {{0x40D8}, 0x80000001, 0x00000000, 0x0000001F, 0x3, 0x00000001, 0x1}, //lsr r0, r3
+  {{0x40D8}, 0x40000002, 0x00000000, 0x0000001F, 0x3, 0x00000000, 0x7}, //lsr r0, r3
+  {{0x40D8}, 0x80000001, 0x00000000, 0x00000020, 0x1, 0x00000000, 0x7}, //lsr r0, r3
+  {{0x40D8}, 0x40000002, 0x00000000, 0x00000020, 0x1, 0x00000000, 0x5}, //lsr r0, r3
+  {{0x40D8}, 0x80000001, 0x00000000, 0x00000021, 0x3, 0x00000000, 0x5}, //lsr r0, r3
+  {{0x40D8}, 0x40000002, 0x00000000, 0x00000021, 0x3, 0x00000000, 0x5}, //lsr r0, r3
+  {{0x40D8}, 0x80000001, 0x00000000, 0x00000100, 0x1, 0x80000001, 0x9}, //lsr r0, r3
+  {{0x40D8}, 0x40000002, 0x00000000, 0x00000100, 0x1, 0x40000002, 0x1}, //lsr r0, r3
+  {{0x4118}, 0x80000001, 0x00000000, 0x00000000, 0x1, 0x80000001, 0x9}, //asr r0, r3
+  {{0x4118}, 0x40000002, 0x00000000, 0x00000000, 0x1, 0x40000002, 0x1}, //asr r0, r3
+  {{0x4118}, 0x80000001, 0x00000000, 0x00000001, 0x3, 0xC0000000, 0xB}, //asr r0, r3
+  {{0x4118}, 0x40000002, 0x00000000, 0x00000001, 0x3, 0x20000001, 0x1}, //asr r0, r3
+  {{0x4118}, 0x80000001, 0x00000000, 0x0000001F, 0x3, 0xFFFFFFFF, 0x9}, //asr r0, r3
+  {{0x4118}, 0x40000002, 0x00000000, 0x0000001F, 0x3, 0x00000000, 0x7}, //asr r0, r3
+  {{0x4118}, 0x80000001, 0x00000000, 0x00000020, 0x1, 0xFFFFFFFF, 0xB}, //asr r0, r3
+  {{0x4118}, 0x40000002, 0x00000000, 0x00000020, 0x1, 0x00000000, 0x5}, //asr r0, r3
+  {{0x4118}, 0x80000001, 0x00000000, 0x00000021, 0x3, 0xFFFFFFFF, 0xB}, //asr r0, r3
+  {{0x4118}, 0x40000002, 0x00000000, 0x00000021, 0x3, 0x00000000, 0x5}, //asr r0, r3
+  {{0x4118}, 0x80000001, 0x00000000, 0x00000100, 0x1, 0x80000001, 0x9}, //asr r0, r3
+  {{0x4118}, 0x40000002, 0x00000000, 0x00000100, 0x1, 0x40000002, 0x1}, //asr r0, r3
+  {{0x41D8}, 0x80000001, 0x00000000, 0x00000000, 0x1, 0x80000001, 0x9}, //ror r0, r3
+  {{0x41D8}, 0x40000002, 0x00000000, 0x00000000, 0x1, 0x40000002, 0x1}, //ror r0, r3
+  {{0x41D8}, 0x80000001, 0x00000000, 0x00000001, 0x3, 0xC0000000, 0xB}, //ror r0, r3
+  {{0x41D8}, 0x40000002, 0x00000000, 0x00000001, 0x3, 0x20000001, 0x1}, //ror r0, r3
+  {{0x41D8}, 0x80000001, 0x00000000, 0x0000001F, 0x3, 0x00000003, 0x1}, //ror r0, r3
+  {{0x41D8}, 0x40000002, 0x00000000, 0x0000001F, 0x3, 0x80000004, 0xB}, //ror r0, r3
+  {{0x41D8}, 0x80000001, 0x00000000, 0x00000020, 0x1, 0x80000001, 0xB}, //ror r0, r3
+  {{0x41D8}, 0x40000002, 0x00000000, 0x00000020, 0x1, 0x40000002, 0x1}, //ror r0, r3
+  {{0x41D8}, 0x80000001, 0x00000000, 0x00000021, 0x3, 0xC0000000, 0xB}, //ror r0, r3
+  {{0x41D8}, 0x40000002, 0x00000000, 0x00000021, 0x3, 0x20000001, 0x1}, //ror r0, r3
+  {{0x41D8}, 0x80000001, 0x00000000, 0x00000100, 0x1, 0x80000001, 0x9}, //ror r0, r3
+  {{0x41D8}, 0x40000002, 0x00000000, 0x00000100, 0x1, 0x40000002, 0x1}, //ror r0, r3
+  {{0x0010}, 0x00000000, 0x80000001, 0x00000000, 0x1, 0x80000001, 0x9}, //lsl r0, r2, #0
+  {{0x0010}, 0x00000000, 0x80000001, 0x00000000, 0x3, 0x80000001, 0xB}, //lsl r0, r2, #0
+  {{0x0010}, 0x00000000, 0x7FFFFFFE, 0x00000000, 0x1, 0x7FFFFFFE, 0x1}, //lsl r0, r2, #0
+  {{0x0010}, 0x00000000, 0x7FFFFFFE, 0x00000000, 0x3, 0x7FFFFFFE, 0x3}, //lsl r0, r2, #0
+  {{0x0810}, 0x00000000, 0x80000001, 0x00000000, 0x1, 0x00000000, 0x7}, //lsr r0, r2, #0
+  {{0x0810}, 0x00000000, 0x80000001, 0x00000000, 0x3, 0x00000000, 0x7}, //lsr r0, r2, #0
+  {{0x0810}, 0x00000000, 0x7FFFFFFE, 0x00000000, 0x1, 0x00000000, 0x5}, //lsr r0, r2, #0
+  {{0x0810}, 0x00000000, 0x7FFFFFFE, 0x00000000, 0x3, 0x00000000, 0x5}, //lsr r0, r2, #0
+  {{0x1010}, 0x00000000, 0x80000001, 0x00000000, 0x1, 0xFFFFFFFF, 0xB}, //asr r0, r2, #0
+  {{0x1010}, 0x00000000, 0x80000001, 0x00000000, 0x3, 0xFFFFFFFF, 0xB}, //asr r0, r2, #0
+  {{0x1010}, 0x00000000, 0x7FFFFFFE, 0x00000000, 0x1, 0x00000000, 0x5}, //asr r0, r2, #0
+  {{0x1010}, 0x00000000, 0x7FFFFFFE, 0x00000000, 0x3, 0x00000000, 0x5}, //asr r0, r2, #0
+};
+
+static void Capture(EngineState *state, bool thumb)
+{
+  memcpy(state->registers, p.registers, sizeof(state->registers));
+  state->cpsr = p.cpsr;
+  state->cycles = p.Cycles;
+  state->queue = thumb ? thumbCore.instructionQueue : armCore.instructionQueue;
+}
+
+static void Run(EngineRun *run, bool blocks, bool thumb)
+{
+  p = initial;
+  p.Reset(true); //Banked registers and SPSRs live outside Processor
+  memcpy(p.IWRAM, program, sizeof(program));
+  memset(scratch, 0xA5, sizeof(scratch));
+  memcpy(p.registers, initialRegisters, sizeof(initialRegisters));
+  p.cpsr = initialCpsr;
+
+  blockCache.enabled = blocks;
+  blockCache.Invalidate();
+  idleLoop.Begin(0);
+  biosHle.Begin(&p);
+  p.TrackCodeWrites();
+  p.ReloadQueue();
+
+  for(uint32_t i = 0; i < SLICES; i++)
+  {
+    p.Execute(sliceCycles[i]);
+    Capture(&run->slices[i], thumb);
+  }
+
+  memcpy(run->iwram, p.IWRAM, sizeof(run->iwram));
+  memcpy(run->scratch, scratch, sizeof(run->scratch));
+}
+
+//With a file named on the command line, writes a hash of the interpreter run. The core built
+//with THREADED_DISPATCH runs Thumb code the same way whether the block cache is on or not,
+//so make check compares its file with the plain interpreter's.
+static void WriteRun(const char *kind, uint32_t index)
+{
+  if(runsFile == NULL)
+  {
+    return;
+  }
+
+  uint32_t hash = 2166136261U;
+  const uint8_t *bytes = (const uint8_t *)&runs[0];
+
+  for(uint32_t i = 0; i < sizeof(runs[0]); i++)
+  {
+    hash = (hash ^ bytes[i]) * 16777619U;
+  }
+
+  fprintf(runsFile, "%s %u %08X\n", kind, index, hash);
+}
+
+static bool Compare(const char *kind, uint32_t index)
+{
+  WriteRun(kind, index);
+
+  for(uint32_t i = 0; i < SLICES; i++)
+  {
+    const EngineState *a = &runs[0].slices[i];
+    const EngineState *b = &runs[1].slices[i];
+
+    for(uint32_t r = 0; r < 16; r++)
+    {
+      if(a->registers[r] != b->registers[r])
+      {
+        printf("EngineTest: %s %u slice %u r%u %08X != %08X\n", kind, index, i, r, a->registers[r], b->registers[r]);
+        return false;
+      }
+    }
+
+    if(a->cpsr != b->cpsr || a->cycles != b->cycles || a->queue != b->queue)
+    {
+      printf("EngineTest: %s %u slice %u cpsr %08X/%08X cycles %d/%d queue %08X/%08X\n", kind, index, i, a->cpsr, b->cpsr, a->cycles, b->cycles, a->queue, b->queue);
+      return false;
+    }
+  }
+
+  if(memcmp(runs[0].iwram, runs[1].iwram, sizeof(runs[0].iwram)) != 0 || memcmp(runs[0].scratch, runs[1].scratch, sizeof(runs[0].scratch)) != 0)
+  {
+    printf("EngineTest: %s %u memory differs\n", kind, index);
+    return false;
+  }
+
+  return true;
+}
+
+//Interpreter first, then the block cache
+static void Differential(const char *kind, bool thumb, uint32_t programs, uint32_t *hits, uint32_t *invalidations)
+{
+  uint32_t differ = 0;
+
+  for(uint32_t index = 0; index < programs; index++)
+  {
+    seed = index + (thumb ? 0x10000 : 0);
+
+    if(thumb)
+    {
+      ThumbProgram();
+    }
+    else
+    {
+      ArmProgram();
+    }
+
+    for(uint32_t r = 0; r < 15; r++)
+    {
+      initialRegisters[r] = 0x03004000 + (Random() & 0x1FFC);
+    }
+
+    initialRegisters[13] = 0x03007F00;
+    initialRegisters[15] = CODE;
+    initialCpsr = (thumb ? 0x3F : 0x1F) | ((Random() & 0xF) << 28);
+
+    for(uint32_t i = 0; i < SLICES; i++)
+    {
+      sliceCycles[i] = 1 + Random() % SLICE_CYCLES;
+    }
+
+    Run(&runs[0], false, thumb);
+    Run(&runs[1], true, thumb);
+    *hits += blockCache.hits;
+    *invalidations += blockCache.invalidations;
+
+    if(!Compare(thumb ? "random Thumb program" : "random ARM program", index) && ++differ == 5)
+    {
+      break;
+    }
+  }
+
+  Check(kind, differ == 0);
+}
+
+//The pair loop with every slice length from 1 to 48 cycles
+static void PairSlices()
+{
+  uint32_t differ = 0;
+  uint32_t fused = 0;
+  uint32_t splits[FUSE_MOV_LSL + 1] = {};
+
+  memset(program, 0, sizeof(program));
+  memcpy(program, PairLoop, sizeof(PairLoop));
+  memset(initialRegisters, 0, sizeof(initialRegisters));
+  initialRegisters[13] = 0x03007F00;
+  initialRegisters[15] = CODE;
+  initialCpsr = 0x3F;
+
+  for(uint32_t length = 1; length <= 48; length++)
+  {
+    for(uint32_t i = 0; i < SLICES; i++)
+    {
+      sliceCycles[i] = length;
+    }
+
+    Run(&runs[0], false, true);
+    Run(&runs[1], true, true);
+    fused += blockCache.fused;
+
+    if(!Compare("Thumb pair loop, slice length", length))
+    {
+      differ++;
+    }
+
+    //Next instruction is the second half of a pair
+    for(uint32_t i = 0; i < SLICES; i++)
+    {
+      uint32_t next = runs[1].slices[i].registers[15] - 2 - CODE;
+
+      for(uint32_t fuse = FUSE_BL; fuse <= FUSE_MOV_LSL; fuse++)
+      {
+        if(next == PairSecond[fuse] || (fuse == FUSE_CMP_BCC && next == PairSecondCmpImm))
+        {
+          splits[fuse]++;
+        }
+      }
+    }
+  }
+
+  Check("Thumb pair loop", differ == 0);
+#ifndef THREADED_DISPATCH
+  Check("Thumb pairs fused", fused != 0);
+#endif
+  Check("slice ended inside BL", splits[FUSE_BL] != 0);
+  Check("slice ended inside CMP/Bcc", splits[FUSE_CMP_BCC] != 0);
+  Check("slice ended inside LDR/BX", splits[FUSE_LDR_BX] != 0);
+  Check("slice ended inside MOV/LSL", splits[FUSE_MOV_LSL] != 0);
+}
+
+//Each vector through both engines
+static void Vectors(const char *kind, const EngineVector *vectors, uint32_t count, bool thumb)
+{
+  uint32_t wrong = 0;
+
+  for(uint32_t index = 0; index < count; index++)
+  {
+    const EngineVector *v = &vectors[index];
+    uint32_t n = 0;
+
+    memset(program, 0, sizeof(program));
+
+    for(uint32_t i = 0; i < 3 && v->code[i] != 0; i++, n++)
+    {
+      if(thumb)
+      {
+        ((uint16_t *)program)[n] = (uint16_t)v->code[i];
+      }
+      else
+      {
+        ((uint32_t *)program)[n] = v->code[i];
+      }
+    }
+
+    if(thumb)
+    {
+      ((uint16_t *)program)[n] = 0xE7FE;
+    }
+    else
+    {
+      ((uint32_t *)program)[n] = 0xEAFFFFFE;
+    }
+
+    memset(initialRegisters, 0, sizeof(initialRegisters));
+    initialRegisters[0] = v->rn;
+    initialRegisters[1] = v->rn;
+    initialRegisters[2] = v->rm;
+    initialRegisters[3] = v->rs;
+    initialRegisters[13] = 0x03007F00;
+    initialRegisters[15] = CODE;
+    initialCpsr = (thumb ? 0x3F : 0x1F) | (v->nzcv << 28);
+
+    for(uint32_t i = 0; i < SLICES; i++)
+    {
+      sliceCycles[i] = 4;
+    }
+
+    Run(&runs[0], false, thumb);
+    Run(&runs[1], true, thumb);
+
+    if(!Compare(kind, index))
+    {
+      wrong++;
+      continue;
+    }
+
+    const EngineState *last = &runs[0].slices[SLICES - 1];
+
+    if(last->registers[0] != v->result || (last->cpsr >> 28) != v->nzcvResult)
+    {
+      printf("EngineTest: %s %u r0 %08X NZCV %X, expected %08X %X\n", kind, index, last->registers[0], last->cpsr >> 28, v->result, v->nzcvResult);
+      wrong++;
+    }
+  }
+
+  Check(kind, wrong == 0);
+}
+
+//What the ARM7TDMI manual says each condition needs, the cores use ConditionTable
+static bool ConditionPasses(uint32_t condition, uint32_t nzcv)
+{
+  bool n = (nzcv & 0x8) != 0;
+  bool z = (nzcv & 0x4) != 0;
+  bool c = (nzcv & 0x2) != 0;
+  bool v = (nzcv & 0x1) != 0;
+
+  switch(condition)
+  {
+    case COND_EQ: return z;
+    case COND_NE: return !z;
+    case COND_CS: return c;
+    case COND_CC: return !c;
+    case COND_MI: return n;
+    case COND_PL: return !n;
+    case COND_VS: return v;
+    case COND_VC: return !v;
+    case COND_HI: return c && !z;
+    case COND_LS: return !c || z;
+    case COND_GE: return n == v;
+    case COND_LT: return n != v;
+    case COND_GT: return !z && n == v;
+    case COND_LE: return z || n != v;
+    case COND_AL: return true;
+    default: return false;
+  }
+}
+
+//Flags from CMP, CMN or TST r1, r2 with C and V set beforehand
+static uint32_t CompareFlags(uint32_t op, uint32_t a, uint32_t b)
+{
+  uint32_t r;
+  uint32_t c = 1;
+  uint32_t v = 1;
+
+  if(op == 0)
+  {
+    r = a - b;
+    c = a >= b;
+    v = ((a ^ b) & (a ^ r)) >> 31;
+  }
+  else if(op == 1)
+  {
+    r = a + b;
+    c = r < a;
+    v = (~(a ^ b) & (a ^ r)) >> 31;
+  }
+  else
+  {
+    r = a & b;
+  }
+
+  return ((r >> 31) << 3) | ((r == 0) << 2) | (c << 1) | v;
+}
+
+static const uint32_t CompareOperands[][2] =
+{
+  {0, 0}, {1, 2}, {2, 1}, {0x80000000, 1}, {0x7FFFFFFF, 0xFFFFFFFF},
+  {0xFFFFFFFF, 0xFFFFFFFF}, {0x80000000, 0x80000000}, {0x7FFFFFFF, 0x80000000}
+};
+
+static EngineVector conditionVectors[sizeof(CompareOperands) / sizeof(CompareOperands[0]) * 3 * 16];
+
+//Every condition against every NZCV, then against the flags left pending by CMP, CMN and TST.
+//ARM runs movcc r0, #1, Thumb runs bcc over add r0, sp, #4. Thumb has no AL or NV branch.
+static void Conditions(bool thumb)
+{
+  const uint32_t conditions = thumb ? 14 : 16;
+  const uint32_t Compares[2][3] = {{0xE1510002, 0xE1710002, 0xE1110002}, {0x4291, 0x42D1, 0x4211}};
+  uint32_t n = 0;
+
+  memset(conditionVectors, 0, sizeof(conditionVectors));
+
+  for(uint32_t condition = 0; condition < conditions; condition++)
+  {
+    for(uint32_t nzcv = 0; nzcv < 16; nzcv++, n++)
+    {
+      EngineVector *v = &conditionVectors[n];
+      bool passes = ConditionPasses(condition, nzcv);
+
+      v->code[0] = thumb ? 0xD000 | (condition << 8) : (condition << 28) | 0x03A00001;
+      v->code[1] = thumb ? 0xA801 : 0;
+      v->nzcv = (uint8_t)nzcv;
+      v->nzcvResult = (uint8_t)nzcv;
+      v->result = thumb ? (passes ? 0 : 0x03007F04) : passes;
+    }
+  }
+
+  Vectors(thumb ? "Thumb condition" : "ARM condition", conditionVectors, n, thumb);
+
+  n = 0;
+  memset(conditionVectors, 0, sizeof(conditionVectors));
+
+  for(uint32_t i = 0; i < sizeof(CompareOperands) / sizeof(CompareOperands[0]); i++)
+  {
+    for(uint32_t op = 0; op < 3; op++)
+    {
+      for(uint32_t condition = 0; condition < conditions; condition++, n++)
+      {
+        EngineVector *v = &conditionVectors[n];
+        uint32_t nzcv = CompareFlags(op, CompareOperands[i][0], CompareOperands[i][1]);
+        bool passes = ConditionPasses(condition, nzcv);
+
+        v->code[0] = Compares[thumb][op];
+        v->code[1] = thumb ? 0xD000 | (condition << 8) : (condition << 28) | 0x03A00001;
+        v->code[2] = thumb ? 0xA801 : 0;
+        v->rn = CompareOperands[i][0];
+        v->rm = CompareOperands[i][1];
+        v->nzcv = 0x3;
+        v->nzcvResult = (uint8_t)nzcv;
+
+        if(thumb)
+        {
+          v->result = passes ? v->rn : 0x03007F04;
+        }
+        else
+        {
+          v->result = passes ? 1 : v->rn;
+        }
+      }
+    }
+  }
+
+  Vectors(thumb ? "Thumb condition after compare" : "ARM condition after compare", conditionVectors, n, thumb);
+}
+
+int main(int argc, char **argv)
+{
+  if(argc > 1 && (runsFile = fopen(argv[1], "w")) == NULL)
+  {
+    printf("EngineTest: can't write %s\n", argv[1]);
+    return 1;
+  }
+
+  armCore = ArmCore(&p);
+  thumbCore = ThumbCore(&p);
+  sound.StartSM(44100, &p);
+  p.BuildPageTable();
+  p.Reset(true);
+
+  for(uint32_t i = 0; i < 0x8000; i += 4)
+  {
+    *(uint32_t *)&fill[i] = 0xEAFFFFFE;
+  }
+
+  for(uint8_t page = 0; page < PAGE_COUNT; page++)
+  {
+    if(page != 0x3)
+    {
+      p.SetPagePointers(page, fill, scratch, 0x7FFF);
+    }
+  }
+
+  initial = p;
+
+  uint32_t hits = 0;
+  uint32_t invalidations = 0;
+
+  Differential("random Thumb", true, PROGRAMS, &hits, &invalidations);
+  PairSlices();
+  Differential("random ARM", false, PROGRAMS, &hits, &invalidations);
+  Vectors("ARM vector", ArmVectors, sizeof(ArmVectors) / sizeof(ArmVectors[0]), false);
+  Vectors("ARM flag vector", ArmFlagVectors, sizeof(ArmFlagVectors) / sizeof(ArmFlagVectors[0]), false);
+  Vectors("Thumb vector", ThumbVectors, sizeof(ThumbVectors) / sizeof(ThumbVectors[0]), true);
+  Conditions(false);
+  Conditions(true);
+  Check("block cache ran", hits != 0);
+  Check("self-modifying stores dropped blocks", invalidations != 0);
+
+  if(runsFile != NULL)
+  {
+    fclose(runsFile);
+  }
+
+  if(failures == 0)
+  {
+    printf("EngineTest: ok\n");
+  }
+
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,127 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+//IWRAM and palette RAM live in internal arrays, no access to them may reach the SRAM bus.
+//Drives them through every accessor and a Thumb copy loop, then checks the SRAM model saw nothing.
+
+#include <stdio.h>
+#include "GBA_Arm7.h"
+#include "GBA_ArmCore.h"
+#include "GBA_ThumbCore.h"
+#include "GBA_SoundManager.h"
+
+extern ArmCore armCore;
+extern ThumbCore thumbCore;
+extern SoundManager sound;
+
+static Processor p;
+static uint32_t failures = 0;
+
+//Copies 256 bytes of IWRAM to PALRAM forever, with word, byte and halfword accesses and a push/pop
+static const uint16_t CopyLoop[] = { 0x2003, 0x0600, 0x2105, 0x0609, 0x22FC, 0x5883, 0x508B, 0x5C84, 0x528C, 0xB40C, 0xBC0C, 0x3A04, 0xD5F7, 0xE7F5 };
+
+static uint32_t BusAccesses()
+{
+  uint32_t total = 0;
+
+  for(uint8_t i = 0; i < SRAM_MODEL_REGIONS; i++)
+  {
+    total += sramModel.stats[i].reads + sramModel.stats[i].writes + sramModel.stats[i].portWrites + sramModel.stats[i].pinReads;
+  }
+
+  return total;
+}
+
+static void Check(const char *name, bool ok)
+{
+  if(!ok)
+  {
+    printf("InternalRamTest: %s FAILED\n", name);
+    failures++;
+  }
+}
+
+static void Accessors(uint32_t base, uint32_t RAMRange, uint32_t size)
+{
+  for(uint32_t offset = 0; offset < size; offset += 4)
+  {
+    p.WriteU32(base + offset, offset * 0x01010101);
+    p.WriteU16(base + offset, (uint16_t)offset);
+    p.WriteU8(base + offset + 2, (uint8_t)offset);
+    p.ReadU8(base + offset);
+    p.ReadU16(base + offset + 2);
+    p.ReadU32(base + offset);
+    p.WriteU32(offset, RAMRange, offset);
+    p.ReadU32(offset, RAMRange);
+  }
+}
+
+int main()
+{
+  armCore = ArmCore(&p);
+  thumbCore = ThumbCore(&p);
+  sound.StartSM(44100, &p);
+  p.BuildPageTable();
+  p.Reset(true);
+  sramCache.Invalidate();
+  sramModel.ResetStats();
+
+  Accessors(0x03000000, iwRamStart, 0x8000);
+  Check("IWRAM accessors", BusAccesses() == 0);
+
+  Accessors(0x05000000, palRamStart, 0x400);
+  Check("PALRAM accessors", BusAccesses() == 0);
+
+  for(uint32_t offset = 0; offset < 0x400; offset += 2)
+  {
+    p.Read<Region::IWRAM, uint16_t>(offset);
+    p.Read<Region::PAL, uint16_t>(offset);
+  }
+
+  Check("renderer reads", BusAccesses() == 0);
+
+  for(uint32_t i = 0; i < sizeof(CopyLoop) / sizeof(CopyLoop[0]); i++)
+  {
+    p.WriteU16(0x03000000 + i * 2, CopyLoop[i]);
+  }
+
+  p.cpsr |= p.T_MASK;
+  p.registers[15] = 0x03000000;
+  p.ReloadQueue();
+  p.Execute(200000);
+  Check("Thumb copy loop", BusAccesses() == 0);
+  Check("Thumb copy loop ran", p.ReadU32(0x050000FC) == p.ReadU32(0x030000FC));
+
+  //The model does see EWRAM, so the zeros above mean something
+  sramCache.Invalidate();
+  p.ReadU32(0x02000000);
+  Check("EWRAM reaches the bus", BusAccesses() != 0);
+
+  if(failures == 0)
+  {
+    printf("InternalRamTest: ok\n");
+  }
+
+  return failures == 0 ? 0 : 1;
+}
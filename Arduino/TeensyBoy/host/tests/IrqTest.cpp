@@ -0,0 +1,124 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+//The native IRQ trampoline pushes its frame on the IRQ mode stack the BIOS sets up at 3007FA0h,
+//which needs r13 banked per mode. Interrupts an ARM loop twice and checks both frames land there
+//and that the interrupted mode gets its own r13 and r14 back.
+
+#include <stdio.h>
+#include "GBA_Arm7.h"
+#include "GBA_ArmCore.h"
+#include "GBA_ThumbCore.h"
+#include "GBA_SoundManager.h"
+
+extern ArmCore armCore;
+extern ThumbCore thumbCore;
+extern SoundManager sound;
+
+static Processor p;
+static uint32_t failures = 0;
+
+#define IRQ_STACK 0x03007FA0
+#define SYS_STACK 0x03007F00
+#define LOOP 0x03000000
+#define HANDLER 0x03000100
+
+static void Check(const char *name, bool ok)
+{
+  if(!ok)
+  {
+    printf("IrqTest: %s FAILED\n", name);
+    failures++;
+  }
+}
+
+static void Interrupt(const char *name)
+{
+  static char label[64];
+  uint32_t r0 = p.registers[0], r12 = p.registers[12], lr = p.registers[14];
+
+  p.RequestIrq(0);
+  p.FireIrq();
+
+  uint32_t frame = IRQ_STACK - 24;
+  snprintf(label, sizeof(label), "%s IRQ mode", name);
+  Check(label, (p.cpsr & 0x1F) == 0x12);
+  snprintf(label, sizeof(label), "%s IRQ r13", name);
+  Check(label, p.registers[13] == frame);
+  snprintf(label, sizeof(label), "%s IRQ r14", name);
+  Check(label, p.registers[14] == IRQ_RETURN);
+  snprintf(label, sizeof(label), "%s frame", name);
+  Check(label, p.ReadU32(frame) == r0 && p.ReadU32(frame + 16) == r12);
+
+  //Acknowledge and let the handler return through the trampoline
+  p.WriteU16(IF, ioRegStart, 0);
+  p.Execute(64);
+
+  snprintf(label, sizeof(label), "%s back in SYS", name);
+  Check(label, (p.cpsr & 0x1F) == 0x1F);
+  snprintf(label, sizeof(label), "%s SYS r13", name);
+  Check(label, p.registers[13] == SYS_STACK);
+  snprintf(label, sizeof(label), "%s SYS r14", name);
+  Check(label, p.registers[14] == lr);
+  snprintf(label, sizeof(label), "%s registers", name);
+  Check(label, p.registers[0] == r0 && p.registers[12] == r12);
+  snprintf(label, sizeof(label), "%s back in the loop", name);
+  Check(label, p.registers[15] >= LOOP && p.registers[15] <= LOOP + 12);
+}
+
+int main()
+{
+  armCore = ArmCore(&p);
+  thumbCore = ThumbCore(&p);
+  sound.StartSM(44100, &p);
+  p.BuildPageTable();
+  p.Reset(true);
+
+  p.WriteU32(LOOP, 0xE2844001);      //add r4, r4, #1
+  p.WriteU32(LOOP + 4, 0xEAFFFFFD);  //b LOOP
+  p.WriteU32(HANDLER, 0xE12FFF1E);   //bx lr
+  p.WriteU32(IRQ_HANDLER, HANDLER);
+  p.WriteU16(IE0, ioRegStart, 1);
+  p.WriteU16(IME, ioRegStart, 1);
+
+  p.registers[0] = 0x11111111;
+  p.registers[12] = 0xCCCCCCCC;
+  p.registers[14] = 0xEEEEEEEE;
+  p.registers[15] = LOOP;
+  p.ReloadQueue();
+  p.Execute(64);
+  Check("SYS r13", p.registers[13] == SYS_STACK);
+
+  Interrupt("first");
+  uint32_t count = p.registers[4];
+  Interrupt("second");
+  Check("loop kept running", p.registers[4] > count);
+
+  if(failures == 0)
+  {
+    printf("IrqTest: ok\n");
+  }
+
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,169 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+//Placement planner on a made up access pattern: the two busiest SRAM blocks get pinned after the
+//first profile window, moving the traffic to two other blocks swaps them out in the next one, and
+//the data written while they were pinned reaches the SRAM when they're unpinned.
+
+#include <stdio.h>
+#include "GBA_Arm7.h"
+#include "GBA_ArmCore.h"
+#include "GBA_ThumbCore.h"
+#include "GBA_SoundManager.h"
+#include "GBA_Placement.h"
+
+extern ArmCore armCore;
+extern ThumbCore thumbCore;
+extern SoundManager sound;
+
+static Processor p;
+static uint32_t failures = 0;
+
+#define EWRAM_BLOCK(n) (0x02000000 + (n) * SRAM_PIN_BLOCK_SIZE)
+#define VRAM_BLOCK(n) (0x06000000 + (n) * SRAM_PIN_BLOCK_SIZE)
+
+static void Check(const char *name, bool ok)
+{
+  if(!ok)
+  {
+    printf("PlacementTest: %s FAILED\n", name);
+    failures++;
+  }
+}
+
+//One store per cache line, blocks 4KB apart share every line of the direct mapped cache
+static void Touch(uint32_t base, uint32_t seed)
+{
+  for(uint32_t offset = 0; offset < SRAM_PIN_BLOCK_SIZE; offset += SRAM_CACHE_LINE_SIZE)
+  {
+    p.WriteU32(base + offset, seed + offset);
+  }
+}
+
+static bool Holds(uint32_t base, uint32_t seed)
+{
+  for(uint32_t offset = 0; offset < SRAM_PIN_BLOCK_SIZE; offset += SRAM_CACHE_LINE_SIZE)
+  {
+    if(p.ReadU32(base + offset) != seed + offset) return false;
+  }
+
+  return true;
+}
+
+static bool InSRAM(uint32_t address, uint32_t seed)
+{
+  for(uint32_t offset = 0; offset < SRAM_PIN_BLOCK_SIZE; offset += SRAM_CACHE_LINE_SIZE)
+  {
+    const uint8_t *m = &sramModel.memory[address + offset];
+
+    if((uint32_t)(m[0] | (m[1] << 8) | (m[2] << 16) | (m[3] << 24)) != seed + offset) return false;
+  }
+
+  return true;
+}
+
+static uint32_t BusAccesses()
+{
+  uint32_t total = 0;
+
+  for(uint8_t i = 0; i < SRAM_MODEL_REGIONS; i++)
+  {
+    total += sramModel.stats[i].reads + sramModel.stats[i].writes;
+  }
+
+  return total;
+}
+
+int main()
+{
+  armCore = ArmCore(&p);
+  thumbCore = ThumbCore(&p);
+  sound.StartSM(44100, &p);
+  p.BuildPageTable();
+  p.Reset(true);
+  sramCache.Invalidate();
+  placement.Begin(0x54535450); //"PTST", not in placementOverrides
+
+  //Window 1, EWRAM block 1 and VRAM block 2 are hot, EWRAM block 5 is warm
+  for(uint32_t frame = 0; frame < PLACEMENT_PROFILE_FRAMES; frame++)
+  {
+    Touch(EWRAM_BLOCK(1), 0x1000);
+    Touch(VRAM_BLOCK(2), 0x2000);
+    Touch(EWRAM_BLOCK(1), 0x1000);
+    Touch(VRAM_BLOCK(2), 0x2000);
+
+    if((frame & 3) == 0)
+    {
+      Touch(EWRAM_BLOCK(5), 0x5000);
+    }
+
+    placement.EndFrame();
+  }
+
+  Check("hot EWRAM block placed", sramCache.IsPinned(ewRamStart + 1 * SRAM_PIN_BLOCK_SIZE));
+  Check("hot VRAM block placed", sramCache.IsPinned(vRamStart + 2 * SRAM_PIN_BLOCK_SIZE));
+  Check("warm block left in SRAM", !sramCache.IsPinned(ewRamStart + 5 * SRAM_PIN_BLOCK_SIZE));
+  Check("profile reset after the plan", sramCache.blockTraffic[1] == 0 && sramCache.blockAccesses[1] == 0);
+  Check("placed data kept", Holds(EWRAM_BLOCK(1), 0x1000) && Holds(VRAM_BLOCK(2), 0x2000) && Holds(EWRAM_BLOCK(5), 0x5000));
+
+  sramModel.ResetStats();
+  Touch(EWRAM_BLOCK(1), 0x1100);
+  Touch(VRAM_BLOCK(2), 0x2100);
+  Check("placed blocks skip the bus", BusAccesses() == 0);
+
+  //Window 2, the game moves on to EWRAM blocks 5 and 6
+  for(uint32_t frame = 0; frame < PLACEMENT_PROFILE_FRAMES; frame++)
+  {
+    Touch(EWRAM_BLOCK(5), 0x5000);
+    Touch(EWRAM_BLOCK(6), 0x6000);
+    Touch(EWRAM_BLOCK(5), 0x5000);
+    Touch(EWRAM_BLOCK(6), 0x6000);
+    placement.EndFrame();
+  }
+
+  Check("new hot blocks placed", sramCache.IsPinned(ewRamStart + 5 * SRAM_PIN_BLOCK_SIZE) && sramCache.IsPinned(ewRamStart + 6 * SRAM_PIN_BLOCK_SIZE));
+  Check("cold blocks unplaced", !sramCache.IsPinned(ewRamStart + 1 * SRAM_PIN_BLOCK_SIZE) && !sramCache.IsPinned(vRamStart + 2 * SRAM_PIN_BLOCK_SIZE));
+  Check("unplaced data written back", InSRAM(ewRamStart + 1 * SRAM_PIN_BLOCK_SIZE, 0x1100) && InSRAM(vRamStart + 2 * SRAM_PIN_BLOCK_SIZE, 0x2100));
+  Check("unplaced data readable", Holds(EWRAM_BLOCK(1), 0x1100) && Holds(VRAM_BLOCK(2), 0x2100));
+
+  //Window 3, same traffic, nothing moves
+  sramModel.ResetStats();
+
+  for(uint32_t frame = 0; frame < PLACEMENT_PROFILE_FRAMES; frame++)
+  {
+    Touch(EWRAM_BLOCK(5), 0x5000);
+    Touch(EWRAM_BLOCK(6), 0x6000);
+    placement.EndFrame();
+  }
+
+  Check("stable traffic keeps the placement", sramCache.IsPinned(ewRamStart + 5 * SRAM_PIN_BLOCK_SIZE) && sramCache.IsPinned(ewRamStart + 6 * SRAM_PIN_BLOCK_SIZE));
+  Check("stable placement moves nothing", BusAccesses() == 0);
+
+  if(failures == 0)
+  {
+    printf("PlacementTest: ok\n");
+  }
+
+  return failures == 0 ? 0 : 1;
+}
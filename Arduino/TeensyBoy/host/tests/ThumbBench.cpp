@@ -0,0 +1,93 @@
+/* TeenyBoy code is placed under the MIT license
+   Copyright (c) 2017 Chris Mortimer
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+   BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+   SOFTWARE.
+*/
+
+//Thumb interpreter throughput on a fixed instruction mix running from IWRAM.
+//Loads and stores of each width, ALU and shift ops, a hi register move, push/pop,
+//a BL/BX call and conditional and unconditional branches, 26 instructions a loop.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "GBA_Arm7.h"
+#include "GBA_ArmCore.h"
+#include "GBA_ThumbCore.h"
+#include "GBA_SoundManager.h"
+
+extern ArmCore armCore;
+extern ThumbCore thumbCore;
+extern SoundManager sound;
+
+static Processor p;
+
+#define MIX_INSTRUCTIONS 26 //Per loop, r7 counts the loops
+
+#if defined(THREADED_DISPATCH)
+#define BENCH_NAME "ThumbBench (threaded)"
+#elif defined(THUMB_TABLE_DISPATCH)
+#define BENCH_NAME "ThumbBench (table)"
+#else
+#define BENCH_NAME "ThumbBench"
+#endif
+
+static const uint16_t Mix[] =
+{
+  0x2003, 0x0600, 0x2101, 0x0309, 0x1840, 0x2700,                 //r0 = 0x03001000, r7 = 0
+  0x6801, 0x6842, 0x188B, 0x00DC, 0x404C, 0x4014, 0x431C, 0x6084, //ldr, ldr, add, lsl, eor, and, orr, str
+  0x8845, 0x7305, 0x46A0, 0x4444, 0xB41E, 0xF000, 0xF808, 0xBC1E, //ldrh, strb, mov hi, add hi, push, bl, pop
+  0x1E4E, 0x42B6, 0xD1EC, 0x6003, 0x6046, 0x3701, 0xE7E8,         //sub, cmp, bne (not taken), str, str, add, b
+  0x0849, 0x3201, 0x4770                                          //lsr, add, bx lr
+};
+
+int main(int argc, char **argv)
+{
+  uint32_t loops = argc > 1 ? strtoul(argv[1], NULL, 0) : 2000000;
+
+  armCore = ArmCore(&p);
+  thumbCore = ThumbCore(&p);
+  sound.StartSM(44100, &p);
+  p.BuildPageTable();
+  p.Reset(true);
+
+  for(uint32_t i = 0; i < sizeof(Mix) / sizeof(Mix[0]); i++)
+  {
+    p.WriteU16(0x03000000 + i * 2, Mix[i]);
+  }
+
+  p.cpsr |= p.T_MASK;
+  p.registers[15] = 0x03000000;
+  p.ReloadQueue();
+
+  auto start = std::chrono::steady_clock::now();
+
+  while(p.registers[7] < loops)
+  {
+    p.Execute(100000);
+  }
+
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  double instructions = (double)p.registers[7] * MIX_INSTRUCTIONS;
+
+  printf(BENCH_NAME ": %.0f instructions in %.3fs, %.1f MIPS\n", instructions, seconds, instructions / seconds / 1000000.0);
+  return 0;
+}